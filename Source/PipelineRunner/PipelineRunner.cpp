@@ -66,6 +66,7 @@
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 #ifdef SIMPL_EMBED_PYTHON
 #include "SIMPLib/Python/PythonLoader.h"
@@ -159,9 +160,24 @@ int main(int argc, char* argv[])
                                                  << "logfile",
                                    "Save output to file", "log");
   parser.addOption(logFileOption);
+
+  QCommandLineOption threadsOption(QStringList() << "t"
+                                                 << "threads",
+                                   "Maximum number of threads used by the whole process. 0 uses all available cores.", "count", "0");
+  parser.addOption(threadsOption);
+
+  QCommandLineOption pipelineThreadsOption(QStringList() << "pipeline-threads", "Maximum number of threads used by the pipeline's task arena. 0 uses the default.", "count", "0");
+  parser.addOption(pipelineThreadsOption);
+
+  QCommandLineOption numaNodeOption(QStringList() << "numa-node", "NUMA node to pin the pipeline's threads to. Requires oneTBB 2021 or newer.", "node", "-1");
+  parser.addOption(numaNodeOption);
+
   // Process the actual command line arguments given by the user
   parser.process(app);
 
+  ParallelExecutionContext::SetProcessMaxConcurrency(parser.value(threadsOption).toInt());
+  ParallelExecutionContext::SetDefaultPipelineSettings(parser.value(pipelineThreadsOption).toInt(), parser.value(numaNodeOption).toInt());
+
   QString pipelineFile = parser.value(pipelineFileArg);
   QString logFile = parser.value(logFileOption);
 
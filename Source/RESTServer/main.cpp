@@ -62,8 +62,10 @@
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/REST/PipelineJobManager.h"
 #include "SIMPLib/REST/SIMPLRequestMapper.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 // -----------------------------------------------------------------------------
 // Search the configuration file
@@ -139,6 +141,35 @@ int main(int argc, char* argv[])
   QSettings config(configFileName, QSettings::IniFormat, &app);
   ServerSettings serverSettings(config);
 
+  // Configure the threads used by the pipelines. Each executing pipeline gets its own task arena.
+  config.beginGroup("parallel");
+  ParallelExecutionContext::SetProcessMaxConcurrency(config.value("maxConcurrency", 0).toInt());
+  ParallelExecutionContext::SetDefaultPipelineSettings(config.value("pipelineConcurrency", 0).toInt(), config.value("numaNode", -1).toInt());
+  config.endGroup();
+
+  // Configure the worker threads that execute the asynchronously submitted pipelines
+  config.beginGroup("jobs");
+  PipelineJobManager* jobManager = PipelineJobManager::Instance();
+  int maxConcurrentJobs = config.value("maxConcurrentJobs", 0).toInt();
+  if(maxConcurrentJobs > 0)
+  {
+    jobManager->setMaxConcurrentJobs(maxConcurrentJobs);
+  }
+  jobManager->setMaxRetainedJobs(config.value("maxRetainedJobs", 1000).toInt());
+  PipelineJobScheduler::Pointer scheduler = jobManager->getScheduler();
+  qulonglong memoryBudget = config.value("memoryBudget", 0).toULongLong();
+  if(memoryBudget > 0)
+  {
+    scheduler->setMemoryBudget(memoryBudget * 1024 * 1024);
+  }
+  int coreBudget = config.value("coreBudget", 0).toInt();
+  if(coreBudget > 0)
+  {
+    scheduler->setCoreBudget(coreBudget);
+  }
+  jobManager->setCoresPerJob(config.value("coresPerJob", 0).toInt());
+  config.endGroup();
+
   HttpSessionStore* sessionStore = HttpSessionStore::CreateInstance(&serverSettings, &app);
   sessionStore = nullptr; // This is here to quiet the compiler about unused variable.
   // Configure static file controller
@@ -151,6 +182,9 @@ int main(int argc, char* argv[])
 
   app.exec();
 
+  // Let the running pipelines finish before the filters they use are unloaded
+  PipelineJobManager::Instance()->waitForDone();
+
   qWarning() << "Application has stopped";
 
   ////////
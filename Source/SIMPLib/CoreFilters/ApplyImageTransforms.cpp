@@ -34,16 +34,593 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ApplyImageTransforms.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <QtCore/QStringList>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataContainerSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/TransformContainer.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// Output cells are visited in blocks of this many cells along X, Y and Z. Neighboring output cells sample
+// neighboring input cells, so a block keeps the input data it gathers in cache however the transform rotates the image.
+constexpr std::array<size_t, 3> k_TileDims = {32, 32, 8};
+
+// Matrix entries closer than this to the identity are treated as a pure translation
+constexpr double k_IdentityTolerance = 1.0E-6;
+
+/**
+ * @brief The AffineTransform struct stores the affine map y = Matrix * x + Offset. Following the ITK convention of
+ * the transforms held in a TransformContainer it takes a point of the resampled image to the point of the original
+ * image that it samples.
+ */
+struct AffineTransform
+{
+  std::array<double, 9> Matrix = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  std::array<double, 3> Offset = {0.0, 0.0, 0.0};
+
+  void apply(const double point[3], double result[3]) const
+  {
+    for(size_t r = 0; r < 3; r++)
+    {
+      result[r] = Matrix[r * 3] * point[0] + Matrix[r * 3 + 1] * point[1] + Matrix[r * 3 + 2] * point[2] + Offset[r];
+    }
+  }
+
+  bool isTranslation() const
+  {
+    const std::array<double, 9> identity = AffineTransform().Matrix;
+    for(size_t i = 0; i < 9; i++)
+    {
+      if(std::abs(Matrix[i] - identity[i]) > k_IdentityTolerance)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool invert(AffineTransform& inverse) const
+  {
+    const std::array<double, 9>& m = Matrix;
+    double det = m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+    if(!std::isfinite(det) || std::abs(det) < std::numeric_limits<double>::epsilon())
+    {
+      return false;
+    }
+    // clang-format off
+    inverse.Matrix = {(m[4] * m[8] - m[5] * m[7]) / det, (m[2] * m[7] - m[1] * m[8]) / det, (m[1] * m[5] - m[2] * m[4]) / det,
+                      (m[5] * m[6] - m[3] * m[8]) / det, (m[0] * m[8] - m[2] * m[6]) / det, (m[2] * m[3] - m[0] * m[5]) / det,
+                      (m[3] * m[7] - m[4] * m[6]) / det, (m[1] * m[6] - m[0] * m[7]) / det, (m[0] * m[4] - m[1] * m[3]) / det};
+    // clang-format on
+    for(size_t r = 0; r < 3; r++)
+    {
+      inverse.Offset[r] = -(inverse.Matrix[r * 3] * Offset[0] + inverse.Matrix[r * 3 + 1] * Offset[1] + inverse.Matrix[r * 3 + 2] * Offset[2]);
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief The TransformKind enum lists the ITK transforms that the filter can apply
+ */
+enum class TransformKind
+{
+  Affine,
+  Translation
+};
+
+/**
+ * @brief The TransformType struct describes an ITK transform type such as "AffineTransform_double_3_3"
+ */
+struct TransformType
+{
+  TransformKind Kind = TransformKind::Affine;
+  size_t Dims = 0;
+
+  /**
+   * @brief Returns the number of parameters ITK stores for the transform: the row major matrix followed by the
+   * translation for an affine transform, only the translation for a translation transform
+   * @return
+   */
+  size_t getNumberOfParameters() const
+  {
+    return Kind == TransformKind::Affine ? Dims * Dims + Dims : Dims;
+  }
+};
+
+/**
+ * @brief Parses the ITK type name stored in a TransformContainer, which has the form
+ * "<TransformName>_<ScalarType>_<InputDimension>_<OutputDimension>". The parameter count alone can not tell the
+ * transforms apart (a 3D Euler transform has as many parameters as a 2D affine transform), so only the transforms
+ * listed in TransformKind are accepted.
+ * @param typeName
+ * @param type
+ * @return false if the type is not a 2D or 3D affine or translation transform
+ */
+bool ParseTransformType(const std::string& typeName, TransformType& type)
+{
+  const QStringList tokens = QString::fromStdString(typeName).split('_');
+  if(tokens.size() != 4 || tokens[2] != tokens[3] || (tokens[2] != "2" && tokens[2] != "3"))
+  {
+    return false;
+  }
+  if(tokens[0] == "AffineTransform" || tokens[0] == "MatrixOffsetTransformBase")
+  {
+    type.Kind = TransformKind::Affine;
+  }
+  else if(tokens[0] == "TranslationTransform")
+  {
+    type.Kind = TransformKind::Translation;
+  }
+  else
+  {
+    return false;
+  }
+  type.Dims = tokens[2].toULongLong();
+  return true;
+}
+
+/**
+ * @brief Builds the affine map of the transform stored in a TransformContainer. The optional fixed
+ * parameters hold the center of rotation of an affine transform.
+ * @param container
+ * @param transform
+ * @return false if the container does not hold a supported transform with the expected number of parameters
+ */
+bool CreateAffineTransform(const TransformContainer& container, AffineTransform& transform)
+{
+  TransformType type;
+  const TransformContainer::TransformParametersType parameters = container.getParameters();
+  if(!ParseTransformType(container.getTransformTypeAsString(), type) || parameters.size() != type.getNumberOfParameters())
+  {
+    return false;
+  }
+
+  transform = AffineTransform();
+  const size_t dims = type.Dims;
+  if(type.Kind == TransformKind::Translation)
+  {
+    for(size_t r = 0; r < dims; r++)
+    {
+      transform.Offset[r] = parameters[r];
+    }
+    return true;
+  }
+
+  const TransformContainer::TransformFixedParametersType center = container.getFixedParameters();
+  for(size_t r = 0; r < dims; r++)
+  {
+    for(size_t c = 0; c < dims; c++)
+    {
+      transform.Matrix[r * 3 + c] = parameters[r * dims + c];
+    }
+  }
+  for(size_t r = 0; r < dims; r++)
+  {
+    double offset = parameters[dims * dims + r];
+    if(center.size() >= dims)
+    {
+      offset += center[r];
+      for(size_t c = 0; c < dims; c++)
+      {
+        offset -= transform.Matrix[r * 3 + c] * center[c];
+      }
+    }
+    transform.Offset[r] = offset;
+  }
+  return true;
+}
+
+/**
+ * @brief Replaces the transform stored in the container with the identity once it has been applied
+ * @param container
+ */
+void ResetToIdentity(TransformContainer& container)
+{
+  TransformType type;
+  if(!ParseTransformType(container.getTransformTypeAsString(), type))
+  {
+    return;
+  }
+  TransformContainer::TransformParametersType parameters(type.getNumberOfParameters(), 0.0);
+  if(type.Kind == TransformKind::Affine)
+  {
+    for(size_t i = 0; i < type.Dims; i++)
+    {
+      parameters[i * type.Dims + i] = 1.0;
+    }
+  }
+  container.setParameters(parameters);
+}
+
+struct ResampledGeometry
+{
+  SizeVec3Type Dims;
+  FloatVec3Type Spacing;
+  FloatVec3Type Origin;
+};
+
+/**
+ * @brief Determines the Image Geometry that holds the whole original image once the transform is applied. Each
+ * axis takes the spacing of the original axis it is most aligned with, scaled so that the sampling density is unchanged.
+ * @param image
+ * @param transform
+ * @param inverse
+ * @return
+ */
+ResampledGeometry ComputeResampledGeometry(const ImageGeom& image, const AffineTransform& transform, const AffineTransform& inverse)
+{
+  const SizeVec3Type dims = image.getDimensions();
+  const FloatVec3Type spacing = image.getSpacing();
+  const FloatVec3Type origin = image.getOrigin();
+
+  std::array<double, 3> newSpacing = {0.0, 0.0, 0.0};
+  for(size_t c = 0; c < 3; c++)
+  {
+    const std::array<double, 3> column = {transform.Matrix[c], transform.Matrix[3 + c], transform.Matrix[6 + c]};
+    const double length = std::sqrt(column[0] * column[0] + column[1] * column[1] + column[2] * column[2]);
+    size_t axis = 0;
+    for(size_t r = 1; r < 3; r++)
+    {
+      if(std::abs(column[r]) > std::abs(column[axis]))
+      {
+        axis = r;
+      }
+    }
+    newSpacing[c] = spacing[axis] / length;
+  }
+
+  std::array<double, 3> minCoords = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  std::array<double, 3> maxCoords = {-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+  for(size_t corner = 0; corner < 8; corner++)
+  {
+    double point[3] = {0.0, 0.0, 0.0};
+    for(size_t a = 0; a < 3; a++)
+    {
+      point[a] = origin[a] + (((corner >> a) & 1) != 0 ? static_cast<double>(dims[a]) * spacing[a] : 0.0);
+    }
+    double mapped[3] = {0.0, 0.0, 0.0};
+    inverse.apply(point, mapped);
+    for(size_t a = 0; a < 3; a++)
+    {
+      minCoords[a] = std::min(minCoords[a], mapped[a]);
+      maxCoords[a] = std::max(maxCoords[a], mapped[a]);
+    }
+  }
+
+  ResampledGeometry geometry;
+  for(size_t a = 0; a < 3; a++)
+  {
+    geometry.Dims[a] = static_cast<size_t>(std::max(1.0, std::nearbyint((maxCoords[a] - minCoords[a]) / newSpacing[a])));
+    geometry.Spacing[a] = static_cast<float>(newSpacing[a]);
+    geometry.Origin[a] = static_cast<float>(minCoords[a]);
+  }
+  return geometry;
+}
+
+/**
+ * @brief The AffineResampler class maps every cell of the resampled image onto the continuous cell coordinates of
+ * the original image that it samples (original cell centers sit on whole numbers). Because the map is affine in the
+ * cell indices, walking along a row only adds a constant step. Cells are visited one tile at a time, in the same way
+ * SampleRefFrameRotator splits the rotated volume into blocks, so each tile is an independent unit of parallel work.
+ */
+class AffineResampler
+{
+public:
+  AffineResampler(const ImageGeom& source, const ResampledGeometry& target, const AffineTransform& transform)
+  : m_SourceDims(source.getDimensions())
+  , m_TargetDims(target.Dims)
+  {
+    const FloatVec3Type spacing = source.getSpacing();
+    const FloatVec3Type origin = source.getOrigin();
+
+    double firstCenter[3] = {0.0, 0.0, 0.0};
+    for(size_t a = 0; a < 3; a++)
+    {
+      firstCenter[a] = target.Origin[a] + 0.5 * target.Spacing[a];
+    }
+    double mapped[3] = {0.0, 0.0, 0.0};
+    transform.apply(firstCenter, mapped);
+
+    for(size_t r = 0; r < 3; r++)
+    {
+      m_Start[r] = (mapped[r] - origin[r]) / spacing[r] - 0.5;
+      for(size_t c = 0; c < 3; c++)
+      {
+        m_Steps[c][r] = transform.Matrix[r * 3 + c] * target.Spacing[c] / spacing[r];
+      }
+    }
+    for(size_t a = 0; a < 3; a++)
+    {
+      m_NumTiles[a] = (m_TargetDims[a] + k_TileDims[a] - 1) / k_TileDims[a];
+    }
+  }
+
+  ~AffineResampler() = default;
+
+  const SizeVec3Type& getSourceDims() const
+  {
+    return m_SourceDims;
+  }
+
+  size_t getNumberOfTiles() const
+  {
+    return m_NumTiles[0] * m_NumTiles[1] * m_NumTiles[2];
+  }
+
+  /**
+   * @brief Calls visitor(targetIndex, coords) for every cell of the tile, where coords are the continuous cell
+   * coordinates of the original image sampled by that cell
+   * @param tile
+   * @param visitor
+   */
+  template <typename Visitor>
+  void visitTile(size_t tile, Visitor& visitor) const
+  {
+    const size_t tileIndex[3] = {tile % m_NumTiles[0], (tile / m_NumTiles[0]) % m_NumTiles[1], tile / (m_NumTiles[0] * m_NumTiles[1])};
+    size_t start[3] = {0, 0, 0};
+    size_t end[3] = {0, 0, 0};
+    for(size_t a = 0; a < 3; a++)
+    {
+      start[a] = tileIndex[a] * k_TileDims[a];
+      end[a] = std::min(start[a] + k_TileDims[a], m_TargetDims[a]);
+    }
+
+    for(size_t z = start[2]; z < end[2]; z++)
+    {
+      for(size_t y = start[1]; y < end[1]; y++)
+      {
+        double coords[3] = {0.0, 0.0, 0.0};
+        for(size_t a = 0; a < 3; a++)
+        {
+          coords[a] = m_Start[a] + static_cast<double>(start[0]) * m_Steps[0][a] + static_cast<double>(y) * m_Steps[1][a] + static_cast<double>(z) * m_Steps[2][a];
+        }
+        size_t targetIndex = (z * m_TargetDims[1] + y) * m_TargetDims[0] + start[0];
+        for(size_t x = start[0]; x < end[0]; x++, targetIndex++)
+        {
+          visitor(targetIndex, coords);
+          coords[0] += m_Steps[0][0];
+          coords[1] += m_Steps[0][1];
+          coords[2] += m_Steps[0][2];
+        }
+      }
+    }
+  }
+
+private:
+  SizeVec3Type m_SourceDims;
+  SizeVec3Type m_TargetDims;
+  std::array<size_t, 3> m_NumTiles = {0, 0, 0};
+  std::array<double, 3> m_Start = {0.0, 0.0, 0.0};
+  std::array<std::array<double, 3>, 3> m_Steps = {};
+
+public:
+  AffineResampler(const AffineResampler&) = delete;            // Copy Constructor Not Implemented
+  AffineResampler(AffineResampler&&) = delete;                 // Move Constructor Not Implemented
+  AffineResampler& operator=(const AffineResampler&) = delete; // Copy Assignment Not Implemented
+  AffineResampler& operator=(AffineResampler&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief Finds the original cell that contains the continuous cell coordinates
+ * @param coords
+ * @param dims
+ * @param index
+ * @return false if the coordinates fall outside of the original image
+ */
+inline bool FindNearestCell(const double coords[3], const SizeVec3Type& dims, size_t& index)
+{
+  size_t cell[3] = {0, 0, 0};
+  for(size_t a = 0; a < 3; a++)
+  {
+    const double nearest = std::floor(coords[a] + 0.5);
+    // Written so that NaN coordinates are rejected as well
+    if(!(nearest >= 0.0 && nearest < static_cast<double>(dims[a])))
+    {
+      return false;
+    }
+    cell[a] = static_cast<size_t>(nearest);
+  }
+  index = (cell[2] * dims[1] + cell[1]) * dims[0] + cell[0];
+  return true;
+}
+
+struct LinearStencil
+{
+  std::array<size_t, 8> Indices = {};
+  std::array<double, 8> Weights = {};
+};
+
+/**
+ * @brief Computes the 8 original cells and trilinear weights that interpolate the continuous cell coordinates.
+ * Coordinates within half a cell of the border clamp onto the edge cells so that both interpolation types
+ * fill the same region of the resampled image.
+ * @param coords
+ * @param dims
+ * @param stencil
+ * @return false if the coordinates fall outside of the original image
+ */
+inline bool ComputeLinearStencil(const double coords[3], const SizeVec3Type& dims, LinearStencil& stencil)
+{
+  size_t lower[3] = {0, 0, 0};
+  size_t upper[3] = {0, 0, 0};
+  double fraction[3] = {0.0, 0.0, 0.0};
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(!(coords[a] >= -0.5 && coords[a] < static_cast<double>(dims[a]) - 0.5))
+    {
+      return false;
+    }
+    const double base = std::floor(coords[a]);
+    fraction[a] = coords[a] - base;
+    const int64_t cell = static_cast<int64_t>(base);
+    lower[a] = static_cast<size_t>(std::max<int64_t>(cell, 0));
+    upper[a] = static_cast<size_t>(std::min<int64_t>(cell + 1, static_cast<int64_t>(dims[a]) - 1));
+  }
+
+  for(size_t corner = 0; corner < 8; corner++)
+  {
+    size_t cell[3] = {0, 0, 0};
+    double weight = 1.0;
+    for(size_t a = 0; a < 3; a++)
+    {
+      const bool useUpper = ((corner >> a) & 1) != 0;
+      cell[a] = useUpper ? upper[a] : lower[a];
+      weight *= useUpper ? fraction[a] : 1.0 - fraction[a];
+    }
+    stencil.Indices[corner] = (cell[2] * dims[1] + cell[1]) * dims[0] + cell[0];
+    stencil.Weights[corner] = weight;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T ConvertInterpolatedValue(double value)
+{
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    return static_cast<T>(value);
+  }
+  else
+  {
+    return static_cast<T>(std::round(value));
+  }
+}
+
+/**
+ * @brief Resamples a DataArray in parallel, one tile of the resampled image per task. Cells that sample outside of
+ * the original image are set to 0. Boolean arrays always use the nearest neighbor.
+ * @param resampler
+ * @param linear
+ * @param source
+ * @param target
+ */
+template <typename T>
+void ResampleDataArray(const AffineResampler& resampler, bool linear, const DataArray<T>& source, DataArray<T>& target)
+{
+  const size_t numComps = static_cast<size_t>(source.getNumberOfComponents());
+  const SizeVec3Type& dims = resampler.getSourceDims();
+  const T* sourcePtr = source.getPointer(0);
+  T* targetPtr = target.getPointer(0);
+  const bool interpolate = linear && !std::is_same_v<T, bool>;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, resampler.getNumberOfTiles());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    auto nearestKernel = [&](size_t targetIndex, const double coords[3]) {
+      T* value = targetPtr + targetIndex * numComps;
+      size_t sourceIndex = 0;
+      if(FindNearestCell(coords, dims, sourceIndex))
+      {
+        std::copy_n(sourcePtr + sourceIndex * numComps, numComps, value);
+      }
+      else
+      {
+        std::fill_n(value, numComps, static_cast<T>(0));
+      }
+    };
+
+    auto linearKernel = [&](size_t targetIndex, const double coords[3]) {
+      T* value = targetPtr + targetIndex * numComps;
+      LinearStencil stencil;
+      if(!ComputeLinearStencil(coords, dims, stencil))
+      {
+        std::fill_n(value, numComps, static_cast<T>(0));
+        return;
+      }
+      for(size_t c = 0; c < numComps; c++)
+      {
+        double sum = 0.0;
+        for(size_t n = 0; n < 8; n++)
+        {
+          sum += stencil.Weights[n] * static_cast<double>(sourcePtr[stencil.Indices[n] * numComps + c]);
+        }
+        value[c] = ConvertInterpolatedValue<T>(sum);
+      }
+    };
+
+    for(size_t tile = range.min(); tile < range.max(); tile++)
+    {
+      if(interpolate)
+      {
+        resampler.visitTile(tile, linearKernel);
+      }
+      else
+      {
+        resampler.visitTile(tile, nearestKernel);
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool ResampleIfDataArrayOfType(const AffineResampler& resampler, bool linear, const IDataArray::Pointer& source, const IDataArray::Pointer& target)
+{
+  typename DataArray<T>::Pointer typedSource = std::dynamic_pointer_cast<DataArray<T>>(source);
+  typename DataArray<T>::Pointer typedTarget = std::dynamic_pointer_cast<DataArray<T>>(target);
+  if(nullptr == typedSource || nullptr == typedTarget)
+  {
+    return false;
+  }
+  ResampleDataArray<T>(resampler, linear, *typedSource, *typedTarget);
+  return true;
+}
+
+/**
+ * @brief Resamples the array if it is a DataArray of one of the primitive types
+ * @return false if the array is of any other kind
+ */
+bool ResamplePrimitiveArray(const AffineResampler& resampler, bool linear, const IDataArray::Pointer& source, const IDataArray::Pointer& target)
+{
+  return ResampleIfDataArrayOfType<float>(resampler, linear, source, target) || ResampleIfDataArrayOfType<double>(resampler, linear, source, target) ||
+         ResampleIfDataArrayOfType<int8_t>(resampler, linear, source, target) || ResampleIfDataArrayOfType<uint8_t>(resampler, linear, source, target) ||
+         ResampleIfDataArrayOfType<int16_t>(resampler, linear, source, target) || ResampleIfDataArrayOfType<uint16_t>(resampler, linear, source, target) ||
+         ResampleIfDataArrayOfType<int32_t>(resampler, linear, source, target) || ResampleIfDataArrayOfType<uint32_t>(resampler, linear, source, target) ||
+         ResampleIfDataArrayOfType<int64_t>(resampler, linear, source, target) || ResampleIfDataArrayOfType<uint64_t>(resampler, linear, source, target) ||
+         ResampleIfDataArrayOfType<bool>(resampler, linear, source, target) || ResampleIfDataArrayOfType<size_t>(resampler, linear, source, target);
+}
+
+/**
+ * @brief Resamples any other kind of array, such as a StringDataArray, with the nearest neighbor through the
+ * IDataArray interface. copyFromArray is not safe to call concurrently for every array type so this runs serially.
+ * @param resampler
+ * @param source
+ * @param target
+ */
+void ResampleGenericArray(const AffineResampler& resampler, const IDataArray::Pointer& source, const IDataArray::Pointer& target)
+{
+  const SizeVec3Type& dims = resampler.getSourceDims();
+  auto copyKernel = [&](size_t targetIndex, const double coords[3]) {
+    size_t sourceIndex = 0;
+    if(FindNearestCell(coords, dims, sourceIndex))
+    {
+      target->copyFromArray(targetIndex, source, sourceIndex, 1);
+    }
+  };
+  for(size_t tile = 0; tile < resampler.getNumberOfTiles(); tile++)
+  {
+    resampler.visitTile(tile, copyKernel);
+  }
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -81,6 +658,10 @@ void ApplyImageTransforms::setupFilterParameters()
         MultiDataContainerSelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
     parameters.push_back(SIMPL_NEW_MDC_SELECTION_FP("Image Data Containers", ImageDataContainers, FilterParameter::Category::RequiredArray, ApplyImageTransforms, req));
   }
+  {
+    std::vector<QString> choices = {"Nearest Neighbor", "Linear"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Interpolation Type", InterpolationType, FilterParameter::Category::Parameter, ApplyImageTransforms, choices, false));
+  }
 
   setFilterParameters(parameters);
 }
@@ -111,6 +692,26 @@ void ApplyImageTransforms::dataCheck()
       return;
     }
   }
+
+  if(getInterpolationType() != static_cast<int>(InterpolationType::NearestNeighbor) && getInterpolationType() != static_cast<int>(InterpolationType::Linear))
+  {
+    QString ss = QObject::tr("The Interpolation Type must be 0 (Nearest Neighbor) or 1 (Linear)");
+    setErrorCondition(-11004, ss);
+    return;
+  }
+
+  // Let the filters further down the pipeline see the resampled geometry
+  if(getInPreflight())
+  {
+    for(const auto& dcName : m_ImageDataContainers)
+    {
+      applyTransform(getDataContainerArray()->getDataContainer(dcName), false);
+      if(getErrorCode() < 0)
+      {
+        return;
+      }
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -125,40 +726,121 @@ void ApplyImageTransforms::execute()
     return;
   }
 
-  int selectedDCCount = getImageDataContainers().size();
-  for(int i = 0; i < selectedDCCount; i++)
+  for(const auto& dcName : m_ImageDataContainers)
   {
-    QString dcName = m_ImageDataContainers[i];
-
-    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcName);
-    ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+    if(getCancel())
+    {
+      return;
+    }
+    applyTransform(getDataContainerArray()->getDataContainer(dcName), true);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+  }
 
-    FloatVec3Type origin = imageGeom->getOrigin();
+  notifyStatusMessage("Complete");
+}
 
-    ::ITransformContainer::Pointer iTransformContainer = imageGeom->getTransformContainer();
-    if(iTransformContainer)
-    {
-      TransformContainer::Pointer transformContainer = std::dynamic_pointer_cast<TransformContainer>(iTransformContainer);
-      if(transformContainer)
-      {
-        TransformContainer::TransformParametersType parameters = transformContainer->getParameters();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ApplyImageTransforms::applyTransform(const DataContainer::Pointer& dc, bool resampleData)
+{
+  ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+  TransformContainer::Pointer transformContainer = std::dynamic_pointer_cast<TransformContainer>(imageGeom->getTransformContainer());
+  if(nullptr == transformContainer)
+  {
+    return;
+  }
 
-        double xTranslation = parameters[9];
-        double yTranslation = parameters[10];
+  AffineTransform transform;
+  if(!CreateAffineTransform(*transformContainer, transform))
+  {
+    QString ss = QObject::tr("The transform '%1' stored in Data Container '%2' is not a 2D or 3D affine or translation transform with %3 parameters")
+                     .arg(QString::fromStdString(transformContainer->getTransformTypeAsString()))
+                     .arg(dc->getName())
+                     .arg(transformContainer->getParameters().size());
+    setErrorCondition(-11002, ss);
+    return;
+  }
+  AffineTransform inverse;
+  if(!transform.invert(inverse))
+  {
+    QString ss = QObject::tr("The transform stored in Data Container '%1' can not be inverted").arg(dc->getName());
+    setErrorCondition(-11003, ss);
+    return;
+  }
 
-        origin[0] = origin[0] - xTranslation;
-        origin[1] = origin[1] - yTranslation;
+  // A pure translation only moves the image, which the origin captures exactly without touching the data
+  if(transform.isTranslation())
+  {
+    FloatVec3Type origin = imageGeom->getOrigin();
+    for(size_t a = 0; a < 3; a++)
+    {
+      origin[a] = static_cast<float>(origin[a] - transform.Offset[a]);
+    }
+    imageGeom->setOrigin(origin);
+    ResetToIdentity(*transformContainer);
+    return;
+  }
 
-        imageGeom->setOrigin(origin);
+  const ResampledGeometry target = ComputeResampledGeometry(*imageGeom, transform, inverse);
+  const AffineResampler resampler(*imageGeom, target, transform);
+  const std::vector<size_t> tDims = {target.Dims[0], target.Dims[1], target.Dims[2]};
+  const size_t numSourceCells = imageGeom->getNumberOfElements();
+  const size_t numTargetCells = tDims[0] * tDims[1] * tDims[2];
+  const bool linear = getInterpolationType() == static_cast<int>(InterpolationType::Linear);
+
+  // The resampled matrices replace the original ones only once every array has been resampled, so a cancel or an
+  // allocation failure leaves the Data Container exactly as it was
+  std::vector<AttributeMatrix::Pointer> targetMatrices;
+  for(const auto& sourceMatrix : dc->getAttributeMatrices())
+  {
+    if(sourceMatrix->getType() != AttributeMatrix::Type::Cell || sourceMatrix->getNumberOfTuples() != numSourceCells)
+    {
+      continue;
+    }
+    if(!resampleData)
+    {
+      sourceMatrix->setTupleDimensions(tDims);
+      continue;
+    }
 
-        parameters[9] = 0;
-        parameters[10] = 0;
-        transformContainer->setParameters(parameters);
+    AttributeMatrix::Pointer targetMatrix = AttributeMatrix::New(tDims, sourceMatrix->getName(), AttributeMatrix::Type::Cell);
+    for(const auto& arrayName : sourceMatrix->getAttributeArrayNames())
+    {
+      if(getCancel())
+      {
+        return;
       }
+      notifyStatusMessage(QString("Resampling DataArray '%1'").arg(arrayName));
+      IDataArray::Pointer sourceArray = sourceMatrix->getAttributeArray(arrayName);
+      IDataArray::Pointer targetArray = sourceArray->createNewArray(numTargetCells, sourceArray->getComponentDimensions(), arrayName, true);
+      if(nullptr == targetArray || (numTargetCells > 0 && !targetArray->isAllocated()))
+      {
+        QString ss = QObject::tr("Unable to allocate the resampled DataArray '%1' with %2 tuples").arg(arrayName).arg(numTargetCells);
+        setErrorCondition(-11005, ss);
+        return;
+      }
+      if(!ResamplePrimitiveArray(resampler, linear, sourceArray, targetArray))
+      {
+        ResampleGenericArray(resampler, sourceArray, targetArray);
+      }
+      targetMatrix->addOrReplaceAttributeArray(targetArray);
     }
+    targetMatrices.push_back(targetMatrix);
   }
 
-  notifyStatusMessage("Complete");
+  for(const auto& targetMatrix : targetMatrices)
+  {
+    dc->addOrReplaceAttributeMatrix(targetMatrix);
+  }
+
+  imageGeom->setDimensions(target.Dims);
+  imageGeom->setSpacing(target.Spacing);
+  imageGeom->setOrigin(target.Origin);
+  ResetToIdentity(*transformContainer);
 }
 
 // -----------------------------------------------------------------------------
@@ -273,3 +955,15 @@ std::vector<QString> ApplyImageTransforms::getImageDataContainers() const
 {
   return m_ImageDataContainers;
 }
+
+// -----------------------------------------------------------------------------
+void ApplyImageTransforms::setInterpolationType(int value)
+{
+  m_InterpolationType = value;
+}
+
+// -----------------------------------------------------------------------------
+int ApplyImageTransforms::getInterpolationType() const
+{
+  return m_InterpolationType;
+}
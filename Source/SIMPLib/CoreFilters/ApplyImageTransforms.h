@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 /**
@@ -68,6 +69,12 @@ public:
 
   ~ApplyImageTransforms() override;
 
+  enum class InterpolationType : int
+  {
+    NearestNeighbor = 0,
+    Linear = 1
+  };
+
   /**
    * @brief Setter property for ImageDataContainers
    */
@@ -80,6 +87,18 @@ public:
 
   Q_PROPERTY(QStringVec ImageDataContainers READ getImageDataContainers WRITE setImageDataContainers)
 
+  /**
+   * @brief Setter property for InterpolationType
+   */
+  void setInterpolationType(int value);
+  /**
+   * @brief Getter property for InterpolationType
+   * @return Value of InterpolationType
+   */
+  int getInterpolationType() const;
+
+  Q_PROPERTY(int InterpolationType READ getInterpolationType WRITE setInterpolationType)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -148,8 +167,17 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief Resamples every cell array of the Data Container so that its Image Geometry no
+   * longer needs the stored transform, then resets that transform to the identity.
+   * @param dc
+   * @param resampleData When false only the geometry and tuple dimensions are updated (preflight)
+   */
+  void applyTransform(const DataContainer::Pointer& dc, bool resampleData);
+
 private:
   std::vector<QString> m_ImageDataContainers = {};
+  int m_InterpolationType = {0};
 
 public:
   /* Rule of 5: All special member functions should be defined if any are defined.
@@ -53,6 +53,7 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorProgram.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -287,7 +288,7 @@ void ArrayCalculator::dataCheck()
       ICalculatorArray::Pointer array1 = std::dynamic_pointer_cast<ICalculatorArray>(item1);
       if(item1->isArray())
       {
-        if(!cDims.empty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getArray()->getComponentDimensions())
+        if(!cDims.empty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getComponentDimensions())
         {
           QString ss = QObject::tr("Attribute Array symbols in the infix expression have mismatching component dimensions");
           setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INCONSISTENT_COMP_DIMS), ss);
@@ -295,12 +296,12 @@ void ArrayCalculator::dataCheck()
         }
 
         resultType = ICalculatorArray::ValueType::Array;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
       else if(resultType == ICalculatorArray::ValueType::Unknown)
       {
         resultType = ICalculatorArray::ValueType::Number;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
     }
   }
@@ -410,6 +411,22 @@ void ArrayCalculator::execute()
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
 
+  // Evaluate the whole expression in one pass over the tuples if it can be compiled
+  CalculatorProgram::Pointer program = CalculatorProgram::Compile(rpn, m_Units == Degrees);
+  if(nullptr != program)
+  {
+    notifyStatusMessage("Computing " + QString::number(rpn.size()) + " items in a single pass");
+    IDataArray::Pointer resultTypeArray = program->execute(m_ScalarType, m_CalculatedArray.getDataArrayName());
+    if(nullptr == resultTypeArray)
+    {
+      QString ss = QObject::tr("Unable to allocate the output array for the chosen infix expression");
+      setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::OutputAllocationError), ss);
+      return;
+    }
+    insertCalculatedArray(resultTypeArray);
+    return;
+  }
+
   // Execute the RPN expression
   int totalItems = rpn.size();
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
@@ -459,19 +476,7 @@ void ArrayCalculator::execute()
     IDataArray::Pointer resultArray = arrayItem->getArray();
 
     IDataArray::Pointer resultTypeArray = convertArrayType(resultArray, m_ScalarType);
-
-    DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
-    AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
-    if(nullptr != createdAM)
-    {
-      resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
-      if(!createdAM->insertOrAssign(resultTypeArray))
-      {
-        QString ss = QObject::tr("Error inserting Output Array into Attribute Matrix");
-        setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::AttributeMatrixInsertionError), ss);
-        return;
-      }
-    }
+    insertCalculatedArray(resultTypeArray);
   }
   else
   {
@@ -482,6 +487,24 @@ void ArrayCalculator::execute()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayCalculator::insertCalculatedArray(const IDataArrayShPtrType& resultTypeArray)
+{
+  DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
+  AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
+  if(nullptr != createdAM)
+  {
+    resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
+    if(!createdAM->insertOrAssign(resultTypeArray))
+    {
+      QString ss = QObject::tr("Error inserting Output Array into Attribute Matrix");
+      setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::AttributeMatrixInsertionError), ss);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -844,18 +867,17 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
   }
 
   ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(parsedInfix.back());
-  if(nullptr != calcArray && index >= calcArray->getArray()->getNumberOfComponents())
+  // Select the component without converting the array to double; this only happens if the operators need the values
+  ICalculatorArray::Pointer itemPtr = (nullptr != calcArray) ? calcArray->selectComponent(index, !getInPreflight()) : ICalculatorArray::NullPointer();
+  if(nullptr == itemPtr)
   {
-    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getArray()->getName());
+    QString arrayName = (nullptr != calcArray) ? calcArray->getSourceArray()->getName() : token;
+    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(arrayName);
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::COMPONENT_OUT_OF_RANGE), ss);
     return false;
   }
 
   parsedInfix.pop_back();
-
-  DoubleArrayType::Pointer reducedArray = calcArray->reduceToOneComponent(index, !getInPreflight());
-
-  CalculatorItem::Pointer itemPtr = createCalculatorArray(this, reducedArray);
   parsedInfix.push_back(itemPtr);
 
   QString ss = QObject::tr("Item '%1' in the infix expression is the name of an array in the selected Attribute Matrix, but it is currently being used as an indexing operator").arg(token);
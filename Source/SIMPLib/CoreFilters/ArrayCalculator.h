@@ -253,6 +253,12 @@ protected:
    */
   IDataArrayShPtrType convertArrayType(const IDataArrayShPtrType& inputArray, SIMPL::ScalarTypes::Type scalarType);
 
+  /**
+   * @brief Inserts the calculated array into the output Attribute Matrix
+   * @param resultTypeArray
+   */
+  void insertCalculatedArray(const IDataArrayShPtrType& resultTypeArray);
+
 private:
   DataArrayPath m_SelectedAttributeMatrix = {"", "", ""};
   QString m_InfixEquation = {QString()};
@@ -45,6 +45,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/FeatureDataTransfer.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -142,44 +143,6 @@ void CopyFeatureArrayToElementArray::dataCheck()
   TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, m_InArrayPtr.lock()->getComponentDimensions(), m_InArrayPtr.lock(), ElementArrayID);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-IDataArray::Pointer copyData(IDataArray::Pointer inputData, size_t totalPoints, int32_t* featureIds)
-{
-  QString cellArrayName = inputData->getName();
-
-  typename DataArray<T>::Pointer feature = std::dynamic_pointer_cast<DataArray<T>>(inputData);
-  if(nullptr == feature)
-  {
-    return IDataArray::NullPointer();
-  }
-
-  std::vector<size_t> cDims = inputData->getComponentDimensions();
-  typename DataArray<T>::Pointer cell = DataArray<T>::CreateArray(totalPoints, cDims, cellArrayName, true);
-
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
-  size_t numComp = static_cast<size_t>(feature->getNumberOfComponents());
-  int32_t featureIdx = 0;
-
-  for(size_t i = 0; i < totalPoints; ++i)
-  {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-    // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
-    T* fSourcePtr = fPtr + (numComp * featureIdx);
-    // Now get the pointer to the start of the tuple for the Cell Array at the proper index
-    T* cDestPtr = cPtr + (numComp * i);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
-  }
-  return cell;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -195,24 +158,10 @@ void CopyFeatureArrayToElementArray::execute()
   // Feature Id; the filter would crash otherwise, but the user should
   // be notified of unanticipated behavior. this cannot be done in the dataCheck since
   // we don't have access to the data yet
-  int32_t numFeatures = static_cast<int32_t>(m_InArrayPtr.lock()->getNumberOfTuples());
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
-  }
-
-  if(mismatchedFeatures)
+  IDataArray::Pointer inArray = m_InArrayPtr.lock();
+  int32_t numFeatures = static_cast<int32_t>(inArray->getNumberOfTuples());
+  int32_t largestFeature = FeatureDataTransfer::FindMaxFeatureId(*m_FeatureIdsPtr.lock());
+  if(largestFeature >= numFeatures)
   {
     QString ss = QObject::tr("The given FeatureIds Array %1 has a value that is larger than allowed by the given Feature Attribute Matrix %2.\n %3 >= %4")
                      .arg(m_FeatureIdsArrayPath.serialize("/"))
@@ -223,64 +172,17 @@ void CopyFeatureArrayToElementArray::execute()
     return;
   }
 
-  IDataArray::Pointer p = IDataArray::NullPointer();
-
-  if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<int8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<uint8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<int16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<uint16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<int32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<uint32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<int64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<uint64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<float>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<double>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyData<bool>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
-  }
-  else
+  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+  IDataArray::Pointer p = inArray->createNewArray(totalPoints, inArray->getComponentDimensions(), getCreatedArrayName(), true);
+  if(!FeatureDataTransfer::CopyFeatureToElement(*m_FeatureIdsPtr.lock(), {inArray}, {p}))
   {
     QString ss = QObject::tr("The selected array was of unsupported type. The path is %1").arg(m_SelectedFeatureArrayPath.serialize());
     setErrorCondition(-14000, ss);
+    return;
   }
 
-  if(p.get() != nullptr)
-  {
-    p->setName(getCreatedArrayName());
-    AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(getFeatureIdsArrayPath());
-    am->insertOrAssign(p);
-  }
+  AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(getFeatureIdsArrayPath());
+  am->insertOrAssign(p);
 }
 
 // -----------------------------------------------------------------------------
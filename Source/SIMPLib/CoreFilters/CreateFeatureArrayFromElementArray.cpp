@@ -46,6 +46,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/FeatureDataTransfer.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -142,70 +143,6 @@ void CreateFeatureArrayFromElementArray::dataCheck()
   TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, m_InArrayPtr.lock()->getComponentDimensions(), m_InArrayPtr.lock(), FeatureArrayID);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, int32_t* featureIds, const QString& createdArrayName)
-{
-  QString featureArrayName = inputData->getName();
-
-  typename DataArray<T>::Pointer cell = std::dynamic_pointer_cast<DataArray<T>>(inputData);
-  if(nullptr == cell)
-  {
-    return IDataArray::NullPointer();
-  }
-
-  std::vector<size_t> dims = inputData->getComponentDimensions();
-  typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName, true);
-
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
-  size_t numComp = static_cast<size_t>(cell->getNumberOfComponents());
-  int32_t featureIdx = 0;
-
-  size_t cells = inputData->getNumberOfTuples();
-
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
-
-  for(size_t i = 0; i < cells; ++i)
-  {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
-
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
-    {
-      featureMap.insert(featureIdx, cSourcePtr);
-    }
-
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
-    {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
-      {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->setWarningCondition(-1000, ss);
-        warningThrown = true;
-      }
-    }
-
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
-  }
-  return feature;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -224,23 +161,9 @@ void CreateFeatureArrayFromElementArray::execute()
   // be notified of unanticipated behavior. this cannot be done in the dataCheck since
   // we don't have access to the data yet
   int32_t numFeatures = getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->getNumberOfTuples();
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
-  }
+  int32_t largestFeature = FeatureDataTransfer::FindMaxFeatureId(*m_FeatureIdsPtr.lock());
 
-  if(mismatchedFeatures)
+  if(largestFeature >= numFeatures)
   {
     QString ss = QObject::tr("Attribute Matrix %1 has %2 tuples but the input array %3 has a Feature ID value of at least %4")
                      .arg(m_CellFeatureAttributeMatrixName.serialize("/"))
@@ -251,63 +174,24 @@ void CreateFeatureArrayFromElementArray::execute()
     return;
   }
 
-
-  IDataArray::Pointer p = IDataArray::NullPointer();
-
-  if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<float>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<double>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
-  {
-    p = copyCellData<bool>(this, m_InArrayPtr.lock(), numFeatures, m_FeatureIds, getCreatedArrayName());
-  }
-  else
+  IDataArray::Pointer inArray = m_InArrayPtr.lock();
+  IDataArray::Pointer p = inArray->createNewArray(static_cast<size_t>(numFeatures), inArray->getComponentDimensions(), getCreatedArrayName(), true);
+  std::vector<int32_t> inconsistentFeatureIds;
+  if(!FeatureDataTransfer::CopyElementToFeature(*m_FeatureIdsPtr.lock(), {inArray}, {p}, inconsistentFeatureIds))
   {
     QString ss = QObject::tr("The selected array was of unsupported type. The path is %1").arg(m_SelectedCellArrayPath.serialize());
     setErrorCondition(-14000, ss);
+    return;
   }
 
-  if(p.get() != nullptr)
+  if(inconsistentFeatureIds[0] >= 0)
   {
-    getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->insertOrAssign(p);
+    // The values are inconsistent with the first values for this feature id, so throw a warning
+    QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(inconsistentFeatureIds[0]);
+    setWarningCondition(-1000, ss);
   }
+
+  getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->insertOrAssign(p);
 }
 
 // -----------------------------------------------------------------------------
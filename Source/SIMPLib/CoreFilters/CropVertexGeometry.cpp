@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "CropVertexGeometry.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include <QtCore/QTextStream>
@@ -49,6 +50,8 @@
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -196,26 +199,23 @@ void CropVertexGeometry::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t>& croppedPoints)
+void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, const std::vector<size_t>& croppedPoints)
 {
   typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
-  T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
+  const T* inputData = inputDataPtr->getPointer(0);
   typename DataArray<T>::Pointer croppedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
-  T* croppedData = static_cast<T*>(croppedDataPtr->getPointer(0));
+  T* croppedData = croppedDataPtr->getPointer(0);
 
   size_t nComps = inDataPtr->getNumberOfComponents();
-  size_t tmpIndex = 0;
-  size_t ptrIndex = 0;
 
-  for(std::vector<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    for(size_t d = 0; d < nComps; d++)
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, croppedPoints.size());
+  dataAlg.execute([=, &croppedPoints](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
     {
-      tmpIndex = nComps * i + d;
-      ptrIndex = nComps * croppedPoints[i] + d;
-      croppedData[tmpIndex] = inputData[ptrIndex];
+      std::copy_n(inputData + nComps * croppedPoints[i], nComps, croppedData + nComps * i);
     }
-  }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -231,40 +231,31 @@ void CropVertexGeometry::execute()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getCroppedDataContainerName());
-  VertexGeom::Pointer vertices = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<VertexGeom>();
-  int64_t numVerts = vertices->getNumberOfVertices();
-  float* allVerts = vertices->getVertexPointer(0);
-  std::vector<int64_t> croppedPoints;
-  croppedPoints.reserve(numVerts);
+  VertexGeom::Pointer vertices = m->getGeometryAs<VertexGeom>();
 
-  for(int64_t i = 0; i < numVerts; i++)
+  // A single box query: one parallel scan of the vertices is cheaper than building a spatial index for it
+  float boxMin[3] = {m_XMin, m_YMin, m_ZMin};
+  float boxMax[3] = {m_XMax, m_YMax, m_ZMax};
+  std::vector<size_t> croppedPoints = VertexSpatialIndex::FindInBox(vertices->getVertices(), boxMin, boxMax);
+
+  if(getCancel())
   {
-    if(getCancel())
-    {
-      return;
-    }
-    if(allVerts[3 * i + 0] >= m_XMin && allVerts[3 * i + 0] <= m_XMax && allVerts[3 * i + 1] >= m_YMin && allVerts[3 * i + 1] <= m_YMax && allVerts[3 * i + 2] >= m_ZMin &&
-       allVerts[3 * i + 2] <= m_ZMax)
-    {
-      croppedPoints.push_back(i);
-    }
+    return;
   }
 
-  croppedPoints.shrink_to_fit();
-
   VertexGeom::Pointer crop = dc->getGeometryAs<VertexGeom>();
   crop->resizeVertexList(croppedPoints.size());
-  float coords[3] = {0.0f, 0.0f, 0.0f};
+  const float* allVerts = vertices->getVertexPointer(0);
+  float* croppedVerts = crop->getVertexPointer(0);
 
-  for(std::list<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
-  {
-    if(getCancel())
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, croppedPoints.size());
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
     {
-      return;
+      std::copy_n(allVerts + 3 * croppedPoints[i], 3, croppedVerts + 3 * i);
     }
-    vertices->getCoords(croppedPoints[i], coords);
-    crop->setCoords(i, coords);
-  }
+  });
 
   std::vector<size_t> tDims(1, croppedPoints.size());
 
@@ -283,6 +274,10 @@ void CropVertexGeometry::execute()
 
         for(auto&& data_array : srcDataArrays)
         {
+          if(getCancel())
+          {
+            return;
+          }
           IDataArray::Pointer src = srcAttrMat->getAttributeArray(data_array);
           IDataArray::Pointer dest = tmpAttrMat->getAttributeArray(data_array);
 
@@ -54,9 +54,11 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Montages/MontageSupport.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
+#include "SIMPLib/Utilities/SIMPLH5StructureCache.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -79,6 +81,7 @@ void DataContainerReader::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_BOOL_FP("Overwrite Existing Data Containers", OverwriteExistingDataContainers, FilterParameter::Category::Parameter, DataContainerReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Load Arrays On Demand", LoadArraysOnDemand, FilterParameter::Category::Parameter, DataContainerReader));
   {
     DataContainerReaderFilterParameter::Pointer parameter = DataContainerReaderFilterParameter::New();
     parameter->setHumanLabel("Select Arrays from Input File");
@@ -103,6 +106,7 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setLoadArraysOnDemand(reader->readValue("LoadArraysOnDemand", getLoadArraysOnDemand()));
   reader->closeFilterGroup();
 }
 
@@ -255,23 +259,26 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::New();
   }
 
+  // Arrays read on demand only keep the location of their values and read them the first time they are used
+  H5ScopedLoadOnDemand scopedLoadOnDemand(getLoadArraysOnDemand() && !getInPreflight());
   DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
   if(dca == DataContainerArray::NullPointer())
   {
     return DataContainerArray::New();
   }
 
-  hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
-  if(fileId < 0)
-  {
-    QString ss = QObject::tr("Error opening input file '%1'").arg(getInputFile());
-    setErrorCondition(-150, ss);
-    return DataContainerArray::NullPointer();
-  }
-  H5ScopedFileSentinel sentinel(fileId, true);
-
+  // The pipeline stored in the file is only needed when the data is read so a preflight does not open the file again
   if(!getInPreflight())
   {
+    hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
+    if(fileId < 0)
+    {
+      QString ss = QObject::tr("Error opening input file '%1'").arg(getInputFile());
+      setErrorCondition(-150, ss);
+      return DataContainerArray::NullPointer();
+    }
+    H5ScopedFileSentinel sentinel(fileId, true);
+
     int32_t err = readExistingPipelineFromFile(fileId);
     if(err < 0)
     {
@@ -289,6 +296,13 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
 // -----------------------------------------------------------------------------
 DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(const DataContainerArray::Pointer& dca)
 {
+  // Most files do not have any montages. Once that is known the file does not need to be opened again.
+  bool hasMontages = true;
+  if(SIMPLH5StructureCache::FindHasMontages(getInputFile(), hasMontages) && !hasMontages)
+  {
+    return DataContainerArray::MontageCollection();
+  }
+
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
   if(fileId < 0)
   {
@@ -298,6 +312,13 @@ DataContainerArray::MontageCollection DataContainerReader::readMontageGroup(cons
   }
   H5ScopedFileSentinel sentinel(fileId, true);
 
+  hasMontages = (H5Lexists(fileId, SIMPL::StringConstants::MontageGroupName.toLatin1().constData(), H5P_DEFAULT) > 0);
+  SIMPLH5StructureCache::InsertHasMontages(getInputFile(), hasMontages);
+  if(!hasMontages)
+  {
+    return DataContainerArray::MontageCollection();
+  }
+
   hid_t groupId = QH5Utilities::openHDF5Object(fileId, SIMPL::StringConstants::MontageGroupName);
   sentinel.addGroupId(groupId);
   int err = 0;
@@ -611,6 +632,18 @@ bool DataContainerReader::getOverwriteExistingDataContainers() const
   return m_OverwriteExistingDataContainers;
 }
 
+// -----------------------------------------------------------------------------
+void DataContainerReader::setLoadArraysOnDemand(bool value)
+{
+  m_LoadArraysOnDemand = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerReader::getLoadArraysOnDemand() const
+{
+  return m_LoadArraysOnDemand;
+}
+
 // -----------------------------------------------------------------------------
 void DataContainerReader::setLastFileRead(const QString& value)
 {
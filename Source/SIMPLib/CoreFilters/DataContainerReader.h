@@ -66,6 +66,7 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
   PYB11_FILTER_NEW_MACRO(DataContainerReader)
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
   PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
+  PYB11_PROPERTY(bool LoadArraysOnDemand READ getLoadArraysOnDemand WRITE setLoadArraysOnDemand)
   PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
   PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
   PYB11_END_BINDINGS()
@@ -116,6 +117,18 @@ public:
 
   Q_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
 
+  /**
+   * @brief Setter property for LoadArraysOnDemand
+   */
+  void setLoadArraysOnDemand(bool value);
+  /**
+   * @brief Getter property for LoadArraysOnDemand
+   * @return Value of LoadArraysOnDemand
+   */
+  bool getLoadArraysOnDemand() const;
+
+  Q_PROPERTY(bool LoadArraysOnDemand READ getLoadArraysOnDemand WRITE setLoadArraysOnDemand)
+
   /**
    * @brief Setter property for LastFileRead
    */
@@ -295,6 +308,7 @@ protected Q_SLOTS:
 private:
   QString m_InputFile = {""};
   bool m_OverwriteExistingDataContainers = {false};
+  bool m_LoadArraysOnDemand = {false};
   QString m_LastFileRead = {""};
   QDateTime m_LastRead = {QDateTime::currentDateTime()};
   DataContainerArrayProxy m_InputFileDataContainerArrayProxy = {};
@@ -52,8 +52,13 @@ using namespace H5Support;
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/HDF5/H5DeferredDataSource.h"
+#include "SIMPLib/HDF5/H5StorageOptions.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/SIMPLH5StructureCache.h"
 
 #ifdef _WIN32
 extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
@@ -79,6 +84,11 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Category::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Category::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Category::Parameter, DataContainerWriter));
+  {
+    std::vector<QString> linkedProps = {"CompressionLevel"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Chunked/Compressed Storage", UseChunkedStorage, FilterParameter::Category::Parameter, DataContainerWriter, linkedProps));
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (0-9)", CompressionLevel, FilterParameter::Category::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -91,6 +101,8 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setUseChunkedStorage(reader->readValue("UseChunkedStorage", getUseChunkedStorage()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
   reader->closeFilterGroup();
 }
 
@@ -116,6 +128,12 @@ void DataContainerWriter::dataCheck()
     m_OutputFile.append(".dream3d");
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
+
+  if(m_UseChunkedStorage && (m_CompressionLevel < 0 || m_CompressionLevel > 9))
+  {
+    QString ss = QObject::tr("The compression level must be between 0 (no compression) and 9 (best compression). The current value is %1").arg(m_CompressionLevel);
+    setErrorCondition(-11114, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -141,6 +159,16 @@ void DataContainerWriter::execute()
     return;
   }
 
+  // Arrays that were loaded on demand from the output file must read their values before the file is rewritten
+  if(!H5DeferredDataSource::DetachFromFile(m_OutputFile))
+  {
+    QString ss = QObject::tr("Arrays that are loaded on demand from '%1' could not be read before the file is overwritten").arg(m_OutputFile);
+    setErrorCondition(-11115, ss);
+    return;
+  }
+  // Preflights must not see the structure of the previous file contents
+  SIMPLH5StructureCache::Invalidate(m_OutputFile);
+
   hid_t fileId = -1;
 
   // Try to open a file to append data into
@@ -165,6 +193,10 @@ void DataContainerWriter::execute()
   // This will make sure if we return early from this method that the HDF5 File is properly closed.
   H5ScopedFileSentinel scopedFileSentinel(fileId, true);
 
+  // Arrays that do not carry their own storage options are written with the layout selected for this filter
+  H5StorageOptions storageOptions = m_UseChunkedStorage ? H5StorageOptions::Chunked(m_CompressionLevel, m_CompressionLevel > 0) : H5StorageOptions::Contiguous();
+  H5ScopedStorageOptions scopedStorageOptions(storageOptions);
+
   // Write our File Version string to the Root "/" group
   QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
   QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
@@ -570,3 +602,27 @@ bool DataContainerWriter::getAppendToExisting() const
 {
   return m_AppendToExisting;
 }
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setUseChunkedStorage(bool value)
+{
+  m_UseChunkedStorage = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getUseChunkedStorage() const
+{
+  return m_UseChunkedStorage;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setCompressionLevel(int value)
+{
+  m_CompressionLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int DataContainerWriter::getCompressionLevel() const
+{
+  return m_CompressionLevel;
+}
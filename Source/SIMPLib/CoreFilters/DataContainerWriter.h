@@ -61,6 +61,8 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
   PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
   PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
   PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+  PYB11_PROPERTY(bool UseChunkedStorage READ getUseChunkedStorage WRITE setUseChunkedStorage)
+  PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -131,6 +133,28 @@ public:
 
   Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+  /**
+   * @brief Setter property for UseChunkedStorage
+   */
+  void setUseChunkedStorage(bool value);
+  /**
+   * @brief Getter property for UseChunkedStorage
+   * @return Value of UseChunkedStorage
+   */
+  bool getUseChunkedStorage() const;
+  Q_PROPERTY(bool UseChunkedStorage READ getUseChunkedStorage WRITE setUseChunkedStorage)
+
+  /**
+   * @brief Setter property for CompressionLevel
+   */
+  void setCompressionLevel(int value);
+  /**
+   * @brief Getter property for CompressionLevel
+   * @return Value of CompressionLevel
+   */
+  int getCompressionLevel() const;
+  Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
   /**
    * @brief Setter property for AppendToExisting
    */
@@ -251,6 +275,8 @@ private:
   bool m_WriteXdmfFile = {true};
   bool m_WriteTimeSeries = {false};
   bool m_AppendToExisting = {false};
+  bool m_UseChunkedStorage = {false};
+  int m_CompressionLevel = {5};
 
 public:
   DataContainerWriter(const DataContainerWriter&) = delete;            // Copy Constructor Not Implemented
@@ -47,38 +47,13 @@
 #include "SIMPLib/FilterParameters/ScalarTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdPredicate.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
   ThresholdArrayID = 1
 };
 
-namespace Detail
-{
-template <typename T>
-void initializeDestinationArray(const BoolArrayType& thresholdArray, IDataArray::Pointer iDestinationArray)
-{
-  typename DataArray<T>::Pointer destinationArray = std::dynamic_pointer_cast<DataArray<T>>(iDestinationArray);
-  size_t thresholdSize = thresholdArray.getNumberOfTuples();
-  bool* threshold = thresholdArray.getPointer(0);
-  T* dest = destinationArray->getPointer(0);
-  for(int64_t p = 0; p < thresholdSize; p++)
-  {
-    if constexpr(std::is_same<T, bool>::value)
-    {
-      // Boolean case
-      dest[p] = threshold[p];
-    }
-    else
-    {
-      // Non-boolean case
-      dest[p] = (threshold[p] ? static_cast<T>(1) : static_cast<T>(0));
-    }
-  }
-}
-} // namespace Detail
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -227,254 +202,22 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  bool invert = m_SelectedThresholds.shouldInvert();
-
-  int64_t thresholdSize;
-  BoolArrayType::Pointer thresholdArray;
-
-  createBoolArray(thresholdSize, thresholdArray);
-  bool firstValueFound = false;
-
-  int32_t err = 0;
-
-  // Loop on the remaining Comparison objects updating our final result array as we go
-  for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
-  {
-    if(std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
-    {
-      ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-      thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-    {
-      ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-      thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-  }
-
-  if(invert)
-  {
-    invertThreshold(thresholdSize, thresholdArray);
-  }
-
-  switch(m_ScalarType)
-  {
-  case SIMPL::ScalarTypes::Type::Int8:
-    Detail::initializeDestinationArray<int8_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::Int16:
-    Detail::initializeDestinationArray<int16_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::Int32:
-    Detail::initializeDestinationArray<int32_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::Int64:
-    Detail::initializeDestinationArray<int64_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::UInt8:
-    Detail::initializeDestinationArray<uint8_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::UInt16:
-    Detail::initializeDestinationArray<uint16_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::UInt32:
-    Detail::initializeDestinationArray<uint32_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::UInt64:
-    Detail::initializeDestinationArray<uint64_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::Float:
-    Detail::initializeDestinationArray<float>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::Double:
-    Detail::initializeDestinationArray<double>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::Bool:
-    Detail::initializeDestinationArray<bool>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  case SIMPL::ScalarTypes::Type::SizeT:
-    Detail::initializeDestinationArray<size_t>(*thresholdArray, m_DestinationPtr.lock());
-    break;
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if(SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonSet)
-  {
-    return;
-  }
-
-  if(inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for(int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if(std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    {
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if(std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
-    if(err < 0)
-    {
-      return;
-    }
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(setArraySize, setThresholdArray);
-    }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonValue)
-  {
-    return;
-  }
-
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  // bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()), currentArrayPtr.get());
-  if(err < 0)
+  // Compile the whole comparison tree into one predicate that is evaluated in a single pass over the tuples
+  QString invalidArrayName;
+  ThresholdPredicate::Pointer predicate = ThresholdPredicate::Compile(m_SelectedThresholds, m->getAttributeMatrix(amName), invalidArrayName);
+  if(nullptr == predicate)
   {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+    DataArrayPath tempPath(dcName, amName, invalidArrayName);
     QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
     setErrorCondition(-13002, ss);
     return;
   }
 
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else
+  if(!predicate->evaluate(m_DestinationPtr.lock()))
   {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
+    DataArrayPath tempPath(dcName, amName, getDestinationArrayName());
+    QString ss = QObject::tr("Error writing the threshold results into the destination array. The path is %1").arg(tempPath.serialize());
+    setErrorCondition(-13003, ss);
   }
 }
 
@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <future>
 
 #include <QtCore/QTextStream>
 
@@ -47,6 +48,7 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
@@ -84,6 +86,9 @@ constexpr int32_t RBR_DA_ERROR = -1050;
 constexpr int32_t RBR_COMPONENT_ERROR = -1060;
 constexpr int32_t RBR_DA_NULL = -1070;
 
+// Size of the blocks that are read while the previous block is byte swapped
+constexpr size_t k_StreamBlockBytes = 16 * SIMPL::DEFAULT_BLOCKSIZE;
+
 // -----------------------------------------------------------------------------
 int32_t SanityCheckFileSizeVersusAllocatedSize(size_t allocatedBytes, size_t fileSize, size_t skipHeaderBytes)
 {
@@ -99,9 +104,27 @@ int32_t SanityCheckFileSizeVersusAllocatedSize(size_t allocatedBytes, size_t fil
   return 0;
 }
 
+// -----------------------------------------------------------------------------
+// Reads numBytes from the current position of f into buffer. Returns false if the end of the file is reached first.
+bool ReadBlock(FILE* f, std::byte* buffer, size_t numBytes)
+{
+  size_t master_counter = 0;
+  while(master_counter < numBytes)
+  {
+    size_t chunkSize = std::min(numBytes - master_counter, SIMPL::DEFAULT_BLOCKSIZE);
+    size_t bytes_read = std::fread(buffer + master_counter, sizeof(std::byte), chunkSize, f);
+    if(bytes_read == 0)
+    {
+      return false;
+    }
+    master_counter += bytes_read;
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
-int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, uint64_t skipHeaderBytes, int32_t endian)
+int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, uint64_t skipHeaderBytes, int32_t endian, bool memoryMapFile)
 {
   auto dataArray = dynamic_cast<DataArray<T>*>(dataArrayPtr);
 
@@ -111,7 +134,8 @@ int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, ui
   }
 
   const size_t fileSize = fs::file_size(filename);
-  const size_t numBytesToRead = dataArray->getSize() * sizeof(T);
+  const size_t numElements = dataArray->getSize();
+  const size_t numBytesToRead = numElements * sizeof(T);
   int32_t err = SanityCheckFileSizeVersusAllocatedSize(numBytesToRead, fileSize, skipHeaderBytes);
 
   if(err < 0)
@@ -119,6 +143,15 @@ int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, ui
     return RBR_FILE_TOO_SMALL;
   }
 
+  const bool swapBytes = (endian == k_EndianCheck) && sizeof(T) > 1;
+
+  // Values that need no conversion can be used straight from the file. If the mapping is not possible
+  // (e.g. the header size breaks the alignment of T) the file is read as usual.
+  if(memoryMapFile && !swapBytes && dataArray->mapFromFile(QString::fromStdString(filename), skipHeaderBytes))
+  {
+    return RBR_NO_ERROR;
+  }
+
   FILE* f = std::fopen(filename.c_str(), "rb");
   if(f == nullptr)
   {
@@ -133,29 +166,37 @@ int32_t readBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, ui
     FSEEK(f, skipHeaderBytes, SEEK_SET);
   }
 
-  std::byte* chunkptr = reinterpret_cast<std::byte*>(dataArray->data());
+  std::byte* dataPtr = reinterpret_cast<std::byte*>(dataArray->data());
 
-  // Now start reading the data in chunks if needed.
-  size_t chunkSize = std::min(numBytesToRead, SIMPL::DEFAULT_BLOCKSIZE);
+  if(!swapBytes)
+  {
+    return ReadBlock(f, dataPtr, numBytesToRead) ? RBR_NO_ERROR : RBR_READ_EOF;
+  }
 
-  size_t master_counter = 0;
-  while(master_counter < numBytesToRead)
+  // The file is read in blocks straight into the array. While the next block is read on a separate
+  // thread the previous block is byte swapped in parallel, so the swap is hidden behind the disk.
+  const size_t blockElements = std::max(k_StreamBlockBytes / sizeof(T), static_cast<size_t>(1));
+  size_t blockStart = 0;
+  size_t blockCount = std::min(blockElements, numElements);
+  if(!ReadBlock(f, dataPtr, blockCount * sizeof(T)))
   {
-    size_t bytes_read = std::fread(chunkptr, sizeof(std::byte), chunkSize, f);
-    chunkptr += bytes_read;
-    master_counter += bytes_read;
+    return RBR_READ_EOF;
+  }
+
+  while(blockCount > 0)
+  {
+    const size_t nextStart = blockStart + blockCount;
+    const size_t nextCount = std::min(blockElements, numElements - nextStart);
+    std::future<bool> nextBlock = std::async(std::launch::async, ReadBlock, f, dataPtr + nextStart * sizeof(T), nextCount * sizeof(T));
 
-    size_t bytesLeft = numBytesToRead - master_counter;
+    dataArray->byteSwapElements(blockStart, blockCount);
 
-    if(bytesLeft < chunkSize)
+    if(!nextBlock.get())
     {
-      chunkSize = bytesLeft;
+      return RBR_READ_EOF;
     }
-  }
-
-  if(endian == k_EndianCheck)
-  {
-    dataArray->byteSwapElements();
+    blockStart = nextStart;
+    blockCount = nextCount;
   }
 
   return RBR_NO_ERROR;
@@ -191,6 +232,7 @@ void RawBinaryReader::setupFilterParameters()
     parameters.push_back(parameter);
   }
   parameters.push_back(SIMPL_NEW_UINT64_FP("Skip Header Bytes", SkipHeaderBytes, FilterParameter::Category::Parameter, RawBinaryReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Memory Map File", MemoryMapFile, FilterParameter::Category::Parameter, RawBinaryReader));
   {
     DataArrayCreationFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Output Attribute Array", CreatedAttributeArrayPath, FilterParameter::Category::CreatedArray, RawBinaryReader, req));
@@ -208,6 +250,7 @@ void RawBinaryReader::readFilterParameters(AbstractFilterParametersReader* reade
   setNumberOfComponents(reader->readValue("NumberOfComponents", getNumberOfComponents()));
   setEndian(reader->readValue("Endian", getEndian()));
   setSkipHeaderBytes(reader->readValue("SkipHeaderBytes", getSkipHeaderBytes()));
+  setMemoryMapFile(reader->readValue("MemoryMapFile", getMemoryMapFile()));
 
   reader->closeFilterGroup();
 }
@@ -251,54 +294,56 @@ void RawBinaryReader::dataCheck()
 
   size_t allocatedBytes = 0;
   std::vector<size_t> cDims = {static_cast<size_t>(m_NumberOfComponents)};
+  // The file size check below guarantees execute() overwrites every element, so the array is not initialized first
+  constexpr bool k_InitializeArray = false;
   if(m_ScalarType == SIMPL::NumericTypes::Type::Int8)
   {
-    dca->createNonPrereqArrayFromPath<Int8ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<Int8ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(int8_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt8)
   {
-    dca->createNonPrereqArrayFromPath<UInt8ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<UInt8ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(uint8_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int16)
   {
-    dca->createNonPrereqArrayFromPath<Int16ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<Int16ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(int16_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt16)
   {
-    dca->createNonPrereqArrayFromPath<UInt16ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<UInt16ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(uint16_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int32)
   {
-    dca->createNonPrereqArrayFromPath<Int32ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<Int32ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(int32_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt32)
   {
-    dca->createNonPrereqArrayFromPath<UInt32ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<UInt32ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(uint32_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int64)
   {
-    dca->createNonPrereqArrayFromPath<Int64ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<Int64ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(int64_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt64)
   {
-    dca->createNonPrereqArrayFromPath<UInt64ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<UInt64ArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(uint64_t) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Float)
   {
-    dca->createNonPrereqArrayFromPath<FloatArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<FloatArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(float) * totalSize;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Double)
   {
-    dca->createNonPrereqArrayFromPath<DoubleArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    dca->createNonPrereqArrayFromPath<DoubleArrayType>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath", RenameDataPath::k_Invalid_ID, k_InitializeArray);
     allocatedBytes = sizeof(double) * totalSize;
   }
 
@@ -364,40 +409,40 @@ void RawBinaryReader::execute()
   switch(m_ScalarType)
   {
   case SIMPL::NumericTypes::Type::Int8:
-    err = readBinaryFile<int8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::UInt8:
-    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::Int16:
-    err = readBinaryFile<int16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::UInt16:
-    err = readBinaryFile<uint16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint16_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::Int32:
-    err = readBinaryFile<int32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::UInt32:
-    err = readBinaryFile<uint32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint32_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::Int64:
-    err = readBinaryFile<int64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<int64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::UInt64:
-    err = readBinaryFile<uint64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint64_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::Float:
-    err = readBinaryFile<float>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<float>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::Double:
-    err = readBinaryFile<double>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<double>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::Bool:
-    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<uint8_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::SizeT:
-    err = readBinaryFile<size_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian);
+    err = readBinaryFile<size_t>(dataArray.get(), inputFile, m_SkipHeaderBytes, m_Endian, m_MemoryMapFile);
     break;
   case SIMPL::NumericTypes::Type::UnknownNumType:
     break;
@@ -570,6 +615,18 @@ uint64_t RawBinaryReader::getSkipHeaderBytes() const
   return m_SkipHeaderBytes;
 }
 
+// -----------------------------------------------------------------------------
+void RawBinaryReader::setMemoryMapFile(bool value)
+{
+  m_MemoryMapFile = value;
+}
+
+// -----------------------------------------------------------------------------
+bool RawBinaryReader::getMemoryMapFile() const
+{
+  return m_MemoryMapFile;
+}
+
 // -----------------------------------------------------------------------------
 void RawBinaryReader::setInputFile(const QString& value)
 {
@@ -62,6 +62,7 @@ class SIMPLib_EXPORT RawBinaryReader : public AbstractFilter
   PYB11_PROPERTY(int32_t Endian READ getEndian WRITE setEndian)
   PYB11_PROPERTY(int32_t NumberOfComponents READ getNumberOfComponents WRITE setNumberOfComponents)
   PYB11_PROPERTY(uint64_t SkipHeaderBytes READ getSkipHeaderBytes WRITE setSkipHeaderBytes)
+  PYB11_PROPERTY(bool MemoryMapFile READ getMemoryMapFile WRITE setMemoryMapFile)
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -154,6 +155,20 @@ public:
 
   Q_PROPERTY(uint64_t SkipHeaderBytes READ getSkipHeaderBytes WRITE setSkipHeaderBytes)
 
+  /**
+   * @brief Setter property for MemoryMapFile. When set, data that does not need to be byte swapped is
+   * mapped from the input file instead of being copied into memory.
+   */
+  void setMemoryMapFile(bool value);
+
+  /**
+   * @brief Getter property for MemoryMapFile
+   * @return Value of MemoryMapFile
+   */
+  bool getMemoryMapFile() const;
+
+  Q_PROPERTY(bool MemoryMapFile READ getMemoryMapFile WRITE setMemoryMapFile)
+
   /**
    * @brief Setter property for InputFile
    */
@@ -241,6 +256,7 @@ private:
   int32_t m_Endian = {0};
   int32_t m_NumberOfComponents = {0};
   uint64_t m_SkipHeaderBytes = {0};
+  bool m_MemoryMapFile = {false};
   QString m_InputFile = {""};
 
 public:
@@ -17,6 +17,7 @@
 #include "SIMPLib/Utilities/StringOperations.h"
 
 #include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
+#include "SIMPLib/CoreFilters/util/ParallelASCIIReader.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 
@@ -337,6 +338,11 @@ void ReadASCIIData::dataCheck()
     }
   }
 
+  // execute() writes one tuple per data line, so the arrays only need initializing when the file does not cover every tuple
+  const size_t numDataLines = static_cast<size_t>(wizardData.numberOfLines - wizardData.beginIndex + 1);
+  AttributeMatrix::Pointer destAttrMat = getDataContainerArray()->getAttributeMatrix(selectedPath);
+  const bool initializeArrays = (nullptr == destAttrMat.get() || destAttrMat->getNumberOfTuples() != numDataLines);
+
   // Create the arrays
   for(int i = 0; i < dataTypes.size(); i++)
   {
@@ -352,57 +358,57 @@ void ReadASCIIData::dataCheck()
 
     if(dataType == SIMPL::TypeNames::Double)
     {
-      DoubleArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<DoubleArrayType>(this, arrayPath, 0, cDims, "");
+      DoubleArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<DoubleArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::Float)
     {
-      FloatArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType>(this, arrayPath, 0, cDims, "");
+      FloatArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::Int8)
     {
-      Int8ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int8ArrayType>(this, arrayPath, 0, cDims, "");
+      Int8ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int8ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::Int16)
     {
-      Int16ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int16ArrayType>(this, arrayPath, 0, cDims, "");
+      Int16ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int16ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::Int32)
     {
-      Int32ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType>(this, arrayPath, 0, cDims, "");
+      Int32ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::Int64)
     {
-      Int64ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int64ArrayType>(this, arrayPath, 0, cDims, "");
+      Int64ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<Int64ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::UInt8)
     {
-      UInt8ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt8ArrayType>(this, arrayPath, 0, cDims, "");
+      UInt8ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt8ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::UInt16)
     {
-      UInt16ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt16ArrayType>(this, arrayPath, 0, cDims, "");
+      UInt16ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt16ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::UInt32)
     {
-      UInt32ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt32ArrayType>(this, arrayPath, 0, cDims, "");
+      UInt32ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt32ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::UInt64)
     {
-      UInt64ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt64ArrayType>(this, arrayPath, 0, cDims, "");
+      UInt64ArrayType::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<UInt64ArrayType>(this, arrayPath, 0, cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else if(dataType == SIMPL::TypeNames::String)
     {
-      StringDataArray::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<StringDataArray>(this, arrayPath, "", cDims, "");
+      StringDataArray::Pointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<StringDataArray>(this, arrayPath, "", cDims, "", RenameDataPath::k_Invalid_ID, initializeArrays);
       m_ASCIIArrayMap.insert(i, ptr);
     }
     else
@@ -433,7 +439,6 @@ void ReadASCIIData::execute()
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
   QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
   int numLines = wizardData.numberOfLines;
   int beginIndex = wizardData.beginIndex;
 
@@ -511,6 +516,45 @@ void ReadASCIIData::execute()
     }
   }
 
+  ParallelASCIIReader::Pointer reader = ParallelASCIIReader::New();
+  reader->setInputFilePath(inputFilePath);
+  reader->setBeginIndex(beginIndex);
+  reader->setNumberOfLines(numLines);
+  reader->setNumberOfColumns(dataTypes.size());
+  reader->setDelimiters(delimiters);
+  reader->setParsers(dataParsers);
+
+  switch(reader->execute(this))
+  {
+  case ParallelASCIIReader::Status::MappingFailed:
+    // The file could not be memory mapped, so fall back to reading it line by line
+    readLineByLine(dataParsers);
+    break;
+  case ParallelASCIIReader::Status::InconsistentColumns:
+    setErrorCondition(INCONSISTENT_COLS, reader->getErrorMessage());
+    break;
+  case ParallelASCIIReader::Status::ConversionFailure:
+    setErrorCondition(CONVERSION_FAILURE, reader->getErrorMessage());
+    break;
+  case ParallelASCIIReader::Status::Success:
+  case ParallelASCIIReader::Status::Canceled:
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadASCIIData::readLineByLine(const QList<AbstractDataParser::Pointer>& dataParsers)
+{
+  ASCIIWizardData wizardData = getWizardData();
+  QString inputFilePath = wizardData.inputFilePath;
+  QStringList dataTypes = wizardData.dataTypes;
+  QList<char> delimiters = wizardData.delimiters;
+  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
+  int numLines = wizardData.numberOfLines;
+  int beginIndex = wizardData.beginIndex;
+
   int insertIndex = 0;
 
   QFile inputFile(inputFilePath);
@@ -40,6 +40,7 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 class IDataArray;
+class AbstractDataParser;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
 
 /**
@@ -203,6 +204,12 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief Reads the file with a QTextStream one line at a time. This is used if the file can not be memory mapped.
+   * @param dataParsers The parsers of the imported columns
+   */
+  void readLineByLine(const QList<std::shared_ptr<AbstractDataParser>>& dataParsers);
+
 private:
   ASCIIWizardData m_WizardData = {};
 
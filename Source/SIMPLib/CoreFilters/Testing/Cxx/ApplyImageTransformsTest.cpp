@@ -3,13 +3,21 @@
 // -----------------------------------------------------------------------------
 #pragma once
 
+#include <chrono>
+#include <cmath>
+
 #include "SIMPLib/CoreFilters/ApplyImageTransforms.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TransformContainer.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
@@ -38,10 +46,260 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  int TestApplyImageTransformsTest()
+  DataContainerArray::Pointer CreateDataContainerArray(const SizeVec3Type& dims, const FloatVec3Type& spacing, const FloatVec3Type& origin, const std::vector<double>& parameters,
+                                                       const std::vector<double>& fixedParameters = {}, const std::string& transformType = "AffineTransform_double_3_3")
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+    ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeom->setDimensions(dims);
+    imageGeom->setSpacing(spacing);
+    imageGeom->setOrigin(origin);
+
+    TransformContainer::Pointer transformContainer = TransformContainer::New();
+    transformContainer->setTransformTypeAsString(transformType);
+    transformContainer->setParameters(parameters);
+    transformContainer->setFixedParameters(fixedParameters);
+    imageGeom->setTransformContainer(transformContainer);
+    dc->setGeometry(imageGeom);
+
+    std::vector<size_t> tDims = {dims[0], dims[1], dims[2]};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    size_t numCells = dims[0] * dims[1] * dims[2];
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(numCells, std::vector<size_t>{1}, "Ids", true);
+    FloatArrayType::Pointer ramp = FloatArrayType::CreateArray(numCells, std::vector<size_t>{2}, "Ramp", true);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          ids->setValue(index, static_cast<int32_t>(index + 1));
+          float xCoord = origin[0] + (static_cast<float>(x) + 0.5f) * spacing[0];
+          float yCoord = origin[1] + (static_cast<float>(y) + 0.5f) * spacing[1];
+          ramp->setComponent(index, 0, 3.0f * xCoord - 2.0f * yCoord + 1.0f);
+          ramp->setComponent(index, 1, 7.0f);
+        }
+      }
+    }
+    am->insertOrAssign(ids);
+    am->insertOrAssign(ramp);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ApplyImageTransforms::Pointer CreateFilter(const DataContainerArray::Pointer& dca, ApplyImageTransforms::InterpolationType interpolationType)
+  {
+    ApplyImageTransforms::Pointer filter = ApplyImageTransforms::New();
+    filter->setDataContainerArray(dca);
+    filter->setImageDataContainers({"ImageDataContainer"});
+    filter->setInterpolationType(static_cast<int>(interpolationType));
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestTranslation()
+  {
+    std::vector<double> parameters = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 2.5, -1.5, 0.0};
+    DataContainerArray::Pointer dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {10.0f, 20.0f, 0.0f}, parameters);
+    Int32ArrayType::Pointer ids = dca->getDataContainer("ImageDataContainer")->getAttributeMatrix("CellData")->getAttributeArrayAs<Int32ArrayType>("Ids");
+
+    ApplyImageTransforms::Pointer filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::Linear);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+    // A translation only moves the origin and leaves the data alone
+    ImageGeom::Pointer imageGeom = dca->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_EQUAL(imageGeom->getOrigin()[0], 7.5f)
+    DREAM3D_REQUIRE_EQUAL(imageGeom->getOrigin()[1], 21.5f)
+    DREAM3D_REQUIRE_EQUAL(imageGeom->getDimensions()[0], 4)
+    DREAM3D_REQUIRE_EQUAL(imageGeom->getDimensions()[1], 3)
+    DREAM3D_REQUIRE(ids == dca->getDataContainer("ImageDataContainer")->getAttributeMatrix("CellData")->getAttributeArrayAs<Int32ArrayType>("Ids"))
+
+    TransformContainer::Pointer transformContainer = std::dynamic_pointer_cast<TransformContainer>(imageGeom->getTransformContainer());
+    std::vector<double> identity = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+    DREAM3D_REQUIRE(transformContainer->getParameters() == identity)
+
+    // An ITK TranslationTransform only stores the translation
+    dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {10.0f, 20.0f, 0.0f}, {2.5, -1.5, 0.0}, {}, "TranslationTransform_double_3_3");
+    filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::Linear);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    imageGeom = dca->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_EQUAL(imageGeom->getOrigin()[0], 7.5f)
+    DREAM3D_REQUIRE_EQUAL(imageGeom->getOrigin()[1], 21.5f)
+    transformContainer = std::dynamic_pointer_cast<TransformContainer>(imageGeom->getTransformContainer());
+    DREAM3D_REQUIRE(transformContainer->getParameters() == std::vector<double>(3, 0.0))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestNearestNeighborRotation()
+  {
+    // Rotating by 90 degrees about Z moves every cell without any interpolation
+    std::vector<double> parameters = {0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+    DataContainerArray::Pointer dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, parameters);
+
+    ApplyImageTransforms::Pointer filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::NearestNeighbor);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    // The preflight already reports the resampled geometry
+    AttributeMatrix::Pointer am = dca->getDataContainer("ImageDataContainer")->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_EQUAL(am->getTupleDimensions()[0], 3)
+    DREAM3D_REQUIRE_EQUAL(am->getTupleDimensions()[1], 4)
+
+    dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, parameters);
+    filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::NearestNeighbor);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+    ImageGeom::Pointer imageGeom = dca->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>();
+    SizeVec3Type dims = imageGeom->getDimensions();
+    FloatVec3Type origin = imageGeom->getOrigin();
+    DREAM3D_REQUIRE_EQUAL(dims[0], 3)
+    DREAM3D_REQUIRE_EQUAL(dims[1], 4)
+    DREAM3D_REQUIRE_EQUAL(dims[2], 1)
+
+    am = dca->getDataContainer("ImageDataContainer")->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 12)
+    Int32ArrayType::Pointer ids = am->getAttributeArrayAs<Int32ArrayType>("Ids");
+    DREAM3D_REQUIRE_VALID_POINTER(ids.get())
+    DREAM3D_REQUIRE_EQUAL(ids->getNumberOfTuples(), 12)
+    for(size_t y = 0; y < dims[1]; y++)
+    {
+      for(size_t x = 0; x < dims[0]; x++)
+      {
+        // The output cell center (px, py) samples the original image at (-py, px)
+        float px = origin[0] + static_cast<float>(x) + 0.5f;
+        float py = origin[1] + static_cast<float>(y) + 0.5f;
+        int32_t oldX = static_cast<int32_t>(std::floor(-py));
+        int32_t oldY = static_cast<int32_t>(std::floor(px));
+        DREAM3D_REQUIRE_EQUAL(ids->getValue(y * dims[0] + x), oldY * 4 + oldX + 1)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLinearRotation()
   {
-    int foo = 0;
-    DREAM3D_REQUIRE_EQUAL(foo, 0)
+    // 45 degrees about the point (10, 9) with a small translation
+    const double angle = SIMPLib::Constants::k_PiOver4D;
+    std::vector<double> parameters = {std::cos(angle), -std::sin(angle), 0.0, std::sin(angle), std::cos(angle), 0.0, 0.0, 0.0, 1.0, 0.3, -0.2, 0.0};
+    std::vector<double> center = {10.0, 9.0, 0.0};
+    DataContainerArray::Pointer dca = CreateDataContainerArray({40, 30, 1}, {0.5f, 0.5f, 2.0f}, {1.0f, 2.0f, 3.0f}, parameters, center);
+
+    ApplyImageTransforms::Pointer filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::Linear);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+    ImageGeom::Pointer imageGeom = dca->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>();
+    SizeVec3Type dims = imageGeom->getDimensions();
+    FloatVec3Type spacing = imageGeom->getSpacing();
+    FloatVec3Type origin = imageGeom->getOrigin();
+    DREAM3D_REQUIRED(dims[0], >, 40)
+    DREAM3D_REQUIRED(dims[1], >, 30)
+    DREAM3D_REQUIRE_EQUAL(dims[2], 1)
+
+    FloatArrayType::Pointer ramp = dca->getDataContainer("ImageDataContainer")->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("Ramp");
+    DREAM3D_REQUIRE_EQUAL(ramp->getNumberOfTuples(), dims[0] * dims[1])
+    size_t numChecked = 0;
+    for(size_t y = 0; y < dims[1]; y++)
+    {
+      for(size_t x = 0; x < dims[0]; x++)
+      {
+        double px = origin[0] + (static_cast<double>(x) + 0.5) * spacing[0] - center[0];
+        double py = origin[1] + (static_cast<double>(y) + 0.5) * spacing[1] - center[1];
+        double qx = parameters[0] * px + parameters[1] * py + center[0] + parameters[9];
+        double qy = parameters[3] * px + parameters[4] * py + center[1] + parameters[10];
+        // Cell coordinates of the original image, away from the clamped border
+        double u = (qx - 1.0) / 0.5 - 0.5;
+        double v = (qy - 2.0) / 0.5 - 0.5;
+        if(u < 0.01 || u > 38.99 || v < 0.01 || v > 28.99)
+        {
+          continue;
+        }
+        // Linear interpolation reproduces a linear field exactly
+        size_t index = y * dims[0] + x;
+        DREAM3D_REQUIRE(std::abs(ramp->getComponent(index, 0) - (3.0 * qx - 2.0 * qy + 1.0)) < 1.0E-3)
+        DREAM3D_REQUIRE(std::abs(ramp->getComponent(index, 1) - 7.0f) < 1.0E-5f)
+        numChecked++;
+      }
+    }
+    DREAM3D_REQUIRED(numChecked, >, 1000)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestInvalidTransforms()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, {1.0, 0.0, 0.0});
+    ApplyImageTransforms::Pointer filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::NearestNeighbor);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11002)
+
+    // A 3D Euler transform has as many parameters as a 2D affine transform and must not be mistaken for one
+    dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, {0.0, 0.0, 0.5, 1.0, 2.0, 0.0}, {}, "Euler3DTransform_double_3_3");
+    filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::NearestNeighbor);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11002)
+    DREAM3D_REQUIRE_EQUAL(dca->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>()->getOrigin()[0], 0.0f)
+
+    dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, {1.0, 1.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0});
+    filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::NearestNeighbor);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11003)
+
+    dca = CreateDataContainerArray({4, 3, 1}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0});
+    filter = CreateFilter(dca, ApplyImageTransforms::InterpolationType::NearestNeighbor);
+    filter->setInterpolationType(2);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -11004)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int BenchmarkResampling()
+  {
+    const double angle = SIMPLib::Constants::k_PiOver180D * 30.0;
+    std::vector<double> parameters = {std::cos(angle), -std::sin(angle), 0.0, std::sin(angle), std::cos(angle), 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+    const SizeVec3Type dims = {512, 512, 32};
+
+    std::cout << "ApplyImageTransforms resampling throughput:" << std::endl;
+    for(const auto& interpolationType : {ApplyImageTransforms::InterpolationType::NearestNeighbor, ApplyImageTransforms::InterpolationType::Linear})
+    {
+      DataContainerArray::Pointer dca = CreateDataContainerArray(dims, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, parameters);
+      ApplyImageTransforms::Pointer filter = CreateFilter(dca, interpolationType);
+
+      auto start = std::chrono::steady_clock::now();
+      filter->execute();
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+      size_t numCells = dca->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>()->getNumberOfElements();
+      auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+      std::cout << "\t" << (interpolationType == ApplyImageTransforms::InterpolationType::Linear ? "Linear" : "Nearest Neighbor") << ": " << numCells << " cells x 2 arrays in " << millis << " ms ("
+                << (millis > 0 ? static_cast<double>(numCells) / static_cast<double>(millis) / 1000.0 : 0.0) << " Mcells/s)" << std::endl;
+    }
 
     return EXIT_SUCCESS;
   }
@@ -55,7 +313,13 @@ public:
 
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
-    DREAM3D_REGISTER_TEST(TestApplyImageTransformsTest())
+    DREAM3D_REGISTER_TEST(TestTranslation())
+    DREAM3D_REGISTER_TEST(TestNearestNeighborRotation())
+    DREAM3D_REGISTER_TEST(TestLinearRotation())
+    DREAM3D_REGISTER_TEST(TestInvalidTransforms())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkResampling())
+#endif
   }
 
 private:
@@ -32,12 +32,15 @@
  *    United States Prime Contract Navy N00173-07-C-2068
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include <chrono>
+
 #include "SIMPLib/CoreFilters/ArrayCalculator.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/CoreFilters/CreateDataArray.h"
 #include "SIMPLib/CoreFilters/util/CalculatorOperator.h"
+#include "SIMPLib/CoreFilters/util/CalculatorProgram.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/DynamicTableData.h"
@@ -933,6 +936,72 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void FusedEvaluationTest()
+  {
+    const size_t numTuples = 2000000;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer aArray = FloatArrayType::CreateArray(numTuples, std::string("A"), true);
+    Int16ArrayType::Pointer bArray = Int16ArrayType::CreateArray(numTuples, std::string("B"), true);
+    UInt8ArrayType::Pointer cArray = UInt8ArrayType::CreateArray(std::vector<size_t>(1, numTuples), std::vector<size_t>(1, 3), "C", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      aArray->setValue(i, static_cast<float>(i % 1000) * 0.25f - 100.0f);
+      bArray->setValue(i, static_cast<int16_t>(i % 311) - 150);
+      cArray->setComponent(i, 0, static_cast<uint8_t>(i % 7));
+      cArray->setComponent(i, 1, static_cast<uint8_t>(i % 13));
+      cArray->setComponent(i, 2, static_cast<uint8_t>(i % 17));
+    }
+    am->insertOrAssign(aArray);
+    am->insertOrAssign(bArray);
+    am->insertOrAssign(cArray);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    ArrayCalculator::Pointer filter = ArrayCalculator::New();
+    filter->setDataContainerArray(dca);
+    filter->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    filter->setCalculatedArray(DataArrayPath("DataContainer", "AttributeMatrix", "Result"));
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Double);
+    filter->setInfixEquation("A * 2 + B / 4 - sqrt(abs(A)) + C[1] * 0.5 + sin(B) ^ 2 + log10(abs(A) + 1) - floor(B / 3) + (2 * 3 - 1)");
+
+    auto start = std::chrono::steady_clock::now();
+    filter->execute();
+    auto end = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    std::cout << "  Fused evaluation of " << numTuples << " tuples: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    DoubleArrayType::Pointer result = dca->getPrereqArrayFromPath<DoubleArrayType>(filter.get(), DataArrayPath("DataContainer", "AttributeMatrix", "Result"), {1});
+    DREAM3D_REQUIRE_VALID_POINTER(result.get())
+    DREAM3D_REQUIRE_EQUAL(result->getNumberOfTuples(), numTuples)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      double a = aArray->getValue(i);
+      double b = bArray->getValue(i);
+      double c = cArray->getComponent(i, 1);
+      double expected = a * 2 + b / 4 - sqrt(fabs(a)) + c * 0.5 + pow(sin(b), 2) + log10(fabs(a) + 1) - floor(b / 3) + 5;
+      DREAM3D_REQUIRED(SIMPLibMath::closeEnough<double>(result->getValue(i), expected, 1.0E-9), ==, true)
+    }
+
+    // The constant terms are folded while compiling and the output is written in the requested type
+    filter->setCalculatedArray(DataArrayPath("DataContainer", "AttributeMatrix", "Result2"));
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+    filter->setInfixEquation("C[2] + 2 * (3 + 4)");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    Int32ArrayType::Pointer intResult = dca->getPrereqArrayFromPath<Int32ArrayType>(filter.get(), DataArrayPath("DataContainer", "AttributeMatrix", "Result2"), {1});
+    DREAM3D_REQUIRE_VALID_POINTER(intResult.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(intResult->getValue(i), static_cast<int32_t>(i % 17) + 14)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -942,6 +1011,7 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(SingleComponentArrayCalculatorTest())
     DREAM3D_REGISTER_TEST(MultiComponentArrayCalculatorTest())
+    DREAM3D_REGISTER_TEST(FusedEvaluationTest())
   }
 
 private:
@@ -33,7 +33,9 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <chrono>
 #include <cstdlib>
+#include <iostream>
 #include <tuple>
 
 #include <QtCore/QDir>
@@ -62,6 +64,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/SIMPLH5StructureCache.h"
 
 #define helper(a, b) a##b
 
@@ -469,6 +472,89 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer preflightReader(const DataContainerArrayProxy& proxy)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::TestFile());
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(proxy);
+    reader->preflight();
+    DREAM3D_REQUIRED(reader->getErrorCode(), >=, 0)
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStructureCache()
+  {
+    SIMPLH5StructureCache::Clear();
+    SIMPLH5StructureCache::ResetCounters();
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile());
+    DREAM3D_REQUIRE_EQUAL(SIMPLH5StructureCache::GetMissCount(), 1)
+    DREAM3D_REQUIRE_EQUAL(SIMPLH5StructureCache::GetHitCount(), 0)
+    DREAM3D_REQUIRE(SIMPLH5StructureCache::Contains(DataContainerIOTest::TestFile()))
+
+    DataContainerArrayProxy cachedProxy = reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile());
+    DREAM3D_REQUIRE_EQUAL(SIMPLH5StructureCache::GetHitCount(), 1)
+    DREAM3D_REQUIRE(cachedProxy == proxy)
+
+    // The second preflight is answered from the cache and every caller gets its own copy
+    DataContainerArray::Pointer dca = preflightReader(proxy);
+    size_t hits = SIMPLH5StructureCache::GetHitCount();
+    DataContainerArray::Pointer cachedDca = preflightReader(proxy);
+    DREAM3D_REQUIRED(SIMPLH5StructureCache::GetHitCount(), >, hits)
+    DREAM3D_REQUIRE(DataContainerArrayProxy(cachedDca.get()) == DataContainerArrayProxy(dca.get()))
+    DREAM3D_REQUIRE(cachedDca->getDataContainers().front() != dca->getDataContainers().front())
+
+    // Invalidating the file forces the next lookup to scan it again
+    SIMPLH5StructureCache::Invalidate(DataContainerIOTest::TestFile());
+    DREAM3D_REQUIRE(!SIMPLH5StructureCache::Contains(DataContainerIOTest::TestFile()))
+    size_t misses = SIMPLH5StructureCache::GetMissCount();
+    reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile());
+    DREAM3D_REQUIRE_EQUAL(SIMPLH5StructureCache::GetMissCount(), misses + 1)
+
+    // Writing a file drops its entries
+    DataContainerArray::Pointer writeDca = DataContainerArray::New();
+    DataContainerReader::Pointer fullReader = DataContainerReader::New();
+    fullReader->setInputFile(DataContainerIOTest::TestFile());
+    fullReader->setDataContainerArray(writeDca);
+    fullReader->setInputFileDataContainerArrayProxy(proxy);
+    fullReader->execute();
+    DREAM3D_REQUIRED(fullReader->getErrorCode(), >=, 0)
+
+    SIMPLH5StructureCache::InsertHasMontages(DataContainerIOTest::TestFile2(), false);
+    DREAM3D_REQUIRE(SIMPLH5StructureCache::Contains(DataContainerIOTest::TestFile2()))
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(writeDca);
+    writer->setOutputFile(DataContainerIOTest::TestFile2());
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    DREAM3D_REQUIRE(!SIMPLH5StructureCache::Contains(DataContainerIOTest::TestFile2()))
+
+    // Preflight timings with and without the cache
+    const int32_t numPreflights = 20;
+    for(bool enabled : {false, true})
+    {
+      SIMPLH5StructureCache::SetEnabled(enabled);
+      auto start = std::chrono::steady_clock::now();
+      for(int32_t i = 0; i < numPreflights; i++)
+      {
+        preflightReader(proxy);
+      }
+      auto end = std::chrono::steady_clock::now();
+      std::cout << "\t" << numPreflights << " Preflights " << (enabled ? "with" : "without") << " the structure cache: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+                << " us" << std::endl;
+    }
+    std::cout << "\tStructure cache hits: " << SIMPLH5StructureCache::GetHitCount() << "  misses: " << SIMPLH5StructureCache::GetMissCount() << std::endl;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1196,6 +1282,7 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestStructureCache())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
 
 #if REMOVE_TEST_FILES
@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include <array>
+#include <chrono>
 
 #include <QtCore/QString>
 
@@ -48,6 +49,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Filtering/ThresholdPredicate.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -355,6 +357,125 @@ public:
     return 1;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ComparisonValue::Pointer CreateComparisonValue(const QString& arrayName, int unionOperator, SIMPL::Comparison::Enumeration compOperator, double compValue)
+  {
+    ComparisonValue::Pointer comparisonValue = ComparisonValue::New();
+    comparisonValue->setAttributeArrayName(arrayName);
+    comparisonValue->setUnionOperator(unionOperator);
+    comparisonValue->setCompOperator(compOperator);
+    comparisonValue->setCompValue(compValue);
+    return comparisonValue;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunCompiledPredicateTest()
+  {
+    const size_t numTuples = 2000003;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("dc");
+    std::vector<size_t> tDims = {numTuples};
+    std::vector<size_t> cDims = {1};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer dataf = FloatArrayType::CreateArray(tDims, cDims, "TestArrayFloat", true);
+    Int32ArrayType::Pointer datai = Int32ArrayType::CreateArray(tDims, cDims, "TestArrayInt", true);
+    UInt8ArrayType::Pointer datau = UInt8ArrayType::CreateArray(tDims, cDims, "TestArrayUInt8", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      dataf->setValue(i, static_cast<float>(i % 997) * 0.1f);
+      datai->setValue(i, static_cast<int32_t>(i % 101) - 20);
+      datau->setValue(i, static_cast<uint8_t>(i % 83));
+    }
+    am->insertOrAssign(dataf);
+    am->insertOrAssign(datai);
+    am->insertOrAssign(datau);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    // A nested threshold with 12 comparisons: (A AND NOT B) OR D, where B contains the set C
+    ComparisonSet::Pointer setA = ComparisonSet::New();
+    setA->addComparison(CreateComparisonValue("TestArrayInt", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_GreaterThan, 5));
+    setA->addComparison(CreateComparisonValue("TestArrayInt", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_LessThan, 60));
+    setA->addComparison(CreateComparisonValue("TestArrayInt", SIMPL::Union::Operator_Or, SIMPL::Comparison::Operator_Equal, -3));
+
+    ComparisonSet::Pointer setC = ComparisonSet::New();
+    setC->setUnionOperator(SIMPL::Union::Operator_Or);
+    setC->addComparison(CreateComparisonValue("TestArrayUInt8", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_Equal, 7));
+    setC->addComparison(CreateComparisonValue("TestArrayUInt8", SIMPL::Union::Operator_Or, SIMPL::Comparison::Operator_Equal, 8));
+    setC->addComparison(CreateComparisonValue("TestArrayUInt8", SIMPL::Union::Operator_Or, SIMPL::Comparison::Operator_GreaterThan, 80));
+
+    ComparisonSet::Pointer setB = ComparisonSet::New();
+    setB->setUnionOperator(SIMPL::Union::Operator_And);
+    setB->setInvertComparison(true);
+    setB->addComparison(CreateComparisonValue("TestArrayFloat", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_LessThan, 10.0));
+    setB->addComparison(setC);
+
+    ComparisonSet::Pointer setD = ComparisonSet::New();
+    setD->setUnionOperator(SIMPL::Union::Operator_Or);
+    setD->addComparison(CreateComparisonValue("TestArrayFloat", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_GreaterThan, 90.0));
+    setD->addComparison(CreateComparisonValue("TestArrayInt", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_NotEqual, 0));
+    setD->addComparison(CreateComparisonValue("TestArrayUInt8", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_LessThan, 40));
+    setD->addComparison(CreateComparisonValue("TestArrayFloat", SIMPL::Union::Operator_Or, SIMPL::Comparison::Operator_Equal, 0.0));
+    setD->addComparison(CreateComparisonValue("TestArrayInt", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_GreaterThan, -20));
+
+    ComparisonInputsAdvanced comp;
+    comp.setDataContainerName("dc");
+    comp.setAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName);
+    comp.addInput(setA);
+    comp.addInput(setB);
+    comp.addInput(setD);
+
+    AbstractFilter::Pointer filter = FilterManager::Instance()->getFactoryFromClassName("MultiThresholdObjects2")->create();
+    filter->setDataContainerArray(dca);
+    QVariant var;
+    var.setValue(comp);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedThresholds", var), true)
+    var.setValue(QString("CompiledThreshold"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("DestinationArrayName", var), true)
+
+    auto startTime = std::chrono::steady_clock::now();
+    filter->execute();
+    auto endTime = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+    std::cout << "MultiThresholdObjects2 with 12 comparisons over " << numTuples << " tuples: " << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() << " ms"
+              << std::endl;
+
+    BoolArrayType::Pointer output = std::dynamic_pointer_cast<BoolArrayType>(am->getAttributeArray("CompiledThreshold"));
+    DREAM3D_REQUIRE_VALID_POINTER(output.get())
+
+    QString invalidArrayName;
+    ThresholdPredicate::Pointer predicate = ThresholdPredicate::Compile(comp, am, invalidArrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(predicate.get())
+    UInt64ArrayType::Pointer packed = predicate->evaluatePacked("PackedThreshold");
+    DREAM3D_REQUIRE_VALID_POINTER(packed.get())
+    DREAM3D_REQUIRE_EQUAL(packed->getNumberOfTuples(), (numTuples + 63) / 64)
+
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t iv = datai->getValue(i);
+      float fv = dataf->getValue(i);
+      uint8_t uv = datau->getValue(i);
+      bool a = (iv > 5 && iv < 60) || iv == -3;
+      bool b = !(fv < 10.0f || (uv == 7 || uv == 8 || uv > 80));
+      bool d = ((((fv > 90.0f && iv != 0) && uv < 40) || fv == 0.0f) && iv > -20);
+      bool expected = (a && b) || d;
+      DREAM3D_REQUIRE_EQUAL(output->getValue(i), expected)
+      DREAM3D_REQUIRE_EQUAL(((packed->getValue(i / 64) >> (i % 64)) & 1) != 0, expected)
+    }
+
+    // Missing arrays are reported instead of being compiled
+    comp.addInput(CreateComparisonValue("DoesNotExist", SIMPL::Union::Operator_And, SIMPL::Comparison::Operator_Equal, 1));
+    predicate = ThresholdPredicate::Compile(comp, am, invalidArrayName);
+    DREAM3D_REQUIRE(nullptr == predicate)
+    DREAM3D_REQUIRE_EQUAL(invalidArrayName, QString("DoesNotExist"))
+
+    return EXIT_SUCCESS;
+  }
+
   /**
    * @brief
    */
@@ -364,6 +485,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(RunComparisonValueTests())
     DREAM3D_REGISTER_TEST(RunComparisonSetTests())
+    DREAM3D_REGISTER_TEST(RunCompiledPredicateTest())
   }
 
 private:
@@ -36,6 +36,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <chrono>
+
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
@@ -63,6 +65,10 @@
  *  testCase5: This tests when the file size is larger than the allocated size and there is junk at the beginning and end of the file.
  *
  *  testCase6: This tests when skipHeaderBytes equals the file size
+ *
+ *  testCase7: This tests memory mapping the file, with an aligned and an unaligned header, and that writes to the array do not reach the file.
+ *
+ *  testCase8: This tests reading big endian data, which is byte swapped while the file is streamed.
  */
 
 /** we are going to use a fairly large array size because we want to exercise the
@@ -873,6 +879,274 @@ public:
     testCase6_TestPrimitives<double>(SIMPL::NumericTypes::Type::Double);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  IDataArray::Pointer executeFilter(SIMPL::NumericTypes::Type scalarType, size_t N, size_t skipHeaderBytes, int endian, bool memoryMapFile, int& err)
+  {
+    std::vector<size_t> dims(1, k_ArraySize);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(dims, "AttributeMatrix", AttributeMatrix::Type::Any);
+    DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::DataContainerName);
+    m->addOrReplaceAttributeMatrix(am);
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addOrReplaceDataContainer(m);
+
+    RawBinaryReader::Pointer filt = createRawBinaryReaderFilter(scalarType, N, static_cast<int>(skipHeaderBytes));
+    filt->setEndian(endian);
+    filt->setMemoryMapFile(memoryMapFile);
+    filt->setDataContainerArray(dca);
+    filt->execute();
+    err = filt->getErrorCode();
+    return am->getAttributeArray("Test_Array");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  // testCase7: This tests memory mapping the file, with an aligned and an unaligned header, and that writes to the array do not reach the file.
+  template <typename T, size_t N>
+  void testCase7_Execute(SIMPL::NumericTypes::Type scalarType)
+  {
+    size_t dataArraySize = k_ArraySize * N;
+    int err = 0;
+
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(dataArraySize, std::string("_Temp_"), true);
+    T* dataArray = array->getPointer(0);
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      dataArray[i] = static_cast<T>(i);
+    }
+
+    // An aligned header is mapped, an unaligned header falls back to reading the file
+    std::vector<size_t> junkSizes = {5 * sizeof(T), 1};
+    for(size_t junkSize : junkSizes)
+    {
+      std::vector<uint8_t> junkArray(junkSize, 0xAB);
+      bool result = createAndWriteToFile(reinterpret_cast<uint8_t*>(dataArray), dataArraySize * sizeof(T), junkArray.data(), junkArray.size(), Detail::Start);
+      DREAM3D_REQUIRED(result, ==, true)
+
+      {
+        IDataArray::Pointer iData = executeFilter<T>(scalarType, N, junkSize, Detail::Little, true, err);
+        DREAM3D_REQUIRED(err, >=, 0)
+        typename DataArray<T>::Pointer data = std::dynamic_pointer_cast<DataArray<T>>(iData);
+        DREAM3D_REQUIRE_VALID_POINTER(data.get())
+
+        bool expectMapped = (junkSize % alignof(T) == 0);
+        DREAM3D_REQUIRE_EQUAL(data->isMemoryMapped(), expectMapped)
+        for(size_t i = 0; i < dataArraySize; ++i)
+        {
+          DREAM3D_REQUIRE_EQUAL(data->getValue(i), dataArray[i])
+        }
+
+        // The mapping is copy on write
+        data->setValue(0, static_cast<T>(1));
+        data->setValue(dataArraySize - 1, static_cast<T>(0));
+      }
+
+      IDataArray::Pointer iData = executeFilter<T>(scalarType, N, junkSize, Detail::Little, false, err);
+      DREAM3D_REQUIRED(err, >=, 0)
+      T* data = reinterpret_cast<T*>(iData->getVoidPointer(0));
+      DREAM3D_REQUIRE_EQUAL(data[0], dataArray[0])
+      DREAM3D_REQUIRE_EQUAL(data[dataArraySize - 1], dataArray[dataArraySize - 1])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void testCase7_TestPrimitives(SIMPL::NumericTypes::Type scalarType)
+  {
+    testCase7_Execute<T, 1>(scalarType);
+    testCase7_Execute<T, 3>(scalarType);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void testCase7()
+  {
+    QDir dir(UnitTest::RawBinaryReaderTest::TestDir);
+    if(!dir.mkpath("."))
+    {
+      return;
+    }
+
+    testCase7_TestPrimitives<int8_t>(SIMPL::NumericTypes::Type::Int8);
+    testCase7_TestPrimitives<uint16_t>(SIMPL::NumericTypes::Type::UInt16);
+    testCase7_TestPrimitives<int32_t>(SIMPL::NumericTypes::Type::Int32);
+    testCase7_TestPrimitives<uint64_t>(SIMPL::NumericTypes::Type::UInt64);
+    testCase7_TestPrimitives<float>(SIMPL::NumericTypes::Type::Float);
+    testCase7_TestPrimitives<double>(SIMPL::NumericTypes::Type::Double);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  // testCase8: This tests reading big endian data, which is byte swapped while the file is streamed.
+  template <typename T, size_t N>
+  void testCase8_Execute(SIMPL::NumericTypes::Type scalarType)
+  {
+    size_t dataArraySize = k_ArraySize * N;
+    size_t junkArraySize = 5;
+    int err = 0;
+
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(dataArraySize, std::string("_Temp_"), true);
+    T* dataArray = array->getPointer(0);
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      dataArray[i] = static_cast<T>(i);
+    }
+
+    // Write the values in the opposite byte order, then restore the expected values
+    array->byteSwapElements();
+    std::vector<T> junkArray(junkArraySize, static_cast<T>(0));
+    bool result = createAndWriteToFile(dataArray, dataArraySize, junkArray.data(), junkArray.size(), Detail::Start);
+    DREAM3D_REQUIRED(result, ==, true)
+    array->byteSwapElements();
+
+    // Memory mapping is skipped because the data has to be converted
+    IDataArray::Pointer iData = executeFilter<T>(scalarType, N, junkArraySize * sizeof(T), Detail::Big, true, err);
+    DREAM3D_REQUIRED(err, >=, 0)
+    typename DataArray<T>::Pointer data = std::dynamic_pointer_cast<DataArray<T>>(iData);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    DREAM3D_REQUIRE_EQUAL(data->isMemoryMapped(), false)
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), dataArray[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void testCase8()
+  {
+    QDir dir(UnitTest::RawBinaryReaderTest::TestDir);
+    if(!dir.mkpath("."))
+    {
+      return;
+    }
+
+    testCase8_Execute<int16_t, 1>(SIMPL::NumericTypes::Type::Int16);
+    testCase8_Execute<uint32_t, 3>(SIMPL::NumericTypes::Type::UInt32);
+    testCase8_Execute<int64_t, 1>(SIMPL::NumericTypes::Type::Int64);
+    testCase8_Execute<float, 3>(SIMPL::NumericTypes::Type::Float);
+    testCase8_Execute<double, 2>(SIMPL::NumericTypes::Type::Double);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  // testCase9: The created array is not initialized before the read, so this tests that every element holds the value read from the file.
+  template <typename T, size_t N>
+  void testCase9_Execute(SIMPL::NumericTypes::Type scalarType)
+  {
+    size_t dataArraySize = k_ArraySize * N;
+    size_t junkArraySize = 5;
+    int err = 0;
+
+    // None of the values match the init value of the created array
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(dataArraySize, std::string("_Temp_"), true);
+    T* dataArray = array->getPointer(0);
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      dataArray[i] = static_cast<T>(i % 100 + 1);
+    }
+
+    // The trailing junk makes the file larger than the array, which only reads the front of the file
+    std::vector<T> junkArray(junkArraySize, static_cast<T>(0));
+    bool result = createAndWriteToFile(dataArray, dataArraySize, junkArray.data(), junkArray.size(), Detail::End);
+    DREAM3D_REQUIRED(result, ==, true)
+
+    // Preflight does not allocate the array
+    {
+      std::vector<size_t> dims(1, k_ArraySize);
+      AttributeMatrix::Pointer am = AttributeMatrix::New(dims, "AttributeMatrix", AttributeMatrix::Type::Any);
+      DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::DataContainerName);
+      m->addOrReplaceAttributeMatrix(am);
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      dca->addOrReplaceDataContainer(m);
+
+      RawBinaryReader::Pointer filt = createRawBinaryReaderFilter(scalarType, N, 0);
+      filt->setDataContainerArray(dca);
+      filt->preflight();
+      DREAM3D_REQUIRED(filt->getErrorCode(), >=, 0)
+      IDataArray::Pointer iData = am->getAttributeArray("Test_Array");
+      DREAM3D_REQUIRE_VALID_POINTER(iData.get())
+      DREAM3D_REQUIRE_EQUAL(iData->isAllocated(), false)
+    }
+
+    IDataArray::Pointer iData = executeFilter<T>(scalarType, N, 0, Detail::Little, false, err);
+    DREAM3D_REQUIRED(err, >=, 0)
+    typename DataArray<T>::Pointer data = std::dynamic_pointer_cast<DataArray<T>>(iData);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    DREAM3D_REQUIRE_EQUAL(data->isMemoryMapped(), false)
+    DREAM3D_REQUIRE_EQUAL(data->getInitValue(), static_cast<T>(0))
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), dataArray[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void testCase9()
+  {
+    QDir dir(UnitTest::RawBinaryReaderTest::TestDir);
+    if(!dir.mkpath("."))
+    {
+      return;
+    }
+
+    testCase9_Execute<uint8_t, 1>(SIMPL::NumericTypes::Type::UInt8);
+    testCase9_Execute<int32_t, 3>(SIMPL::NumericTypes::Type::Int32);
+    testCase9_Execute<double, 2>(SIMPL::NumericTypes::Type::Double);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkReadModes()
+  {
+    QDir dir(UnitTest::RawBinaryReaderTest::TestDir);
+    if(!dir.mkpath("."))
+    {
+      return;
+    }
+
+    const size_t numComps = 4;
+    size_t dataArraySize = k_ArraySize * numComps;
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(dataArraySize, std::string("_Temp_"), true);
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      array->setValue(i, static_cast<float>(i % 4096));
+    }
+    float* junkArray = nullptr;
+    bool result = createAndWriteToFile(array->getPointer(0), dataArraySize, junkArray, 0, Detail::None);
+    DREAM3D_REQUIRED(result, ==, true)
+
+    auto timeRead = [&](int endian, bool memoryMapFile) {
+      int err = 0;
+      auto startTime = std::chrono::steady_clock::now();
+      IDataArray::Pointer iData = executeFilter<float>(SIMPL::NumericTypes::Type::Float, numComps, 0, endian, memoryMapFile, err);
+      auto endTime = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRED(err, >=, 0)
+      DREAM3D_REQUIRE_VALID_POINTER(iData.get())
+      return std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+    };
+
+    auto readTime = timeRead(Detail::Little, false);
+    auto swapTime = timeRead(Detail::Big, false);
+    auto mapTime = timeRead(Detail::Little, true);
+
+    std::cout << "  RawBinaryReader " << (dataArraySize * sizeof(float)) / (1024 * 1024) << " MiB: read " << readTime << " ms, read + byte swap " << swapTime << " ms, memory mapped " << mapTime
+              << " ms" << std::endl;
+  }
+
   // -----------------------------------------------------------------------------
   //  Use unit test framework
   // -----------------------------------------------------------------------------
@@ -891,6 +1165,12 @@ public:
     DREAM3D_REGISTER_TEST(testCase4())
     DREAM3D_REGISTER_TEST(testCase5())
     DREAM3D_REGISTER_TEST(testCase6())
+    DREAM3D_REGISTER_TEST(testCase7())
+    DREAM3D_REGISTER_TEST(testCase8())
+    DREAM3D_REGISTER_TEST(testCase9())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkReadModes())
+#endif
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -34,12 +34,17 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include <cmath>
 
+#include <chrono>
+
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/CoreFilters/ReadASCIIData.h"
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
+#include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
+#include "SIMPLib/CoreFilters/util/ParallelASCIIReader.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -52,6 +57,7 @@
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/StringOperations.h"
 
 const QString DataContainerName = "DataContainer";
 const QString AttributeMatrixName = "AttributeMatrix";
@@ -446,6 +452,248 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestPartialTupleCoverage()
+  {
+    char delimiter = '\t';
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 1;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders.push_back(DataArrayName);
+    data.dataTypes.push_back(SIMPL::TypeNames::Int32);
+    data.delimiters.push_back(delimiter);
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile1;
+    data.numberOfLines = 10;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = std::vector<size_t>(1, 10);
+
+    CreateFile(UnitTest::ReadASCIIDataTest::TestFile1, inputIntVector, delimiter);
+
+    AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+    DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+    // The attribute matrix has more tuples than the file has lines, so the tuples past the end of the file keep the init value
+    const size_t numTuples = 15;
+    AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(data.selectedPath);
+    am->resizeAttributeArrays(std::vector<size_t>(1, numTuples));
+
+    importASCIIData->execute();
+    int err = importASCIIData->getErrorCode();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    Int32ArrayType::Pointer results = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(DataArrayName));
+    DREAM3D_REQUIRE_VALID_POINTER(results.get())
+    DREAM3D_REQUIRE_EQUAL(results->getNumberOfTuples(), numTuples)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t expected = (i < inputIntVector.size()) ? inputIntVector[i] : 0;
+      DREAM3D_REQUIRE_EQUAL(results->getValue(i), expected)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLineEndings()
+  {
+    const int numLines = 100;
+    for(const QString& lineBreak : {QString("\n"), QString("\r\n"), QString("\r")})
+    {
+      {
+        QFile file(UnitTest::ReadASCIIDataTest::TestFile2);
+        DREAM3D_REQUIRE_EQUAL(file.open(QFile::WriteOnly), true)
+        QTextStream out(&file);
+        out << "X,Id" << lineBreak;
+        for(int i = 0; i < numLines; i++)
+        {
+          // The last line does not end with a line break
+          out << i * 0.5 << "," << i << ((i + 1 < numLines) ? lineBreak : QString());
+        }
+      }
+
+      DoubleArrayType::Pointer xArray = DoubleArrayType::CreateArray(numLines, std::string("X"), true);
+      Int32ArrayType::Pointer idArray = Int32ArrayType::CreateArray(numLines, std::string("Id"), true);
+      ParallelASCIIReader::Pointer reader = ParallelASCIIReader::New();
+      reader->setInputFilePath(UnitTest::ReadASCIIDataTest::TestFile2);
+      reader->setBeginIndex(2);
+      reader->setNumberOfLines(numLines + 1);
+      reader->setNumberOfColumns(2);
+      reader->setDelimiters({','});
+      reader->setParsers({DoubleParserType::New(xArray, "X", 0), Int32ParserType::New(idArray, "Id", 1)});
+      reader->setChunkSize(64);
+      DREAM3D_REQUIRE(reader->execute(nullptr) == ParallelASCIIReader::Status::Success)
+      for(int i = 0; i < numLines; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(xArray->getValue(i), i * 0.5)
+        DREAM3D_REQUIRE_EQUAL(idArray->getValue(i), i)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFirstErrorLine()
+  {
+    // Enough lines for many chunks, so the first bad line and a later one are parsed by different threads
+    const int numLines = 50000;
+    char delimiter = ',';
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 2;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders = QStringList({"X", "Y", "Z", "Id"});
+    data.dataTypes = QStringList({SIMPL::TypeNames::Double, SIMPL::TypeNames::Double, SIMPL::TypeNames::Float, SIMPL::TypeNames::Int32});
+    data.delimiters.push_back(delimiter);
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile2;
+    data.numberOfLines = numLines + 1;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = std::vector<size_t>(1, numLines);
+
+    DoubleArrayType::Pointer xArray = DoubleArrayType::CreateArray(numLines, std::string("X"), true);
+    DoubleArrayType::Pointer yArray = DoubleArrayType::CreateArray(numLines, std::string("Y"), true);
+    FloatArrayType::Pointer zArray = FloatArrayType::CreateArray(numLines, std::string("Z"), true);
+    Int32ArrayType::Pointer idArray = Int32ArrayType::CreateArray(numLines, std::string("Id"), true);
+    QList<AbstractDataParser::Pointer> parsers = {DoubleParserType::New(xArray, "X", 0), DoubleParserType::New(yArray, "Y", 1), FloatParserType::New(zArray, "Z", 2),
+                                                  Int32ParserType::New(idArray, "Id", 3)};
+
+    // An error is reported for the first bad line with the same message as the line by line reader
+    {
+      QFile file(UnitTest::ReadASCIIDataTest::TestFile2);
+      DREAM3D_REQUIRE_EQUAL(file.open(QFile::WriteOnly), true)
+      QTextStream out(&file);
+      out << "X,Y,Z,Id\n";
+      for(int i = 0; i < numLines; i++)
+      {
+        if(i == numLines - 10)
+        {
+          out << "1,2,3\n";
+        }
+        else if(i == numLines / 2)
+        {
+          out << "1,2,3,abc\n";
+        }
+        else
+        {
+          out << "1,2,3,4\n";
+        }
+      }
+    }
+    AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+    DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+    importASCIIData->execute();
+    DREAM3D_REQUIRE_EQUAL(importASCIIData->getErrorCode(), ReadASCIIData::CONVERSION_FAILURE)
+
+    ParallelASCIIReader::Pointer reader = ParallelASCIIReader::New();
+    reader->setInputFilePath(UnitTest::ReadASCIIDataTest::TestFile2);
+    reader->setBeginIndex(data.beginIndex);
+    reader->setNumberOfLines(data.numberOfLines);
+    reader->setNumberOfColumns(data.dataTypes.size());
+    reader->setDelimiters(data.delimiters);
+    reader->setParsers(parsers);
+    reader->setChunkSize(4096);
+    DREAM3D_REQUIRE(reader->execute(nullptr) == ParallelASCIIReader::Status::ConversionFailure)
+    QString expectedMessage = ParserErrorMessages::CouldNotConvert + "(line " + QString::number(numLines / 2 + 2) + ", column 3).";
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorMessage(), expectedMessage)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int BenchmarkLargeFile()
+  {
+    const int numLines = 1000000;
+    char delimiter = ',';
+    {
+      QFile file(UnitTest::ReadASCIIDataTest::TestFile2);
+      DREAM3D_REQUIRE_EQUAL(file.open(QFile::WriteOnly), true)
+      QTextStream out(&file);
+      out << "X,Y,Z,Id\n";
+      for(int i = 0; i < numLines; i++)
+      {
+        out << (i % 1000) * 0.125 << delimiter << (i % 313) * -1.5 << delimiter << i * 1.0e-3 << delimiter << i << "\n";
+      }
+    }
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 2;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders = QStringList({"X", "Y", "Z", "Id"});
+    data.dataTypes = QStringList({SIMPL::TypeNames::Double, SIMPL::TypeNames::Double, SIMPL::TypeNames::Float, SIMPL::TypeNames::Int32});
+    data.delimiters.push_back(delimiter);
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile2;
+    data.numberOfLines = numLines + 1;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = std::vector<size_t>(1, numLines);
+
+    // The line by line reader that ReadASCIIData used before the file was memory mapped
+    DoubleArrayType::Pointer xArray = DoubleArrayType::CreateArray(numLines, std::string("X"), true);
+    DoubleArrayType::Pointer yArray = DoubleArrayType::CreateArray(numLines, std::string("Y"), true);
+    FloatArrayType::Pointer zArray = FloatArrayType::CreateArray(numLines, std::string("Z"), true);
+    Int32ArrayType::Pointer idArray = Int32ArrayType::CreateArray(numLines, std::string("Id"), true);
+    QList<AbstractDataParser::Pointer> parsers = {DoubleParserType::New(xArray, "X", 0), DoubleParserType::New(yArray, "Y", 1), FloatParserType::New(zArray, "Z", 2),
+                                                  Int32ParserType::New(idArray, "Id", 3)};
+
+    auto startTime = std::chrono::steady_clock::now();
+    {
+      QFile file(UnitTest::ReadASCIIDataTest::TestFile2);
+      DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true)
+      QTextStream in(&file);
+      in.readLine();
+      for(int lineNum = 0; lineNum < numLines; lineNum++)
+      {
+        QStringList tokens = StringOperations::TokenizeString(in.readLine(), data.delimiters, data.consecutiveDelimiters);
+        for(const AbstractDataParser::Pointer& parser : parsers)
+        {
+          ParserFunctor::ErrorObject obj = parser->parse(tokens[parser->getColumnIndex()], lineNum);
+          DREAM3D_REQUIRE_EQUAL(obj.ok, true)
+        }
+      }
+    }
+    auto lineByLineTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+    DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+    startTime = std::chrono::steady_clock::now();
+    importASCIIData->execute();
+    auto mappedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    DREAM3D_REQUIRE_EQUAL(importASCIIData->getErrorCode(), 0)
+
+    qint64 fileSize = QFileInfo(UnitTest::ReadASCIIDataTest::TestFile2).size();
+    std::cout << "ReadASCIIData " << numLines << " lines (" << fileSize / (1024 * 1024) << " MB): line by line " << lineByLineTime << " ms, memory mapped " << mappedTime << " ms" << std::endl;
+
+    AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+    DoubleArrayType::Pointer xResults = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("X"));
+    DoubleArrayType::Pointer yResults = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Y"));
+    FloatArrayType::Pointer zResults = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray("Z"));
+    Int32ArrayType::Pointer idResults = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray("Id"));
+    DREAM3D_REQUIRE_VALID_POINTER(xResults.get())
+    DREAM3D_REQUIRE_VALID_POINTER(yResults.get())
+    DREAM3D_REQUIRE_VALID_POINTER(zResults.get())
+    DREAM3D_REQUIRE_VALID_POINTER(idResults.get())
+    for(int i = 0; i < numLines; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(xResults->getValue(i), xArray->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(yResults->getValue(i), yArray->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(zResults->getValue(i), zArray->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(idResults->getValue(i), idArray->getValue(i))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -459,6 +707,12 @@ public:
     DREAM3D_REGISTER_TEST(RemoveTestFiles()) // In case the previous test asserted or stopped prematurely
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestPartialTupleCoverage())
+    DREAM3D_REGISTER_TEST(TestLineEndings())
+    DREAM3D_REGISTER_TEST(TestFirstErrorLine())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkLargeFile())
+#endif
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -100,6 +100,16 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief Parses the characters [first, last) into the tuple at index without creating a QString. Different
+   * indices may be parsed concurrently.
+   * @param first
+   * @param last
+   * @param index
+   * @return
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* first, const char* last, size_t index) = 0;
+
 protected:
   AbstractDataParser() = default;
 
@@ -177,6 +187,14 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* first, const char* last, size_t index) override
+  {
+    ParserFunctor::ErrorObject obj;
+    obj.ok = true;
+    (*m_Ptr).setValue(index, F()(first, last, obj));
+    return obj;
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <QtCore/QObject>
 
 #include "SIMPLib/SIMPLib.h"
@@ -72,23 +74,26 @@ public:
 
   static Pointer New(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate)
   {
-    return Pointer(new CalculatorArray(dataArray, type, allocate));
+    return Pointer(new CalculatorArray(dataArray, -1, type, allocate));
   }
 
   ~CalculatorArray() override = default;
 
   IDataArray::Pointer getArray() override
   {
+    materialize();
     return m_Array;
   }
 
   void setValue(int i, double val) override
   {
+    materialize();
     m_Array->setValue(i, val);
   }
 
   double getValue(int i) override
   {
+    materialize();
     if(m_Array->getNumberOfTuples() > 1)
     {
       return static_cast<double>(m_Array->getValue(i));
@@ -108,6 +113,7 @@ public:
 
   DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) override
   {
+    materialize();
     if(c >= 0 && c <= m_Array->getNumberOfComponents())
     {
       if(m_Array->getNumberOfComponents() > 1)
@@ -115,7 +121,7 @@ public:
         DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(m_Array->getNumberOfTuples(), {1}, m_Array->getName(), allocate);
         if(allocate)
         {
-          for(int i = 0; i < m_Array->getNumberOfTuples(); i++)
+          for(size_t i = 0; i < m_Array->getNumberOfTuples(); i++)
           {
             newArray->setComponent(i, 0, m_Array->getComponent(i, c));
           }
@@ -128,6 +134,30 @@ public:
     return DoubleArrayType::NullPointer();
   }
 
+  ICalculatorArray::Pointer selectComponent(int c, bool allocate = true) override
+  {
+    if(m_SourceComponent >= 0)
+    {
+      // Already a single component view
+      return (c == 0) ? Pointer(new CalculatorArray(m_SourceArray, m_SourceComponent, m_Type, allocate)) : ICalculatorArray::NullPointer();
+    }
+    if(c < 0 || c >= m_SourceArray->getNumberOfComponents())
+    {
+      return ICalculatorArray::NullPointer();
+    }
+    return Pointer(new CalculatorArray(m_SourceArray, c, m_Type, allocate));
+  }
+
+  IDataArray::Pointer getSourceArray() override
+  {
+    return m_SourceArray;
+  }
+
+  int getSourceComponent() override
+  {
+    return m_SourceComponent;
+  }
+
   CalculatorItem::ErrorCode checkValidity(QVector<CalculatorItem::Pointer> infixVector, int currentIndex, QString& msg) override
   {
     Q_UNUSED(infixVector)
@@ -139,23 +169,68 @@ public:
 protected:
   CalculatorArray() = default;
 
-  CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate)
+  /**
+   * @brief The double valued copy of the source array is only made the first time the values are
+   * requested. Expressions that are evaluated as a compiled program read the source array directly.
+   */
+  CalculatorArray(typename DataArray<T>::Pointer dataArray, int component, ValueType type, bool allocate)
   : ICalculatorArray()
+  , m_SourceArray(dataArray)
+  , m_SourceComponent(component)
   , m_Type(type)
+  , m_NeedsCopy(allocate)
   {
-    m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), allocate);
-    if(allocate)
+    std::vector<size_t> cDims = (component < 0) ? dataArray->getComponentDimensions() : std::vector<size_t>(1, 1);
+    m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), cDims, dataArray->getName(), false);
+  }
+
+private:
+  /**
+   * @brief Creates the double valued copy of the source array if it is needed and does not exist yet
+   */
+  void materialize()
+  {
+    if(!m_NeedsCopy)
     {
-      for(int i = 0; i < dataArray->getSize(); i++)
+      return;
+    }
+    m_NeedsCopy = false;
+
+    if constexpr(std::is_same<T, double>::value)
+    {
+      if(m_SourceComponent < 0)
       {
-        m_Array->setValue(i, static_cast<double>(dataArray->getValue(i)));
+        // Items never write into their values so the double array can be shared
+        m_Array = m_SourceArray;
+        return;
+      }
+    }
+
+    m_Array->allocateUninitialized();
+    size_t numTuples = m_SourceArray->getNumberOfTuples();
+    size_t numComps = m_SourceArray->getNumberOfComponents();
+    if(m_SourceComponent < 0)
+    {
+      size_t size = m_SourceArray->getSize();
+      for(size_t i = 0; i < size; i++)
+      {
+        m_Array->setValue(i, static_cast<double>(m_SourceArray->getValue(i)));
+      }
+    }
+    else
+    {
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        m_Array->setValue(i, static_cast<double>(m_SourceArray->getValue(i * numComps + m_SourceComponent)));
       }
     }
   }
 
-private:
+  typename DataArray<T>::Pointer m_SourceArray;
+  int m_SourceComponent = -1;
   DoubleArrayType::Pointer m_Array;
   ValueType m_Type;
+  bool m_NeedsCopy = false;
 
 public:
   CalculatorArray(const CalculatorArray&) = delete;            // Copy Constructor Not Implemented
@@ -89,7 +89,8 @@ public:
     INVALID_SYMBOL = -4035,
     NO_PRECEDING_UNARY_OPERATOR = -4036,
     InvalidOutputArrayType = -4037,
-    AttributeMatrixInsertionError = -4038
+    AttributeMatrixInsertionError = -4038,
+    OutputAllocationError = -4039
   };
 
   enum class WarningCode : EnumType
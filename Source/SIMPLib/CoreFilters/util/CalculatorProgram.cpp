@@ -0,0 +1,481 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CalculatorProgram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QtCore/QMap>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "CalculatorOperator.h"
+#include "ICalculatorArray.h"
+#include "NegativeOperator.h"
+
+using OpCode = CalculatorProgram::OpCode;
+
+namespace
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+void LoadBlock(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* output)
+{
+  const T* source = static_cast<const T*>(data) + start * stride + offset;
+  if(stride == 1)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<double>(source[i]);
+    }
+  }
+  else
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = static_cast<double>(source[i * stride]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool FindLoadFunction(const IDataArray::Pointer& array, CalculatorProgram::LoadFunction& load)
+{
+  if(nullptr == std::dynamic_pointer_cast<DataArray<T>>(array))
+  {
+    return false;
+  }
+  load = &LoadBlock<T>;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+CalculatorProgram::LoadFunction GetLoadFunction(const IDataArray::Pointer& array)
+{
+  CalculatorProgram::LoadFunction load = nullptr;
+  FindLoadFunction<float>(array, load) || FindLoadFunction<double>(array, load) || FindLoadFunction<int8_t>(array, load) || FindLoadFunction<uint8_t>(array, load) ||
+      FindLoadFunction<int16_t>(array, load) || FindLoadFunction<uint16_t>(array, load) || FindLoadFunction<int32_t>(array, load) || FindLoadFunction<uint32_t>(array, load) ||
+      FindLoadFunction<int64_t>(array, load) || FindLoadFunction<uint64_t>(array, load) || FindLoadFunction<bool>(array, load) || FindLoadFunction<size_t>(array, load);
+  return load;
+}
+
+// -----------------------------------------------------------------------------
+int NumberOfArguments(OpCode op)
+{
+  switch(op)
+  {
+  case OpCode::Load:
+  case OpCode::Constant:
+    return 0;
+  case OpCode::Add:
+  case OpCode::Subtract:
+  case OpCode::Multiply:
+  case OpCode::Divide:
+  case OpCode::Pow:
+  case OpCode::Root:
+  case OpCode::Log:
+    return 2;
+  default:
+    return 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+bool FindOpCode(const CalculatorItem::Pointer& item, OpCode& op)
+{
+  if(nullptr != std::dynamic_pointer_cast<NegativeOperator>(item))
+  {
+    op = OpCode::Negate;
+    return true;
+  }
+  if(nullptr == std::dynamic_pointer_cast<CalculatorOperator>(item))
+  {
+    return false;
+  }
+
+  static const QMap<QString, OpCode> k_OpCodes = {{"+", OpCode::Add},       {"-", OpCode::Subtract}, {"*", OpCode::Multiply}, {"/", OpCode::Divide},   {"^", OpCode::Pow},
+                                                  {"root", OpCode::Root},   {"log", OpCode::Log},    {"abs", OpCode::Abs},      {"sqrt", OpCode::Sqrt},  {"exp", OpCode::Exp},
+                                                  {"ln", OpCode::Ln},       {"log10", OpCode::Log10}, {"floor", OpCode::Floor}, {"ceil", OpCode::Ceil},  {"sin", OpCode::Sin},
+                                                  {"cos", OpCode::Cos},     {"tan", OpCode::Tan},    {"asin", OpCode::ASin},    {"acos", OpCode::ACos},  {"atan", OpCode::ATan}};
+  auto iter = k_OpCodes.find(item->getInfixToken());
+  if(iter == k_OpCodes.end())
+  {
+    return false;
+  }
+  op = iter.value();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Func>
+void Transform(double* values, size_t count, Func func)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = func(values[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Func>
+void Combine(double* lhs, const double* rhs, size_t count, Func func)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    lhs[i] = func(lhs[i], rhs[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// The operators match the functions used by CalculatorOperator and its subclasses
+// -----------------------------------------------------------------------------
+void ApplyBinary(OpCode op, double* lhs, const double* rhs, size_t count)
+{
+  switch(op)
+  {
+  case OpCode::Add:
+    Combine(lhs, rhs, count, [](double a, double b) { return a + b; });
+    break;
+  case OpCode::Subtract:
+    Combine(lhs, rhs, count, [](double a, double b) { return a - b; });
+    break;
+  case OpCode::Multiply:
+    Combine(lhs, rhs, count, [](double a, double b) { return a * b; });
+    break;
+  case OpCode::Divide:
+    Combine(lhs, rhs, count, [](double a, double b) { return a / b; });
+    break;
+  case OpCode::Pow:
+    Combine(lhs, rhs, count, [](double a, double b) { return std::pow(a, b); });
+    break;
+  case OpCode::Root:
+    Combine(lhs, rhs, count, [](double a, double b) { return (b == 0) ? std::numeric_limits<double>::infinity() : std::pow(a, 1 / b); });
+    break;
+  case OpCode::Log:
+    Combine(lhs, rhs, count, [](double a, double b) { return std::log(b) / std::log(a); });
+    break;
+  default:
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ApplyUnary(OpCode op, double* values, size_t count, bool useDegrees)
+{
+  const double toRadians = M_PI / 180.0;
+  const double toDegrees = 180.0 / M_PI;
+  switch(op)
+  {
+  case OpCode::Negate:
+    Transform(values, count, [](double a) { return -1 * a; });
+    break;
+  case OpCode::Abs:
+    Transform(values, count, [](double a) { return std::fabs(a); });
+    break;
+  case OpCode::Sqrt:
+    Transform(values, count, [](double a) { return std::sqrt(a); });
+    break;
+  case OpCode::Exp:
+    Transform(values, count, [](double a) { return std::exp(a); });
+    break;
+  case OpCode::Ln:
+    Transform(values, count, [](double a) { return std::log(a); });
+    break;
+  case OpCode::Log10:
+    Transform(values, count, [](double a) { return std::log10(a); });
+    break;
+  case OpCode::Floor:
+    Transform(values, count, [](double a) { return std::floor(a); });
+    break;
+  case OpCode::Ceil:
+    Transform(values, count, [](double a) { return std::ceil(a); });
+    break;
+  case OpCode::Sin:
+    Transform(values, count, [=](double a) { return std::sin(useDegrees ? a * toRadians : a); });
+    break;
+  case OpCode::Cos:
+    Transform(values, count, [=](double a) { return std::cos(useDegrees ? a * toRadians : a); });
+    break;
+  case OpCode::Tan:
+    Transform(values, count, [=](double a) { return std::tan(useDegrees ? a * toRadians : a); });
+    break;
+  case OpCode::ASin:
+    Transform(values, count, [=](double a) { return useDegrees ? std::asin(a) * toDegrees : std::asin(a); });
+    break;
+  case OpCode::ACos:
+    Transform(values, count, [=](double a) { return useDegrees ? std::acos(a) * toDegrees : std::acos(a); });
+    break;
+  case OpCode::ATan:
+    Transform(values, count, [=](double a) { return useDegrees ? std::atan(a) * toDegrees : std::atan(a); });
+    break;
+  default:
+    break;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+CalculatorProgram::CalculatorProgram() = default;
+
+// -----------------------------------------------------------------------------
+CalculatorProgram::~CalculatorProgram() = default;
+
+// -----------------------------------------------------------------------------
+CalculatorProgram::Pointer CalculatorProgram::Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees)
+{
+  Pointer program = Pointer(new CalculatorProgram());
+  program->m_UseDegrees = useDegrees;
+
+  std::vector<Instruction>& instructions = program->m_Instructions;
+  // Tracks for every value on the stack whether it is known while compiling
+  std::vector<bool> constantStack;
+  bool foundArray = false;
+
+  for(const auto& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    if(nullptr != calcArray)
+    {
+      IDataArray::Pointer source = calcArray->getSourceArray();
+      if(nullptr == source)
+      {
+        return nullptr;
+      }
+
+      Instruction instruction;
+      instruction.op = OpCode::Load;
+      instruction.load = GetLoadFunction(source);
+      instruction.data = source->getVoidPointer(0);
+      int component = calcArray->getSourceComponent();
+      instruction.stride = (component < 0) ? 1 : static_cast<size_t>(source->getNumberOfComponents());
+      instruction.offset = (component < 0) ? 0 : static_cast<size_t>(component);
+      if(nullptr == instruction.load || nullptr == instruction.data)
+      {
+        return nullptr;
+      }
+
+      if(calcArray->getType() == ICalculatorArray::Number)
+      {
+        // Numbers are read once and broadcast to every element
+        instruction.load(instruction.data, instruction.stride, instruction.offset, 0, 1, &instruction.value);
+        instruction.op = OpCode::Constant;
+        instruction.load = nullptr;
+        instruction.data = nullptr;
+        constantStack.push_back(true);
+      }
+      else
+      {
+        std::vector<size_t> cDims = calcArray->getComponentDimensions();
+        if(!foundArray)
+        {
+          program->m_NumTuples = source->getNumberOfTuples();
+          program->m_ComponentDims = cDims;
+          foundArray = true;
+        }
+        else if(program->m_NumTuples != source->getNumberOfTuples() || program->m_ComponentDims != cDims)
+        {
+          return nullptr;
+        }
+        constantStack.push_back(false);
+      }
+
+      instructions.push_back(instruction);
+      program->m_MaxDepth = std::max(program->m_MaxDepth, constantStack.size());
+      continue;
+    }
+
+    OpCode op = OpCode::Constant;
+    if(!FindOpCode(item, op))
+    {
+      return nullptr;
+    }
+
+    size_t numArgs = static_cast<size_t>(NumberOfArguments(op));
+    if(constantStack.size() < numArgs)
+    {
+      return nullptr;
+    }
+
+    bool allConstant = std::all_of(constantStack.end() - numArgs, constantStack.end(), [](bool isConstant) { return isConstant; });
+    constantStack.resize(constantStack.size() - numArgs + 1);
+    if(allConstant)
+    {
+      // The arguments were produced by the last instructions, so fold them into a single constant
+      if(numArgs == 2)
+      {
+        double rhs = instructions.back().value;
+        instructions.pop_back();
+        ApplyBinary(op, &instructions.back().value, &rhs, 1);
+      }
+      else
+      {
+        ApplyUnary(op, &instructions.back().value, 1, useDegrees);
+      }
+      continue;
+    }
+
+    constantStack.back() = false;
+    Instruction instruction;
+    instruction.op = op;
+    instructions.push_back(instruction);
+  }
+
+  if(constantStack.size() != 1)
+  {
+    return nullptr;
+  }
+
+  return program;
+}
+
+// -----------------------------------------------------------------------------
+const double* CalculatorProgram::evaluateBlock(double* registers, size_t start, size_t count) const
+{
+  size_t depth = 0;
+  for(const auto& instruction : m_Instructions)
+  {
+    switch(instruction.op)
+    {
+    case OpCode::Load:
+      instruction.load(instruction.data, instruction.stride, instruction.offset, start, count, registers + depth * k_BlockSize);
+      depth++;
+      break;
+    case OpCode::Constant:
+      std::fill(registers + depth * k_BlockSize, registers + depth * k_BlockSize + count, instruction.value);
+      depth++;
+      break;
+    default:
+      if(NumberOfArguments(instruction.op) == 2)
+      {
+        depth--;
+        ApplyBinary(instruction.op, registers + (depth - 1) * k_BlockSize, registers + depth * k_BlockSize, count);
+      }
+      else
+      {
+        ApplyUnary(instruction.op, registers + (depth - 1) * k_BlockSize, count, m_UseDegrees);
+      }
+      break;
+    }
+  }
+  return registers;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer CalculatorProgram::evaluate(const QString& name) const
+{
+  typename DataArray<T>::Pointer outputArray = DataArray<T>::CreateArray(m_NumTuples, m_ComponentDims, name, false);
+  if(outputArray->allocateUninitialized() < 0)
+  {
+    return nullptr;
+  }
+
+  T* output = outputArray->getPointer(0);
+  size_t numElements = outputArray->getSize();
+  size_t numBlocks = (numElements + k_BlockSize - 1) / k_BlockSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<double> registers(std::max(m_MaxDepth, static_cast<size_t>(1)) * k_BlockSize);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t start = block * k_BlockSize;
+      size_t count = std::min(k_BlockSize, numElements - start);
+      const double* result = evaluateBlock(registers.data(), start, count);
+      for(size_t i = 0; i < count; i++)
+      {
+        output[start + i] = static_cast<T>(result[i]);
+      }
+    }
+  });
+
+  return outputArray;
+}
+
+// -----------------------------------------------------------------------------
+IDataArray::Pointer CalculatorProgram::execute(SIMPL::ScalarTypes::Type scalarType, const QString& name) const
+{
+  switch(scalarType)
+  {
+  case SIMPL::ScalarTypes::Type::Int8:
+    return evaluate<int8_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt8:
+    return evaluate<uint8_t>(name);
+  case SIMPL::ScalarTypes::Type::Int16:
+    return evaluate<int16_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt16:
+    return evaluate<uint16_t>(name);
+  case SIMPL::ScalarTypes::Type::Int32:
+    return evaluate<int32_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt32:
+    return evaluate<uint32_t>(name);
+  case SIMPL::ScalarTypes::Type::Int64:
+    return evaluate<int64_t>(name);
+  case SIMPL::ScalarTypes::Type::UInt64:
+    return evaluate<uint64_t>(name);
+  case SIMPL::ScalarTypes::Type::Float:
+    return evaluate<float>(name);
+  case SIMPL::ScalarTypes::Type::Double:
+    return evaluate<double>(name);
+  case SIMPL::ScalarTypes::Type::Bool:
+    return evaluate<bool>(name);
+  default:
+    break;
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+size_t CalculatorProgram::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> CalculatorProgram::getComponentDimensions() const
+{
+  return m_ComponentDims;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<CalculatorProgram::Instruction>& CalculatorProgram::getInstructions() const
+{
+  return m_Instructions;
+}
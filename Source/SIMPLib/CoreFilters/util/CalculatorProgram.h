@@ -0,0 +1,175 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+#include "CalculatorItem.h"
+
+/**
+ * @brief The CalculatorProgram class compiles the RPN expression of the ArrayCalculator into a flat list of
+ * instructions and evaluates it in a single pass over the tuples. The elements are processed in blocks that
+ * stay in cache; every instruction runs over a whole block before the next one, which keeps the inner loops
+ * simple enough to vectorize. Input arrays are read in their native type and only the output array is allocated,
+ * instead of one double array per operator.
+ */
+class SIMPLib_EXPORT CalculatorProgram
+{
+public:
+  using Self = CalculatorProgram;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+
+  /**
+   * @brief Number of elements that are evaluated together
+   */
+  static constexpr size_t k_BlockSize = 1024;
+
+  enum class OpCode : uint8_t
+  {
+    Load,
+    Constant,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Pow,
+    Root,
+    Log,
+    Negate,
+    Abs,
+    Sqrt,
+    Exp,
+    Ln,
+    Log10,
+    Floor,
+    Ceil,
+    Sin,
+    Cos,
+    Tan,
+    ASin,
+    ACos,
+    ATan
+  };
+
+  /**
+   * @brief Converts count elements of a source array, starting at tuple start, to double
+   */
+  using LoadFunction = void (*)(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* output);
+
+  struct Instruction
+  {
+    OpCode op = OpCode::Constant;
+    LoadFunction load = nullptr;
+    const void* data = nullptr;
+    size_t stride = 1;
+    size_t offset = 0;
+    double value = 0.0;
+  };
+
+  /**
+   * @brief Compiles the RPN expression. Returns a null pointer if the expression contains an item the program
+   * can not represent, in which case the expression has to be evaluated with the operators themselves.
+   * @param rpn
+   * @param useDegrees True if the trigonometric operators use degrees
+   * @return
+   */
+  static Pointer Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees);
+
+  ~CalculatorProgram();
+
+  /**
+   * @brief Evaluates the program into a new array of the given scalar type. Returns a null pointer if the
+   * output array could not be allocated.
+   * @param scalarType
+   * @param name
+   * @return
+   */
+  IDataArrayShPtrType execute(SIMPL::ScalarTypes::Type scalarType, const QString& name) const;
+
+  /**
+   * @brief Returns the number of tuples of the result
+   * @return
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the component dimensions of the result
+   * @return
+   */
+  std::vector<size_t> getComponentDimensions() const;
+
+  /**
+   * @brief Returns the compiled instructions
+   * @return
+   */
+  const std::vector<Instruction>& getInstructions() const;
+
+protected:
+  CalculatorProgram();
+
+private:
+  std::vector<Instruction> m_Instructions;
+  size_t m_MaxDepth = 0;
+  size_t m_NumTuples = 1;
+  std::vector<size_t> m_ComponentDims = {1};
+  bool m_UseDegrees = false;
+
+  /**
+   * @brief Evaluates count elements starting at element start. The returned pointer points into registers.
+   * @param registers Scratch space of m_MaxDepth * k_BlockSize doubles
+   * @param start
+   * @param count
+   * @return
+   */
+  const double* evaluateBlock(double* registers, size_t start, size_t count) const;
+
+  template <typename T>
+  IDataArrayShPtrType evaluate(const QString& name) const;
+
+public:
+  CalculatorProgram(const CalculatorProgram&) = delete;            // Copy Constructor Not Implemented
+  CalculatorProgram(CalculatorProgram&&) = delete;                 // Move Constructor Not Implemented
+  CalculatorProgram& operator=(const CalculatorProgram&) = delete; // Copy Assignment Not Implemented
+  CalculatorProgram& operator=(CalculatorProgram&&) = delete;      // Move Assignment Not Implemented
+};
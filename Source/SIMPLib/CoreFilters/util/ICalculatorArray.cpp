@@ -45,6 +45,18 @@ ICalculatorArray::ICalculatorArray() = default;
 // -----------------------------------------------------------------------------
 ICalculatorArray::~ICalculatorArray() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> ICalculatorArray::getComponentDimensions()
+{
+  if(getSourceComponent() >= 0)
+  {
+    return std::vector<size_t>(1, 1);
+  }
+  return getSourceArray()->getComponentDimensions();
+}
+
 // -----------------------------------------------------------------------------
 ICalculatorArray::Pointer ICalculatorArray::NullPointer()
 {
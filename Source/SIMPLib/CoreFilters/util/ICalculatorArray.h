@@ -71,6 +71,33 @@ public:
 
   virtual DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) = 0;
 
+  /**
+   * @brief Returns a single component view of this item. The component is only copied to
+   * a double array if the legacy operator evaluation asks for its values.
+   * @param c
+   * @param allocate
+   * @return
+   */
+  virtual ICalculatorArray::Pointer selectComponent(int c, bool allocate = true) = 0;
+
+  /**
+   * @brief Returns the array this item reads its values from in its native type
+   * @return
+   */
+  virtual IDataArrayShPtrType getSourceArray() = 0;
+
+  /**
+   * @brief Returns the component of the source array this item reads or -1 if it reads all components
+   * @return
+   */
+  virtual int getSourceComponent() = 0;
+
+  /**
+   * @brief Returns the component dimensions of this item without converting its values to double
+   * @return
+   */
+  std::vector<size_t> getComponentDimensions();
+
 protected:
   ICalculatorArray();
 
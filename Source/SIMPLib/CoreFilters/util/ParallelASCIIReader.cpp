@@ -0,0 +1,403 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParallelASCIIReader.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+using Status = ParallelASCIIReader::Status;
+
+namespace
+{
+/**
+ * @brief Number of groups of chunks between two progress messages
+ */
+constexpr size_t k_NumProgressGroups = 20;
+
+using Token = std::pair<const char*, const char*>;
+
+struct LineResult
+{
+  Status status = Status::Success;
+  QString errorMessage;
+};
+
+/**
+ * @brief Tokenizes and parses single lines. One instance is shared by all threads, the token buffer is owned by the caller.
+ */
+class LineParser
+{
+public:
+  LineParser(const QList<char>& delimiters, int numColumns, int beginIndex, const QList<AbstractDataParser::Pointer>& parsers)
+  : m_HasDelimiters(!delimiters.isEmpty())
+  , m_NumColumns(numColumns)
+  , m_BeginIndex(beginIndex)
+  {
+    m_IsDelimiter.fill(false);
+    for(char delimiter : delimiters)
+    {
+      m_IsDelimiter[static_cast<uint8_t>(delimiter)] = true;
+    }
+    for(const AbstractDataParser::Pointer& parser : parsers)
+    {
+      m_Parsers.push_back(parser.get());
+      m_ColumnIndices.push_back(parser->getColumnIndex());
+    }
+  }
+
+  /**
+   * @brief Parses the line [first, last) into the given tuple. Returns false and fills result if the line is invalid.
+   */
+  bool parse(const char* first, const char* last, size_t tuple, std::vector<Token>& tokens, LineResult& result) const
+  {
+    if(last != first && *(last - 1) == '\r')
+    {
+      --last;
+    }
+
+    // Empty tokens are dropped, the same as StringOperations::TokenizeString
+    tokens.clear();
+    if(!m_HasDelimiters)
+    {
+      tokens.emplace_back(first, last);
+    }
+    else
+    {
+      const char* start = first;
+      for(const char* c = first; c != last; ++c)
+      {
+        if(m_IsDelimiter[static_cast<uint8_t>(*c)])
+        {
+          if(c != start)
+          {
+            tokens.emplace_back(start, c);
+          }
+          start = c + 1;
+        }
+      }
+      if(last != start)
+      {
+        tokens.emplace_back(start, last);
+      }
+    }
+
+    int64_t lineNum = static_cast<int64_t>(m_BeginIndex) + static_cast<int64_t>(tuple);
+    if(static_cast<size_t>(m_NumColumns) != tokens.size())
+    {
+      QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+      {
+        QTextStream out(&ss);
+        out << "Expecting " << m_NumColumns << " but found " << tokens.size() << "\n";
+        out << "Input line was:\n";
+        out << QString::fromUtf8(first, static_cast<int>(last - first));
+      }
+      result.status = Status::InconsistentColumns;
+      result.errorMessage = ss;
+      return false;
+    }
+
+    for(size_t i = 0; i < m_Parsers.size(); i++)
+    {
+      int32_t index = m_ColumnIndices[i];
+      ParserFunctor::ErrorObject obj = m_Parsers[i]->parse(tokens[index].first, tokens[index].second, tuple);
+      if(!obj.ok)
+      {
+        result.status = Status::ConversionFailure;
+        result.errorMessage = obj.errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  std::array<bool, 256> m_IsDelimiter = {};
+  bool m_HasDelimiters = false;
+  int m_NumColumns = 0;
+  int m_BeginIndex = 1;
+  std::vector<AbstractDataParser*> m_Parsers;
+  std::vector<int32_t> m_ColumnIndices;
+};
+
+/**
+ * @brief Returns the start of the line after the one that starts at first
+ */
+const char* NextLine(const char* first, const char* end, char lineBreak)
+{
+  const char* lineEnd = static_cast<const char*>(std::memchr(first, lineBreak, static_cast<size_t>(end - first)));
+  return (nullptr != lineEnd) ? lineEnd + 1 : end;
+}
+
+/**
+ * @brief Returns the character that ends the lines of the file: '\r' if the first line break is a lone carriage
+ * return (classic Mac OS files), '\n' otherwise. A trailing '\r' of a Windows line ending is stripped by the parser.
+ */
+char FindLineBreak(const char* first, const char* end)
+{
+  const char* lineBreak = std::find_if(first, end, [](char c) { return c == '\n' || c == '\r'; });
+  if(lineBreak != end && *lineBreak == '\r' && (lineBreak + 1 == end || *(lineBreak + 1) != '\n'))
+  {
+    return '\r';
+  }
+  return '\n';
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelASCIIReader::ParallelASCIIReader() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelASCIIReader::~ParallelASCIIReader() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelASCIIReader::Pointer ParallelASCIIReader::New()
+{
+  Pointer sharedPtr(new ParallelASCIIReader());
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setInputFilePath(const QString& value)
+{
+  m_InputFilePath = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setBeginIndex(int value)
+{
+  m_BeginIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setNumberOfLines(int value)
+{
+  m_NumberOfLines = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setNumberOfColumns(int value)
+{
+  m_NumberOfColumns = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setDelimiters(const QList<char>& value)
+{
+  m_Delimiters = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setParsers(const QList<AbstractDataParser::Pointer>& value)
+{
+  m_Parsers = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelASCIIReader::setChunkSize(size_t value)
+{
+  m_ChunkSize = std::max(value, static_cast<size_t>(1));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ParallelASCIIReader::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelASCIIReader::Status ParallelASCIIReader::execute(AbstractFilter* filter)
+{
+  m_ErrorMessage.clear();
+
+  QFile inputFile(m_InputFilePath);
+  if(!inputFile.open(QIODevice::ReadOnly) || inputFile.size() <= 0)
+  {
+    return Status::MappingFailed;
+  }
+  qint64 fileSize = inputFile.size();
+  uchar* mappedFile = inputFile.map(0, fileSize);
+  if(nullptr == mappedFile)
+  {
+    return Status::MappingFailed;
+  }
+  const char* fileBegin = reinterpret_cast<const char*>(mappedFile);
+  const char* fileEnd = fileBegin + fileSize;
+
+  // Skip a UTF-8 byte order mark the same way QTextStream does
+  if(fileSize >= 3 && std::memcmp(fileBegin, "\xEF\xBB\xBF", 3) == 0)
+  {
+    fileBegin += 3;
+  }
+
+  const char lineBreak = FindLineBreak(fileBegin, fileEnd);
+
+  // Skip to the first data line
+  const char* dataBegin = fileBegin;
+  for(int i = 1; i < m_BeginIndex && dataBegin != fileEnd; i++)
+  {
+    dataBegin = NextLine(dataBegin, fileEnd, lineBreak);
+  }
+
+  size_t numTuples = (m_NumberOfLines >= m_BeginIndex) ? static_cast<size_t>(m_NumberOfLines - m_BeginIndex + 1) : 0;
+
+  // Split the data into chunks that all end right after a line break
+  std::vector<const char*> chunkStarts;
+  for(const char* chunkStart = dataBegin; chunkStart != fileEnd;)
+  {
+    chunkStarts.push_back(chunkStart);
+    size_t remaining = static_cast<size_t>(fileEnd - chunkStart);
+    chunkStart = (remaining <= m_ChunkSize) ? fileEnd : NextLine(chunkStart + m_ChunkSize - 1, fileEnd, lineBreak);
+  }
+  size_t numChunks = chunkStarts.size();
+  chunkStarts.push_back(fileEnd);
+
+  // Count the lines of every chunk to find the tuple index of the first line of each chunk
+  std::vector<size_t> firstTuples(numChunks + 1, 0);
+  ParallelDataAlgorithm countAlg;
+  countAlg.setRange(0, numChunks);
+  countAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      firstTuples[chunk + 1] = static_cast<size_t>(std::count(chunkStarts[chunk], chunkStarts[chunk + 1], lineBreak));
+    }
+  });
+  if(numChunks > 0 && *(fileEnd - 1) != lineBreak)
+  {
+    // The last line does not end with a line break
+    firstTuples[numChunks]++;
+  }
+  std::partial_sum(firstTuples.begin(), firstTuples.end(), firstTuples.begin());
+  size_t numFileLines = firstTuples[numChunks];
+
+  // Only the chunks that contain one of the requested lines have to be parsed
+  size_t usedChunks = static_cast<size_t>(std::lower_bound(firstTuples.begin(), firstTuples.begin() + numChunks, numTuples) - firstTuples.begin());
+
+  LineParser lineParser(m_Delimiters, m_NumberOfColumns, m_BeginIndex, m_Parsers);
+  std::vector<LineResult> results(usedChunks);
+  size_t numGroups = std::min(usedChunks, k_NumProgressGroups);
+  for(size_t group = 0; group < numGroups; group++)
+  {
+    size_t groupBegin = usedChunks * group / numGroups;
+    size_t groupEnd = usedChunks * (group + 1) / numGroups;
+
+    ParallelDataAlgorithm parseAlg;
+    parseAlg.setRange(groupBegin, groupEnd);
+    parseAlg.execute([&](const SIMPLRange& range) {
+      std::vector<Token> tokens;
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        const char* chunkEnd = chunkStarts[chunk + 1];
+        size_t tuple = firstTuples[chunk];
+        for(const char* line = chunkStarts[chunk]; line != chunkEnd && tuple < numTuples; tuple++)
+        {
+          const char* nextLine = NextLine(line, chunkEnd, lineBreak);
+          const char* lineEnd = (nextLine != chunkEnd || *(nextLine - 1) == lineBreak) ? nextLine - 1 : nextLine;
+          if(!lineParser.parse(line, lineEnd, tuple, tokens, results[chunk]))
+          {
+            break;
+          }
+          line = nextLine;
+        }
+      }
+    });
+
+    // Report the error of the first line that failed
+    for(size_t chunk = groupBegin; chunk < groupEnd; chunk++)
+    {
+      if(results[chunk].status != Status::Success)
+      {
+        m_ErrorMessage = results[chunk].errorMessage;
+        return results[chunk].status;
+      }
+    }
+
+    if(nullptr != filter)
+    {
+      const double percentCompleted = 100.0 * static_cast<double>(groupEnd) / static_cast<double>(usedChunks);
+      filter->notifyStatusMessage(QObject::tr("Importing ASCII Data || %1% Complete").arg(percentCompleted, 0, 'f', 0));
+      if(filter->getCancel())
+      {
+        return Status::Canceled;
+      }
+    }
+  }
+
+  // A file that is shorter than expected reads as empty lines, which is what QTextStream::readLine() returns at the end of the file
+  std::vector<Token> tokens;
+  for(size_t tuple = numFileLines; tuple < numTuples; tuple++)
+  {
+    LineResult result;
+    if(!lineParser.parse(fileEnd, fileEnd, tuple, tokens, result))
+    {
+      m_ErrorMessage = result.errorMessage;
+      return result.status;
+    }
+  }
+
+  return Status::Success;
+}
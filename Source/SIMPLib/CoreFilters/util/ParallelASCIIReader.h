@@ -0,0 +1,155 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
+
+class AbstractFilter;
+
+/**
+ * @brief The ParallelASCIIReader class reads delimited ASCII files for ReadASCIIData. The file is memory mapped
+ * and split into chunks that end on a line break, which is a '\n' unless the file uses carriage returns alone. A first parallel pass counts the lines of every chunk so that
+ * each chunk knows the tuple index of its first line, a second parallel pass tokenizes the lines in place and
+ * hands the characters of every token to the locale free overloads of the column parsers, which write directly
+ * into the target arrays. Errors are reported for the first offending line of the file with the same messages
+ * as the line by line reader.
+ */
+class SIMPLib_EXPORT ParallelASCIIReader
+{
+public:
+  using Self = ParallelASCIIReader;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+
+  static Pointer New();
+
+  /**
+   * @brief Default number of bytes in a chunk
+   */
+  static constexpr size_t k_DefaultChunkSize = 4 * 1024 * 1024;
+
+  enum class Status : int32_t
+  {
+    Success,
+    MappingFailed,
+    InconsistentColumns,
+    ConversionFailure,
+    Canceled
+  };
+
+  ~ParallelASCIIReader();
+
+  /**
+   * @brief Sets the path of the file to read
+   * @param value
+   */
+  void setInputFilePath(const QString& value);
+
+  /**
+   * @brief Sets the 1 based line number of the first data line
+   * @param value
+   */
+  void setBeginIndex(int value);
+
+  /**
+   * @brief Sets the 1 based line number of the last data line
+   * @param value
+   */
+  void setNumberOfLines(int value);
+
+  /**
+   * @brief Sets the number of columns every data line must have
+   * @param value
+   */
+  void setNumberOfColumns(int value);
+
+  /**
+   * @brief Sets the characters that separate the columns
+   * @param value
+   */
+  void setDelimiters(const QList<char>& value);
+
+  /**
+   * @brief Sets the parsers of the columns that are imported
+   * @param value
+   */
+  void setParsers(const QList<AbstractDataParser::Pointer>& value);
+
+  /**
+   * @brief Sets the number of bytes of a chunk. Smaller chunks balance better, larger chunks have less overhead.
+   * @param value
+   */
+  void setChunkSize(size_t value);
+
+  /**
+   * @brief Reads the file. Progress messages are sent to the filter and the filter's cancel flag is checked
+   * between groups of chunks; filter may be a nullptr. MappingFailed means that nothing has been read and the file
+   * has to be read another way.
+   * @param filter
+   * @return
+   */
+  Status execute(AbstractFilter* filter);
+
+  /**
+   * @brief Returns the message of the error that stopped the last execute()
+   * @return
+   */
+  QString getErrorMessage() const;
+
+protected:
+  ParallelASCIIReader();
+
+private:
+  QString m_InputFilePath;
+  int m_BeginIndex = 1;
+  int m_NumberOfLines = 0;
+  int m_NumberOfColumns = 0;
+  QList<char> m_Delimiters;
+  QList<AbstractDataParser::Pointer> m_Parsers;
+  size_t m_ChunkSize = k_DefaultChunkSize;
+  QString m_ErrorMessage;
+
+public:
+  ParallelASCIIReader(const ParallelASCIIReader&) = delete;            // Copy Constructor Not Implemented
+  ParallelASCIIReader(ParallelASCIIReader&&) = delete;                 // Move Constructor Not Implemented
+  ParallelASCIIReader& operator=(const ParallelASCIIReader&) = delete; // Copy Assignment Not Implemented
+  ParallelASCIIReader& operator=(ParallelASCIIReader&&) = delete;      // Move Assignment Not Implemented
+};
@@ -30,6 +30,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 
@@ -54,6 +60,226 @@ public:
     bool ok = false;
     QString errorMessage;
   };
+
+protected:
+  /**
+   * @brief Returns true for the characters that QString treats as white space around a number
+   */
+  static bool IsWhitespace(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  /**
+   * @brief Removes leading and trailing white space from the token [first, last)
+   */
+  static void TrimWhitespace(const char*& first, const char*& last)
+  {
+    while(first != last && IsWhitespace(*first))
+    {
+      ++first;
+    }
+    while(last != first && IsWhitespace(*(last - 1)))
+    {
+      --last;
+    }
+  }
+
+  /**
+   * @brief Converts the whole token to an integer without going through QString or the locale. A leading sign
+   * is accepted like QString::toLongLong() does. A base of 0 picks the base from the prefix using the C
+   * conventions ("0x" for hexadecimal, a leading "0" for octal).
+   */
+  template <typename T>
+  static bool ToInteger(const char* first, const char* last, T& value, int base = 10)
+  {
+    TrimWhitespace(first, last);
+    bool negative = false;
+    if(first != last && (*first == '+' || *first == '-'))
+    {
+      negative = (*first == '-');
+      ++first;
+    }
+    if(base == 0)
+    {
+      base = 10;
+      if(last - first > 1 && first[0] == '0')
+      {
+        bool hex = (first[1] == 'x' || first[1] == 'X');
+        base = hex ? 16 : 8;
+        first += hex ? 2 : 1;
+      }
+    }
+    if(first == last || *first == '+' || *first == '-')
+    {
+      return false;
+    }
+
+    using UnsignedType = std::make_unsigned_t<T>;
+    UnsignedType magnitude = 0;
+    std::from_chars_result result = std::from_chars(first, last, magnitude, base);
+    if(result.ec != std::errc() || result.ptr != last)
+    {
+      return false;
+    }
+
+    if constexpr(std::is_signed<T>::value)
+    {
+      UnsignedType limit = static_cast<UnsignedType>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+      if(magnitude > limit)
+      {
+        return false;
+      }
+      value = negative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude);
+    }
+    else
+    {
+      if(negative)
+      {
+        return false;
+      }
+      value = magnitude;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Converts the whole token to a double without going through QString or the locale
+   */
+  static bool ToDouble(const char* first, const char* last, double& value)
+  {
+    TrimWhitespace(first, last);
+    if(first != last && *first == '+')
+    {
+      ++first;
+      if(first != last && *first == '-')
+      {
+        return false;
+      }
+    }
+    if(first == last)
+    {
+      return false;
+    }
+#if defined(__cpp_lib_to_chars)
+    std::from_chars_result result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+#else
+    bool ok = false;
+    value = QByteArray::fromRawData(first, static_cast<int>(last - first)).toDouble(&ok);
+    return ok;
+#endif
+  }
+
+  /**
+   * @brief Converts the whole token to a float with the same range checks as QString::toFloat()
+   */
+  static bool ToFloat(const char* first, const char* last, float& value)
+  {
+    double dValue = 0.0;
+    value = 0.0f;
+    if(!ToDouble(first, last, dValue))
+    {
+      return false;
+    }
+    if(std::isinf(dValue) || std::isnan(dValue))
+    {
+      value = static_cast<float>(dValue);
+      return true;
+    }
+    if(std::fabs(dValue) > static_cast<double>(std::numeric_limits<float>::max()))
+    {
+      return false;
+    }
+    value = static_cast<float>(dValue);
+    if(dValue != 0.0 && value == 0.0f)
+    {
+      // Underflow
+      value = 0.0f;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Shared implementation of the 8, 16 and 32 bit functors: values that are not integers are
+   * converted through double and cast, integers outside of the range of T are reported as out of range.
+   */
+  template <typename T>
+  static T ToSmallInteger(const char* first, const char* last, ErrorObject& obj, int base = 10)
+  {
+    using WideType = std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>;
+    WideType value = 0;
+    obj.ok = ToInteger(first, last, value, base);
+    if(obj.ok)
+    {
+      bool outOfRange = (value > static_cast<WideType>(std::numeric_limits<T>::max()));
+      if constexpr(std::is_signed<T>::value)
+      {
+        outOfRange = outOfRange || (value < static_cast<WideType>(std::numeric_limits<T>::min()));
+      }
+      if(outOfRange)
+      {
+        obj.ok = false;
+        obj.errorMessage = ParserErrorMessages::ValueOutOfRange;
+        return 0;
+      }
+      return static_cast<T>(value);
+    }
+
+    TrimWhitespace(first, last);
+    if(!std::is_signed<T>::value && first != last && *first == '-')
+    {
+      // This is a negative value, so fail
+      obj.errorMessage = ParserErrorMessages::ValueOutOfRange;
+      return 0;
+    }
+    // Try double
+    double dValue = 0.0;
+    obj.ok = ToDouble(first, last, dValue);
+    if(!obj.ok)
+    {
+      obj.errorMessage = ParserErrorMessages::CouldNotConvert;
+      return 0;
+    }
+    return static_cast<T>(dValue);
+  }
+
+  /**
+   * @brief Shared implementation of the 64 bit functors: only tokens with a decimal point are converted
+   * through double.
+   */
+  template <typename T>
+  static T ToLargeInteger(const char* first, const char* last, ErrorObject& obj)
+  {
+    T value = 0;
+    obj.ok = ToInteger(first, last, value);
+    if(obj.ok)
+    {
+      return value;
+    }
+
+    TrimWhitespace(first, last);
+    if(std::find(first, last, '.') != last)
+    {
+      double dValue = 0.0;
+      obj.ok = ToDouble(first, last, dValue);
+      if(obj.ok)
+      {
+        return static_cast<T>(dValue);
+      }
+      obj.errorMessage = ParserErrorMessages::CouldNotConvert;
+    }
+    else if(!std::is_signed<T>::value && first != last && *first == '-')
+    {
+      obj.errorMessage = ParserErrorMessages::ValueOutOfRange;
+    }
+    else
+    {
+      obj.errorMessage = ParserErrorMessages::CouldNotConvert;
+    }
+    return 0;
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -94,6 +320,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  int8_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToSmallInteger<int8_t>(first, last, obj, 0);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -136,6 +370,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  uint8_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToSmallInteger<uint8_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -176,6 +418,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  int16_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToSmallInteger<int16_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -224,6 +474,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  uint16_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToSmallInteger<uint16_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -264,6 +522,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  int32_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToSmallInteger<int32_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -312,6 +578,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  uint32_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToSmallInteger<uint32_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -346,6 +620,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  int64_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToLargeInteger<int64_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -384,6 +666,14 @@ public:
     }
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  uint64_t operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return ToLargeInteger<uint64_t>(first, last, obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -399,6 +689,16 @@ public:
     float value = token.toFloat(&obj.ok);
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  float operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    float value = 0.0f;
+    obj.ok = ToFloat(first, last, value);
+    return value;
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -414,6 +714,16 @@ public:
     double value = token.toDouble(&obj.ok);
     return value;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  double operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    double value = 0.0;
+    obj.ok = ToDouble(first, last, value);
+    return value;
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -428,4 +738,12 @@ public:
   {
     return token;
   }
+
+  /**
+   * @brief Locale free overload that converts the characters [first, last) of a memory mapped file
+   */
+  QString operator()(const char* first, const char* last, ErrorObject& obj)
+  {
+    return QString::fromUtf8(first, static_cast<int>(last - first));
+  }
 };
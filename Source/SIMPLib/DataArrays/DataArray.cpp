@@ -60,19 +60,46 @@
 #define SIMPL_BYTE_SWAP_64(x) bswap_64(x)
 #endif
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <mutex>
 #include <numeric>
 #include <string>
 
 #include <hdf5.h>
 
+#include "SIMPLib/DataArrays/TupleCompaction.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 namespace
 {
+// Fills below this many elements are not worth spreading across threads
+constexpr size_t k_ParallelFillThreshold = 1024 * 1024;
+
+// Byte swaps below this many elements are not worth spreading across threads
+constexpr size_t k_ParallelByteSwapThreshold = 256 * 1024;
+
+// -----------------------------------------------------------------------------
+// Fills [begin, end) with value. Large fills are split across threads so that each
+// page is first touched by a worker thread, which places it on that thread's NUMA node
+// when the memory was allocated uninitialized.
+template <typename T>
+void ParallelFill(T* data, size_t begin, size_t end, T value)
+{
+  if(end - begin < k_ParallelFillThreshold)
+  {
+    std::fill(data + begin, data + end, value);
+    return;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(begin, end);
+  dataAlg.execute([data, value](const SIMPLRange& range) { std::fill(data + range.min(), data + range.max(), value); });
+}
+
 // Can be replaced with std::bit_cast in C++ 20
 
 template <class To, class From, class = std::enable_if_t<(sizeof(To) == sizeof(From)) && std::is_trivially_copyable<From>::value && std::is_trivial<To>::value>>
@@ -118,6 +145,17 @@ T byteSwap(T value)
   return value;
 }
 
+// -----------------------------------------------------------------------------
+// Kept as a plain loop over contiguous values so the compiler can vectorize the swap
+template <typename T>
+void ByteSwapRange(T* data, size_t begin, size_t end)
+{
+  for(size_t i = begin; i < end; i++)
+  {
+    data[i] = byteSwap(data[i]);
+  }
+}
+
 } // namespace
 
 template <typename T>
@@ -212,6 +250,28 @@ DataArray<T>::DataArray(size_t numTuples, const QString& name, const comp_dims_t
 #endif
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+DataArray<T>::DataArray(const DataArray& other)
+: IDataArray(other)
+{
+  // The copy is member wise like a defaulted copy constructor, except that the load synchronization is not shared
+  std::lock_guard<std::mutex> lock(other.m_DeferredMutex);
+  m_Array = other.m_Array;
+  m_Size = other.m_Size;
+  m_Capacity = other.m_Capacity;
+  m_MaxId = other.m_MaxId;
+  m_NumTuples = other.m_NumTuples;
+  m_NumComponents = other.m_NumComponents;
+  m_InitValue = other.m_InitValue;
+  m_CompDims = other.m_CompDims;
+  m_IsAllocated = other.m_IsAllocated;
+  m_OwnsData = other.m_OwnsData;
+  m_StorageOptions = other.m_StorageOptions;
+  m_DeferredSource = other.m_DeferredSource;
+  m_DeferredState.store(other.m_DeferredState.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
 template <typename T>
 DataArray<T>::~DataArray()
 {
@@ -340,8 +400,8 @@ IDataArray::Pointer DataArray<T>::createNewArray(size_t numTuples, const comp_di
 template <typename T>
 typename DataArray<T>::Pointer DataArray<T>::FromQVector(const QVector<T>& vec, const QString& name)
 {
-  Pointer p = CreateArray(static_cast<size_t>(vec.size()), name, true);
-  if(nullptr != p)
+  Pointer p = CreateArray(static_cast<size_t>(vec.size()), name, false);
+  if(nullptr != p && p->allocateUninitialized() > 0)
   {
     std::copy(vec.cbegin(), vec.cend(), p->begin());
   }
@@ -353,8 +413,8 @@ template <typename T>
 typename DataArray<T>::Pointer DataArray<T>::FromStdVector(const std::vector<T>& vec, const QString& name)
 {
   comp_dims_type cDims = {1};
-  Pointer p = CreateArray(vec.size(), cDims, name, true);
-  if(nullptr != p)
+  Pointer p = CreateArray(vec.size(), cDims, name, false);
+  if(nullptr != p && p->allocateUninitialized() > 0)
   {
     std::copy(vec.cbegin(), vec.cend(), p->begin());
   }
@@ -365,8 +425,8 @@ typename DataArray<T>::Pointer DataArray<T>::FromStdVector(const std::vector<T>&
 template <typename T>
 typename DataArray<T>::Pointer DataArray<T>::CopyFromPointer(const T* data, size_t size, const QString& name)
 {
-  Pointer p = CreateArray(size, name, true);
-  if(nullptr != p)
+  Pointer p = CreateArray(size, name, false);
+  if(nullptr != p && p->allocateUninitialized() > 0)
   {
     std::copy(data, data + size, p->begin());
   }
@@ -392,6 +452,7 @@ typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTupl
 
   // Now set the internal array to the raw pointer
   d->m_Array = data;
+  d->m_Capacity = (nullptr != data) ? d->m_Size : 0;
   // Set who owns the data, i.e., who is going to "free" the memory
   d->m_OwnsData = ownsData;
   if(nullptr != data)
@@ -411,7 +472,20 @@ IDataArray::Pointer DataArray<T>::deepCopy(bool forceNoAllocate) const
   {
     allocate = false;
   }
-  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), allocate);
+  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+  daCopy->setH5StorageOptions(getH5StorageOptions());
+  daCopy->setStorageOptions(getStorageOptions());
+  // The copy holds the same values, so it can share the source instead of loading them now
+  std::shared_ptr<DeferredDataSource> source = getPendingDeferredSource();
+  if(nullptr != source && !forceNoAllocate)
+  {
+    daCopy->setDeferredSource(source);
+    return daCopy;
+  }
+  if(allocate && daCopy->allocateUninitialized() < 0)
+  {
+    return nullptr;
+  }
   if(m_IsAllocated && !forceNoAllocate)
   {
     std::copy(begin(), end(), daCopy->begin());
@@ -543,6 +617,7 @@ void DataArray<T>::getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision)
 template <typename T>
 bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
+  loadDeferred();
   if(!m_IsAllocated)
   {
     return false;
@@ -595,6 +670,7 @@ bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointe
 template <typename T>
 bool DataArray<T>::copyIntoArray(Pointer dest) const
 {
+  loadDeferred();
   if(m_IsAllocated && dest->isAllocated() && m_Array && dest->getPointer(0))
   {
     std::copy(cbegin(), cend(), dest->begin());
@@ -607,7 +683,7 @@ bool DataArray<T>::copyIntoArray(Pointer dest) const
 template <typename T>
 bool DataArray<T>::isAllocated() const
 {
-  return m_IsAllocated;
+  return m_IsAllocated || isDeferred();
 }
 
 // -----------------------------------------------------------------------------
@@ -628,6 +704,7 @@ void DataArray<T>::takeOwnership()
 template <typename T>
 void DataArray<T>::releaseOwnership()
 {
+  loadDeferred();
   m_OwnsData = false;
 }
 
@@ -635,6 +712,21 @@ void DataArray<T>::releaseOwnership()
 template <typename T>
 int32_t DataArray<T>::allocate()
 {
+  int32_t err = allocateUninitialized();
+  // A fresh mapping is already zero filled by the operating system. Heap memory is zeroed
+  // here, in parallel, so the first touch of each page happens on the worker threads.
+  if(err > 0 && m_IsAllocated && !DataArrayStorage::IsMapped(m_Array))
+  {
+    initializeWithZeros();
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::allocateUninitialized()
+{
+  dropDeferredSource();
   if((nullptr != m_Array) && m_OwnsData)
   {
     deallocate();
@@ -649,7 +741,8 @@ int32_t DataArray<T>::allocate()
   }
 
   size_t newSize = m_Size;
-  m_Array = new(std::nothrow) T[newSize]();
+  m_Array = m_StorageOptions.allocateUninitialized<T>(newSize);
+  m_Capacity = (nullptr != m_Array) ? newSize : 0;
   if(!m_Array)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -661,34 +754,220 @@ int32_t DataArray<T>::allocate()
   return 1;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::setStorageOptions(const DataArrayStorage& options)
+{
+  m_StorageOptions = options;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+DataArrayStorage DataArray<T>::getStorageOptions() const
+{
+  return m_StorageOptions;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::isMemoryMapped() const
+{
+  return DataArrayStorage::IsMapped(m_Array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::mapFromFile(const QString& filePath, uint64_t offset)
+{
+  // The mapping starts on a page boundary, so the first value is only aligned if the offset is
+  if(m_Size == 0 || offset % alignof(T) != 0)
+  {
+    return false;
+  }
+  T* mapped = static_cast<T*>(DataArrayStorage::MapFile(filePath, offset, m_Size * sizeof(T)));
+  if(nullptr == mapped)
+  {
+    return false;
+  }
+
+  if((nullptr != m_Array) && m_OwnsData)
+  {
+    deallocate();
+  }
+  dropDeferredSource();
+  m_Array = mapped;
+  m_Capacity = m_Size;
+  m_OwnsData = true;
+  m_IsAllocated = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::setDeferredSource(const std::shared_ptr<DeferredDataSource>& source)
+{
+  if((nullptr != m_Array) && m_OwnsData)
+  {
+    deallocate();
+  }
+  m_Array = nullptr;
+  m_Capacity = 0;
+  m_OwnsData = true;
+  m_IsAllocated = false;
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  m_DeferredSource = source;
+  m_DeferredState.store((nullptr != source) ? DeferredState::Pending : DeferredState::None, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::isDeferred() const
+{
+  return m_DeferredState.load(std::memory_order_acquire) == DeferredState::Pending;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::loadDeferredData()
+{
+  return loadDeferred();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::loadDeferredValues() const
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  // Another thread may have loaded the values while this one waited for the lock
+  DeferredState state = m_DeferredState.load(std::memory_order_relaxed);
+  if(state != DeferredState::Pending)
+  {
+    return state != DeferredState::Failed;
+  }
+
+  T* buffer = nullptr;
+  if(m_Size > 0)
+  {
+    buffer = m_StorageOptions.allocateUninitialized<T>(m_Size);
+    if(nullptr == buffer)
+    {
+      qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. ";
+      m_DeferredSource.reset();
+      m_DeferredState.store(DeferredState::Failed, std::memory_order_release);
+      return false;
+    }
+    if(!m_DeferredSource->readElements(buffer, 0, m_Size))
+    {
+      qDebug() << "Unable to read the values of " << getName() << " from " << m_DeferredSource->getDescription();
+      DataArrayStorage::Release(buffer);
+      m_DeferredSource.reset();
+      m_DeferredState.store(DeferredState::Failed, std::memory_order_release);
+      return false;
+    }
+  }
+
+  m_Array = buffer;
+  m_Capacity = m_Size;
+  m_IsAllocated = (nullptr != buffer);
+  // The source is released so that it no longer counts as a reader of its file
+  m_DeferredSource.reset();
+  // Stored last so that other threads only see the array as loaded once the values are in place
+  m_DeferredState.store(DeferredState::None, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::dropDeferredSource()
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  m_DeferredSource.reset();
+  m_DeferredState.store(DeferredState::None, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::shared_ptr<DeferredDataSource> DataArray<T>::getPendingDeferredSource() const
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  if(m_DeferredState.load(std::memory_order_relaxed) != DeferredState::Pending)
+  {
+    return nullptr;
+  }
+  return m_DeferredSource;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::readTuples(size_t startTuple, size_t numTuples, T* destination) const
+{
+  if(startTuple > m_NumTuples || numTuples > m_NumTuples - startTuple)
+  {
+    return false;
+  }
+  size_t startElement = startTuple * m_NumComponents;
+  size_t numElements = numTuples * m_NumComponents;
+
+  std::shared_ptr<DeferredDataSource> source = getPendingDeferredSource();
+  if(nullptr != source)
+  {
+    return source->readElements(destination, startElement, numElements);
+  }
+  if(nullptr == m_Array)
+  {
+    return false;
+  }
+  std::copy(m_Array + startElement, m_Array + startElement + numElements, destination);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::initializeWithZeros()
 {
+  // Every value is overwritten so there is no need to read them
+  if(isDeferred())
+  {
+    allocateUninitialized();
+  }
   if(!m_IsAllocated || nullptr == m_Array)
   {
     return;
   }
-  std::fill_n(m_Array, m_Size, 0);
+  ParallelFill(m_Array, 0, m_Size, static_cast<T>(0));
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::initializeWithValue(T initValue, size_t offset)
 {
+  if(isDeferred())
+  {
+    if(offset == 0)
+    {
+      allocateUninitialized();
+    }
+    else
+    {
+      loadDeferred();
+    }
+  }
   if(!m_IsAllocated || nullptr == m_Array)
   {
     return;
   }
-  std::fill(begin() + offset, end(), initValue);
+  if(offset >= m_Size)
+  {
+    return;
+  }
+  ParallelFill(m_Array, offset, m_Size, initValue);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
 {
-  int32_t err = 0;
-
   // If nothing is to be erased just return
   if(idxs.empty())
   {
@@ -711,92 +990,38 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
     }
   }
 
-  // Calculate the new size of the array to copy into
-  size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
-
-  // Create a new m_Array to copy into
-  T* newArray = new T[newSize]();
-
-#ifndef NDEBUG
-  // Splat AB across the array so we know if we are copying the values or not
-  std::memset(newArray, 0xAB, newSize * sizeof(T));
-#endif
+  std::vector<bool> removeMask;
+  TupleCompaction::MaskFromIndices(idxs, getNumberOfTuples(), removeMask);
+  return eraseTuplesByMask(removeMask);
+}
 
-  size_t j = 0;
-  size_t k = 0;
-  // Find the first chunk to copy by walking the idxs array until we get an
-  // index that is NOT a continuous increment from the start
-  for(k = 0; k < idxs.size(); ++k)
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t DataArray<T>::eraseTuplesByMask(const std::vector<bool>& removeMask)
+{
+  size_t numTuples = getNumberOfTuples();
+  if(removeMask.size() != numTuples)
   {
-    if(j == idxs[k])
-    {
-      ++j;
-    }
-    else
-    {
-      break;
-    }
+    return -100;
   }
-
-  // Only front elements are being dropped
-  if(k == idxs.size())
+  loadDeferred();
+  if(nullptr == m_Array)
   {
-    auto srcBegin = begin() + (j * m_NumComponents);
-    auto srcEnd = srcBegin + (getNumberOfTuples() - idxs.size()) * m_NumComponents;
-    std::copy(srcBegin, srcEnd, newArray);
-    // We are done copying - delete the current m_Array
-    deallocate();
-    m_Size = newSize;
-    m_Array = newArray;
-    m_OwnsData = true;
-    m_MaxId = newSize - 1;
-    m_IsAllocated = true;
+    size_t numRemoved = static_cast<size_t>(std::count(removeMask.begin(), removeMask.end(), true));
+    resizeTuples(numTuples - numRemoved);
     return 0;
   }
 
-  comp_dims_type srcIdx(idxs.size() + 1);
-  comp_dims_type destIdx(idxs.size() + 1);
-  comp_dims_type copyElements(idxs.size() + 1);
-  srcIdx[0] = 0;
-  destIdx[0] = 0;
-  copyElements[0] = (idxs[0] - 0) * m_NumComponents;
-
-  for(size_t i = 1; i < srcIdx.size(); ++i)
+  // Never compact memory that belongs to somebody else
+  if(!m_OwnsData && !reallocate(m_Size))
   {
-    srcIdx[i] = (idxs[i - 1] + 1) * m_NumComponents;
-
-    if(i < srcIdx.size() - 1)
-    {
-      copyElements[i] = (idxs[i] - idxs[i - 1] - 1) * m_NumComponents;
-    }
-    else
-    {
-      copyElements[i] = (getNumberOfTuples() - idxs[i - 1] - 1) * m_NumComponents;
-    }
-    destIdx[i] = copyElements[i - 1] + destIdx[i - 1];
+    return -101;
   }
 
-  // Copy the data
-  for(size_t i = 0; i < srcIdx.size(); ++i)
-  {
-    auto srcBegin = begin() + srcIdx[i];
-    auto srcEnd = srcBegin + copyElements[i];
-    auto dstBegin = newArray + destIdx[i];
-    std::copy(srcBegin, srcEnd, dstBegin);
-  }
-
-  // We are done copying - delete the current m_Array
-  deallocate();
-
-  // Allocation was successful.  Save it.
-  m_Size = newSize;
-  m_Array = newArray;
-  // This object has now allocated its memory and owns it.
-  m_OwnsData = true;
-  m_IsAllocated = true;
-  m_MaxId = newSize - 1;
-
-  return err;
+  size_t numKept = TupleCompaction::CompactInPlace(m_Array, numTuples, m_NumComponents, removeMask);
+  // Shrinking keeps the compacted block unless most of it is now unused
+  resizeTuples(numKept);
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -858,6 +1083,7 @@ void* DataArray<T>::getVoidPointer(size_t i)
   {
     return nullptr;
   }
+  loadDeferred();
 
   return reinterpret_cast<void*>(&(m_Array[i]));
 }
@@ -866,6 +1092,7 @@ void* DataArray<T>::getVoidPointer(size_t i)
 template <typename T>
 T* DataArray<T>::getPointer(size_t i) const
 {
+  loadDeferred();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -879,6 +1106,7 @@ T* DataArray<T>::getPointer(size_t i) const
 template <typename T>
 T DataArray<T>::getValue(size_t i) const
 {
+  loadDeferred();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -892,6 +1120,7 @@ T DataArray<T>::getValue(size_t i) const
 template <typename T>
 void DataArray<T>::setValue(size_t i, T value)
 {
+  loadDeferred();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -905,6 +1134,7 @@ void DataArray<T>::setValue(size_t i, T value)
 template <typename T>
 T DataArray<T>::getComponent(size_t i, int32_t j) const
 {
+  loadDeferred();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -918,6 +1148,7 @@ T DataArray<T>::getComponent(size_t i, int32_t j) const
 template <typename T>
 void DataArray<T>::setComponent(size_t i, int32_t j, T c)
 {
+  loadDeferred();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -971,6 +1202,7 @@ void DataArray<T>::initializeTuple(size_t i, const void* p)
 template <typename T>
 void DataArray<T>::fillTuple(size_t i, T value)
 {
+  loadDeferred();
   if(!m_IsAllocated)
   {
     return;
@@ -988,6 +1220,7 @@ void DataArray<T>::fillTuple(size_t i, T value)
 template <typename T>
 T* DataArray<T>::getTuplePointer(size_t tupleIndex) const
 {
+  loadDeferred();
 #ifndef NDEBUG
   if(m_Size > 0)
   {
@@ -1012,6 +1245,7 @@ void DataArray<T>::resizeTuples(size_t numTuples)
 template <typename T>
 void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
+  loadDeferred();
   int32_t precision = out.realNumberPrecision();
   if constexpr(std::is_same_v<T, float>)
   {
@@ -1037,6 +1271,7 @@ void DataArray<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 template <typename T>
 void DataArray<T>::printComponent(QTextStream& out, size_t i, int32_t j) const
 {
+  loadDeferred();
   out << m_Array[i * m_NumComponents + static_cast<size_t>(j)];
 }
 
@@ -1108,6 +1343,7 @@ QString DataArray<T>::getTypeAsString() const
 template <typename T>
 int32_t DataArray<T>::writeH5Data(hid_t parentId, const comp_dims_type& tDims) const
 {
+  loadDeferred();
   if(m_Array == nullptr)
   {
     return -85648;
@@ -1119,7 +1355,7 @@ int32_t DataArray<T>::writeH5Data(hid_t parentId, const comp_dims_type& tDims) c
 template <typename T>
 int32_t DataArray<T>::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
 {
-  if(m_Array == nullptr)
+  if(m_Array == nullptr && !isDeferred())
   {
     return -85648;
   }
@@ -1247,6 +1483,7 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
   }
   m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
   m_Size = p->getSize();
+  m_Capacity = m_Size;
   m_OwnsData = true;
   m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
   m_IsAllocated = true;
@@ -1265,32 +1502,54 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
 template <typename T>
 void DataArray<T>::byteSwapElements()
 {
-  for(auto& value : *this)
+  byteSwapElements(0, m_Size);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::byteSwapElements(size_t start, size_t count)
+{
+  loadDeferred();
+  if(sizeof(T) == 1 || nullptr == m_Array || start >= m_Size)
   {
-    value = byteSwap(value);
+    return;
   }
+  size_t end = start + std::min(count, m_Size - start);
+  T* data = m_Array;
+  if(end - start < k_ParallelByteSwapThreshold)
+  {
+    ByteSwapRange(data, start, end);
+    return;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(start, end);
+  dataAlg.execute([data](const SIMPLRange& range) { ByteSwapRange(data, range.min(), range.max()); });
 }
 
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::begin()
 {
+  loadDeferred();
   return iterator(m_Array);
 }
 
 template <typename T>
 typename DataArray<T>::iterator DataArray<T>::end()
 {
+  loadDeferred();
   return iterator(m_Array + m_Size);
 }
 
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::begin() const
 {
+  loadDeferred();
   return const_iterator(m_Array);
 }
 template <typename T>
 typename DataArray<T>::const_iterator DataArray<T>::end() const
 {
+  loadDeferred();
   return const_iterator(m_Array + m_Size);
 }
 
@@ -1345,24 +1604,28 @@ typename DataArray<T>::const_reverse_iterator DataArray<T>::crend() const
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleBegin()
 {
+  loadDeferred();
   return tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::tuple_iterator DataArray<T>::tupleEnd()
 {
+  loadDeferred();
   return tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::tupleBegin() const
 {
+  loadDeferred();
   return const_tuple_iterator(m_Array, m_NumComponents);
 }
 
 template <typename T>
 typename DataArray<T>::const_tuple_iterator DataArray<T>::tupleEnd() const
 {
+  loadDeferred();
   return const_tuple_iterator(m_Array + m_Size, m_NumComponents);
 }
 
@@ -1388,7 +1651,34 @@ typename DataArray<T>::size_type DataArray<T>::size() const
 template <typename T>
 typename DataArray<T>::size_type DataArray<T>::capacity() const noexcept
 {
-  return m_Size;
+  return m_Capacity;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::reserve(size_type newCapacity)
+{
+  if(newCapacity <= m_Capacity && (nullptr != m_Array || m_Size == 0))
+  {
+    return;
+  }
+  reallocate(std::max(newCapacity, m_Size));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::shrink_to_fit()
+{
+  if(nullptr == m_Array || m_Capacity == m_Size || !m_OwnsData)
+  {
+    return;
+  }
+  if(m_Size == 0)
+  {
+    clear();
+    return;
+  }
+  reallocate(m_Size);
 }
 
 template <typename T>
@@ -1420,29 +1710,43 @@ void DataArray<T>::assign(std::initializer_list<value_type> il) //  initializer
 template <typename T>
 void DataArray<T>::push_back(const value_type& val)
 {
-  resizeAndExtend(m_Size + 1);
+  if(nullptr == resizeAndExtend(m_Size + 1))
+  {
+    return;
+  }
   m_Array[m_MaxId] = val;
+  m_NumTuples = m_Size / m_NumComponents;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::push_back(value_type&& val)
 {
-  resizeAndExtend(m_Size + 1);
-  m_Array[m_MaxId] = val;
+  if(nullptr == resizeAndExtend(m_Size + 1))
+  {
+    return;
+  }
+  m_Array[m_MaxId] = std::move(val);
+  m_NumTuples = m_Size / m_NumComponents;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::pop_back()
 {
+  if(m_Size == 0)
+  {
+    return;
+  }
   resizeAndExtend(m_Size - 1);
+  m_NumTuples = m_Size / m_NumComponents;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void DataArray<T>::clear()
 {
+  dropDeferredSource();
   if(nullptr != m_Array && m_OwnsData)
   {
     deallocate();
@@ -1503,9 +1807,10 @@ void DataArray<T>::deallocate()
       }
 #endif
 
-  delete[](m_Array);
+  DataArrayStorage::Release(m_Array);
 
   m_Array = nullptr;
+  m_Capacity = 0;
   m_IsAllocated = false;
 }
 
@@ -1520,7 +1825,7 @@ int32_t DataArray<T>::resizeTotalElements(size_t size)
     return 1;
   }
   T* ptr = resizeAndExtend(size);
-  if(nullptr != ptr)
+  if(nullptr != ptr || isDeferred())
   {
     return 1;
   }
@@ -1531,17 +1836,13 @@ int32_t DataArray<T>::resizeTotalElements(size_t size)
 template <typename T>
 T* DataArray<T>::resizeAndExtend(size_t size)
 {
-  T* newArray = nullptr;
-  size_t newSize = 0;
-  size_t oldSize = 0;
-
   // Requested size is equal to current size.  Do nothing.
   if(size == m_Size)
   {
     return m_Array;
   }
-  newSize = size;
-  oldSize = m_Size;
+  size_t newSize = size;
+  size_t oldSize = m_Size;
 
   // Wipe out the array completely if new size is zero.
   if(newSize == 0)
@@ -1550,35 +1851,30 @@ T* DataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
 
-  newArray = new(std::nothrow) T[newSize]();
-  if(!newArray)
+  // The kept values have to be in memory before the array changes size
+  if(!loadDeferred())
   {
-    qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
     return nullptr;
   }
 
-  // Copy the data from the old array.
-  if(m_Array != nullptr)
-  {
-    auto srcBegin = begin();
-    auto srcEnd = srcBegin + (newSize < m_Size ? newSize : m_Size);
-    std::copy(srcBegin, srcEnd, newArray);
-  }
-
-  // Allocate a new array if we DO NOT own the current array
-  if((nullptr != m_Array) && m_OwnsData)
+  // Keep the current block if the new size fits. Shrinking below a quarter of the capacity gives
+  // the memory back so that arrays that are cut down a lot do not hold on to it.
+  bool fitsCapacity = (nullptr != m_Array) && m_OwnsData && newSize <= m_Capacity && newSize >= m_Capacity / 4;
+  if(!fitsCapacity)
   {
-    // Free the old array
-    deallocate();
+    size_t newCapacity = newSize;
+    if(nullptr != m_Array && newSize > oldSize)
+    {
+      // Grow geometrically so that appending a few tuples at a time is amortized O(1)
+      newCapacity = std::max(newSize, m_Capacity + m_Capacity / 2);
+    }
+    if(!reallocate(newCapacity))
+    {
+      return nullptr;
+    }
   }
 
-  // Allocation was successful.  Save it.
   m_Size = newSize;
-  m_Array = newArray;
-
-  // This object has now allocated its memory and owns it.
-  m_OwnsData = true;
-
   m_MaxId = newSize - 1;
   m_IsAllocated = true;
 
@@ -1591,6 +1887,43 @@ T* DataArray<T>::resizeAndExtend(size_t size)
   return m_Array;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+bool DataArray<T>::reallocate(size_t newCapacity)
+{
+  loadDeferred();
+  T* newArray = m_StorageOptions.allocateUninitialized<T>(newCapacity);
+  if(nullptr == newArray)
+  {
+    qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. ";
+    return false;
+  }
+
+  // Copy the data from the old array. Without an old array the kept range starts out as zeros.
+  size_t keptSize = std::min(m_Size, newCapacity);
+  if(nullptr != m_Array)
+  {
+    std::copy(m_Array, m_Array + keptSize, newArray);
+  }
+  else if(!DataArrayStorage::IsMapped(newArray))
+  {
+    ParallelFill(newArray, 0, keptSize, static_cast<T>(0));
+  }
+
+  // Only free the old array if we own it
+  if((nullptr != m_Array) && m_OwnsData)
+  {
+    deallocate();
+  }
+
+  // This object has now allocated its memory and owns it.
+  m_Array = newArray;
+  m_Capacity = newCapacity;
+  m_OwnsData = true;
+  m_IsAllocated = true;
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
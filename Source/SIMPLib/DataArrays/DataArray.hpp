@@ -36,9 +36,11 @@
 #pragma once
 
 // STL Includes
+#include <atomic>
 #include <cassert>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -48,6 +50,8 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
+#include "SIMPLib/DataArrays/DeferredDataSource.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 
 /**
@@ -82,7 +86,7 @@ public:
    */
   int32_t getClassVersion() const override;
 
-  DataArray(const DataArray&) = default;           // Copy Constructor default Implemented
+  DataArray(const DataArray& other);               // Copy Constructor Implemented
   DataArray(DataArray&&) = delete;                 // Move Constructor Not Implemented
   DataArray& operator=(const DataArray&) = delete; // Copy Assignment Not Implemented
   DataArray& operator=(DataArray&&) = delete;      // Move Assignment Not Implemented
@@ -328,6 +332,80 @@ public:
    */
   int32_t allocate();
 
+  /**
+   * @brief Allocates the memory needed for this class without initializing it. The caller is expected to
+   * write every element, e.g. when reading from a file or copying from another array.
+   * @return 1 on success, -1 on failure
+   */
+  int32_t allocateUninitialized();
+
+  /**
+   * @brief Sets where the memory of this array is allocated. The options take effect the next time the
+   * array allocates, e.g. on allocate() or a resize. Arrays that keep the default options follow
+   * DataArrayStorage::GetGlobalPolicy().
+   * @param options
+   */
+  void setStorageOptions(const DataArrayStorage& options);
+
+  /**
+   * @brief Returns the storage options of this array
+   * @return
+   */
+  DataArrayStorage getStorageOptions() const;
+
+  /**
+   * @brief Returns true if the memory of this array lives in a memory mapping instead of on the heap
+   * @return
+   */
+  bool isMemoryMapped() const;
+
+  /**
+   * @brief Replaces the memory of this array with a copy on write mapping of the file at filePath, starting at
+   * offset. The current size of the array is kept and the bytes are used exactly as they are stored in the file,
+   * so the file must hold getSize() values of type T in the byte order of this machine. Writes to the array
+   * never reach the file. This fails if the file can not be mapped or if offset is not a multiple of the
+   * alignment of T, in which case the array is left unchanged.
+   * @param filePath
+   * @param offset
+   * @return True if the array now maps the file
+   */
+  bool mapFromFile(const QString& filePath, uint64_t offset);
+
+  /**
+   * @brief Makes the values of this array come from source. Any memory held by the array is released and the
+   * values are read from the source the first time the memory is accessed, e.g. through getPointer(), an
+   * iterator, operator[] or getValue(). Reallocating or clearing the array before that drops the source.
+   * The source must supply getSize() values.
+   * @param source
+   * @return True
+   */
+  bool setDeferredSource(const std::shared_ptr<DeferredDataSource>& source) override;
+
+  /**
+   * @brief Returns true if the values of this array have not been read from their deferred source yet
+   * @return
+   */
+  bool isDeferred() const override;
+
+  /**
+   * @brief Reads the values of this array from its deferred source now. If the source fails the array stays
+   * unallocated and every later call returns false until the array is allocated again. Filters see the
+   * failure as an error when they look the array up with AttributeMatrix::getPrereqArray during execute.
+   * @return False if the values could not be read
+   */
+  bool loadDeferredData() override;
+
+  /**
+   * @brief Copies numTuples tuples, starting at startTuple, into destination. If the values of this array
+   * have not been loaded yet only the requested tuples are read from the deferred source and the array stays
+   * unloaded.
+   * @param startTuple
+   * @param numTuples
+   * @param destination Room for numTuples * getNumberOfComponents() values
+   * @return False if the range is out of bounds or could not be read
+   */
+  bool readTuples(size_t startTuple, size_t numTuples, T* destination) const;
+
   /**
    * @brief Sets all the values to zero.
    */
@@ -348,6 +426,13 @@ public:
    */
   int32_t eraseTuples(const comp_dims_type& idxs) override;
 
+  /**
+   * @brief Erases every tuple whose entry in removeMask is true by compacting the array in place.
+   * @param removeMask One entry per tuple
+   * @return 0 on success, -100 if the mask does not match the number of tuples
+   */
+  int32_t eraseTuplesByMask(const std::vector<bool>& removeMask) override;
+
   /**
    * @brief
    * @param currentPos
@@ -566,10 +651,17 @@ public:
   int32_t readH5Data(hid_t parentId) override;
 
   /**
-   * @brief
+   * @brief Reverses the byte order of every value in the array
    */
   void byteSwapElements();
 
+  /**
+   * @brief Reverses the byte order of the values [start, start + count). Large ranges are swapped in parallel.
+   * @param start
+   * @param count
+   */
+  void byteSwapElements(size_t start, size_t count);
+
   //========================================= STL INTERFACE COMPATIBILITY =================================
 
   class tuple_iterator
@@ -1078,10 +1170,27 @@ public:
 
   size_type size() const;
 
+  /**
+   * @brief Returns the number of elements that fit in the current allocation without reallocating
+   * @return
+   */
   size_type capacity() const noexcept;
   bool empty() const noexcept;
 
+  /**
+   * @brief Grows the allocation to hold at least newCapacity elements without changing the size
+   * @param newCapacity
+   */
+  void reserve(size_type newCapacity);
+
+  /**
+   * @brief Releases the part of the allocation that is beyond the current size
+   */
+  void shrink_to_fit();
+
   // ######### Element Access #########
+  // The element accessors do not load deferred values. Arrays are loaded once when their memory is handed out
+  // through getPointer(), data(), the iterators or AttributeMatrix::getPrereqArray().
 
   inline reference operator[](size_type index)
   {
@@ -1131,12 +1240,14 @@ public:
     return m_Array[m_MaxId];
   }
 
-  inline T* data() noexcept
+  inline T* data()
   {
+    loadDeferred();
     return m_Array;
   }
-  inline const T* data() const noexcept
+  inline const T* data() const
   {
+    loadDeferred();
     return m_Array;
   }
 
@@ -1232,16 +1343,71 @@ protected:
    */
   T* resizeAndExtend(size_t size);
 
+  /**
+   * @brief Moves the elements into a new allocation of newCapacity elements
+   * @param newCapacity
+   * @return false if the allocation failed
+   */
+  bool reallocate(size_t newCapacity);
+
+  /**
+   * @brief Reads the values from the deferred source if that has not happened yet. Every accessor that hands
+   * out the memory of the array calls this first; the single element accessors do not. Once the values are loaded this is a single atomic load.
+   * @return False if the values could not be read
+   */
+  inline bool loadDeferred() const
+  {
+    DeferredState state = m_DeferredState.load(std::memory_order_acquire);
+    if(state == DeferredState::Pending)
+    {
+      return loadDeferredValues();
+    }
+    return state != DeferredState::Failed;
+  }
+
+  /**
+   * @brief Reads the values from the deferred source. Only the first of several threads that get here
+   * reads them; the others wait on the array's mutex and then see the result.
+   * @return False if the values could not be read
+   */
+  bool loadDeferredValues() const;
+
+  /**
+   * @brief Forgets the deferred source, e.g. because the values are about to be overwritten
+   */
+  void dropDeferredSource();
+
+  /**
+   * @brief Returns the deferred source if the values have not been loaded yet, otherwise nullptr
+   * @return
+   */
+  std::shared_ptr<DeferredDataSource> getPendingDeferredSource() const;
+
 private:
-  T* m_Array = nullptr;
+  enum class DeferredState : uint8_t
+  {
+    None,
+    Pending,
+    Failed
+  };
+
+  // The allocation is filled in lazily by loadDeferredValues(), which may run from a const accessor. It is only
+  // written under m_DeferredMutex and published by storing m_DeferredState with release ordering.
+  mutable T* m_Array = nullptr;
   size_t m_Size = 0;
+  mutable size_t m_Capacity = 0;
   size_t m_MaxId = 0;
   size_t m_NumTuples = 0;
   size_t m_NumComponents = 1;
   T m_InitValue = static_cast<T>(0);
   comp_dims_type m_CompDims = {1};
-  bool m_IsAllocated = false;
+  mutable bool m_IsAllocated = false;
   bool m_OwnsData = true;
+  DataArrayStorage m_StorageOptions = {};
+  // Released by loadDeferredValues() once it is no longer needed, so it is only accessed under m_DeferredMutex
+  mutable std::shared_ptr<DeferredDataSource> m_DeferredSource = nullptr;
+  mutable std::atomic<DeferredState> m_DeferredState{DeferredState::None};
+  mutable std::mutex m_DeferredMutex;
 };
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,313 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayStorage.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryFile>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+struct MappedRegion
+{
+  size_t NumBytes = 0;
+  DataArrayStorage::Backend Backend = DataArrayStorage::Backend::AnonymousMap;
+  // The scratch file of a FileMap allocation or the input file of a MapFile() mapping
+  std::unique_ptr<QFile> File;
+};
+
+std::mutex s_PolicyMutex;
+DataArrayStorage s_GlobalPolicy = DataArrayStorage::Heap();
+
+std::mutex s_RegionMutex;
+std::map<const void*, MappedRegion> s_Regions;
+// Lets Release() skip the lock entirely while nothing is mapped, which is the common case
+std::atomic<size_t> s_NumRegions(0);
+
+// -----------------------------------------------------------------------------
+void* MapAnonymous(size_t numBytes)
+{
+#if defined(Q_OS_WIN)
+  return VirtualAlloc(nullptr, numBytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+  flags |= MAP_NORESERVE;
+#endif
+  void* ptr = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+  return (ptr == MAP_FAILED) ? nullptr : ptr;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+void UnmapAnonymous(void* ptr, size_t numBytes)
+{
+#if defined(Q_OS_WIN)
+  Q_UNUSED(numBytes)
+  VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+  munmap(ptr, numBytes);
+#endif
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+DataArrayStorage DataArrayStorage::Heap()
+{
+  DataArrayStorage options;
+  options.setBackend(Backend::Heap);
+  return options;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayStorage DataArrayStorage::AnonymousMap(size_t thresholdBytes)
+{
+  DataArrayStorage options;
+  options.setBackend(Backend::AnonymousMap);
+  options.setThresholdBytes(thresholdBytes);
+  return options;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayStorage DataArrayStorage::FileMap(const QString& scratchDirectory, size_t thresholdBytes)
+{
+  DataArrayStorage options;
+  options.setBackend(Backend::FileMap);
+  options.setScratchDirectory(scratchDirectory);
+  options.setThresholdBytes(thresholdBytes);
+  return options;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayStorage DataArrayStorage::GetGlobalPolicy()
+{
+  std::lock_guard<std::mutex> lock(s_PolicyMutex);
+  return s_GlobalPolicy;
+}
+
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetGlobalPolicy(const DataArrayStorage& policy)
+{
+  std::lock_guard<std::mutex> lock(s_PolicyMutex);
+  s_GlobalPolicy = policy;
+  if(s_GlobalPolicy.getBackend() == Backend::Default)
+  {
+    s_GlobalPolicy.setBackend(Backend::Heap);
+  }
+}
+
+// -----------------------------------------------------------------------------
+DataArrayStorage DataArrayStorage::resolve() const
+{
+  if(m_Backend == Backend::Default)
+  {
+    return GetGlobalPolicy();
+  }
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayStorage::Backend DataArrayStorage::resolveBackend(size_t numBytes) const
+{
+  DataArrayStorage options = resolve();
+  if(options.m_Backend == Backend::Default || numBytes == 0 || numBytes < options.m_ThresholdBytes)
+  {
+    return Backend::Heap;
+  }
+  return options.m_Backend;
+}
+
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::IsMapped(const void* ptr)
+{
+  if(s_NumRegions.load() == 0)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(s_RegionMutex);
+  return s_Regions.find(ptr) != s_Regions.end();
+}
+
+// -----------------------------------------------------------------------------
+void* DataArrayStorage::MapMemory(size_t numBytes, Backend backend, const QString& scratchDirectory)
+{
+  MappedRegion region;
+  region.NumBytes = numBytes;
+  region.Backend = backend;
+  void* ptr = nullptr;
+
+  if(backend == Backend::AnonymousMap)
+  {
+    ptr = MapAnonymous(numBytes);
+  }
+  else if(backend == Backend::FileMap)
+  {
+    QString dirPath = scratchDirectory.isEmpty() ? QDir::tempPath() : scratchDirectory;
+    QDir().mkpath(dirPath);
+    auto file = std::make_unique<QTemporaryFile>(QDir(dirPath).filePath("SIMPL_DataArray_XXXXXX.bin"));
+    if(file->open() && file->resize(static_cast<qint64>(numBytes)))
+    {
+      ptr = file->map(0, static_cast<qint64>(numBytes));
+    }
+    if(nullptr == ptr)
+    {
+      qDebug() << "Unable to map " << numBytes << " bytes in scratch file " << file->fileName() << ": " << file->errorString();
+    }
+    region.File = std::move(file);
+  }
+
+  if(nullptr == ptr)
+  {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(s_RegionMutex);
+  s_Regions[ptr] = std::move(region);
+  s_NumRegions++;
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+void* DataArrayStorage::MapFile(const QString& filePath, uint64_t offset, size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return nullptr;
+  }
+
+  MappedRegion region;
+  region.NumBytes = numBytes;
+  region.Backend = Backend::FileMap;
+  region.File = std::make_unique<QFile>(filePath);
+
+  // QFile takes care of aligning the offset to the page size and hands back a pointer to the first requested byte
+  void* ptr = nullptr;
+  if(region.File->open(QIODevice::ReadOnly))
+  {
+    ptr = region.File->map(static_cast<qint64>(offset), static_cast<qint64>(numBytes), QFileDevice::MapPrivateOption);
+  }
+  if(nullptr == ptr)
+  {
+    qDebug() << "Unable to map " << numBytes << " bytes of " << filePath << ": " << region.File->errorString();
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(s_RegionMutex);
+  s_Regions[ptr] = std::move(region);
+  s_NumRegions++;
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::UnmapMemory(void* ptr)
+{
+  if(s_NumRegions.load() == 0)
+  {
+    return false;
+  }
+
+  MappedRegion region;
+  {
+    std::lock_guard<std::mutex> lock(s_RegionMutex);
+    auto iter = s_Regions.find(ptr);
+    if(iter == s_Regions.end())
+    {
+      return false;
+    }
+    region = std::move(iter->second);
+    s_Regions.erase(iter);
+    s_NumRegions--;
+  }
+
+  if(region.Backend == Backend::FileMap)
+  {
+    // Closing a temporary file also removes it from the scratch directory
+    region.File->unmap(static_cast<uchar*>(ptr));
+    region.File->close();
+  }
+  else
+  {
+    UnmapAnonymous(ptr, region.NumBytes);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void DataArrayStorage::setBackend(Backend value)
+{
+  m_Backend = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayStorage::Backend DataArrayStorage::getBackend() const
+{
+  return m_Backend;
+}
+
+// -----------------------------------------------------------------------------
+void DataArrayStorage::setThresholdBytes(size_t value)
+{
+  m_ThresholdBytes = value;
+}
+
+// -----------------------------------------------------------------------------
+size_t DataArrayStorage::getThresholdBytes() const
+{
+  return m_ThresholdBytes;
+}
+
+// -----------------------------------------------------------------------------
+void DataArrayStorage::setScratchDirectory(const QString& value)
+{
+  m_ScratchDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString DataArrayStorage::getScratchDirectory() const
+{
+  return m_ScratchDirectory;
+}
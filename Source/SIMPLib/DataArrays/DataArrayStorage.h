@@ -0,0 +1,231 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DataArrayStorage class selects where the memory of a DataArray comes from. By default
+ * every array is allocated on the heap with new[], which is what DataArray has always done. Arrays can
+ * instead be placed in an anonymous memory mapping or in a mapping of a temporary file inside a scratch
+ * directory. A file mapping lets the operating system page the data out to disk, so volumes that are
+ * larger than the physical memory of the machine can be processed by filters that are unaware of it.
+ *
+ * The backend is chosen per array (DataArray::setStorageOptions) or, for arrays that do not carry their
+ * own options, by the process wide global policy. A threshold keeps small arrays on the heap.
+ *
+ * All mapped regions are tracked here so that Release() can tell a mapping from heap memory. This keeps
+ * DataArray::WrapPointer and releaseOwnership() working unchanged when the memory is passed between
+ * arrays: whoever frees the pointer last unmaps it.
+ */
+class SIMPLib_EXPORT DataArrayStorage
+{
+public:
+  enum class Backend : int32_t
+  {
+    Default = -1,     //!< Use the global policy
+    Heap = 0,         //!< new[] on the heap
+    AnonymousMap = 1, //!< Anonymous memory mapping. Pages are zero filled and only committed when touched
+    FileMap = 2       //!< Mapping of a temporary file in the scratch directory
+  };
+
+  DataArrayStorage() = default;
+  ~DataArrayStorage() = default;
+
+  DataArrayStorage(const DataArrayStorage&) = default;
+  DataArrayStorage(DataArrayStorage&&) noexcept = default;
+  DataArrayStorage& operator=(const DataArrayStorage&) = default;
+  DataArrayStorage& operator=(DataArrayStorage&&) noexcept = default;
+
+  /**
+   * @brief Creates options that allocate on the heap
+   * @return
+   */
+  static DataArrayStorage Heap();
+
+  /**
+   * @brief Creates options that place arrays of at least thresholdBytes in an anonymous memory mapping
+   * @param thresholdBytes
+   * @return
+   */
+  static DataArrayStorage AnonymousMap(size_t thresholdBytes = 0);
+
+  /**
+   * @brief Creates options that place arrays of at least thresholdBytes in a mapped temporary file
+   * @param scratchDirectory Directory for the temporary files. Empty uses the system temporary directory.
+   * @param thresholdBytes
+   * @return
+   */
+  static DataArrayStorage FileMap(const QString& scratchDirectory = QString(), size_t thresholdBytes = 0);
+
+  /**
+   * @brief Returns the options used by arrays that do not carry their own options
+   * @return
+   */
+  static DataArrayStorage GetGlobalPolicy();
+
+  /**
+   * @brief Sets the options used by arrays that do not carry their own options. Only allocations made
+   * after this call are affected.
+   * @param policy
+   */
+  static void SetGlobalPolicy(const DataArrayStorage& policy);
+
+  /**
+   * @brief Returns these options if they specify a backend, otherwise the global policy
+   * @return
+   */
+  DataArrayStorage resolve() const;
+
+  /**
+   * @brief Returns the backend that an allocation of numBytes would use
+   * @param numBytes
+   * @return
+   */
+  Backend resolveBackend(size_t numBytes) const;
+
+  /**
+   * @brief Allocates numElements value initialized elements. Mapped memory is zero filled by the operating
+   * system, which is the value initialized state of the arithmetic types stored in a DataArray.
+   * @param numElements
+   * @return The new memory or nullptr if the allocation failed
+   */
+  template <typename T>
+  T* allocate(size_t numElements) const
+  {
+    DataArrayStorage options = resolve();
+    Backend backend = options.resolveBackend(numElements * sizeof(T));
+    if(backend == Backend::Heap)
+    {
+      return new(std::nothrow) T[numElements]();
+    }
+    return static_cast<T*>(MapMemory(numElements * sizeof(T), backend, options.getScratchDirectory()));
+  }
+
+  /**
+   * @brief Allocates numElements elements without initializing them. Use this when every element is written
+   * right away, e.g. by a reader or a copy, so the pages are only touched once. Heap memory holds
+   * indeterminate values, mapped memory is zero filled by the operating system.
+   * @param numElements
+   * @return The new memory or nullptr if the allocation failed
+   */
+  template <typename T>
+  T* allocateUninitialized(size_t numElements) const
+  {
+    DataArrayStorage options = resolve();
+    Backend backend = options.resolveBackend(numElements * sizeof(T));
+    if(backend == Backend::Heap)
+    {
+      return new(std::nothrow) T[numElements];
+    }
+    return static_cast<T*>(MapMemory(numElements * sizeof(T), backend, options.getScratchDirectory()));
+  }
+
+  /**
+   * @brief Frees memory that was returned by allocate() or created with new[]
+   * @param ptr
+   */
+  template <typename T>
+  static void Release(T* ptr)
+  {
+    if(nullptr != ptr && !UnmapMemory(ptr))
+    {
+      delete[] ptr;
+    }
+  }
+
+  /**
+   * @brief Maps numBytes of an existing file, starting at offset, as copy on write memory. The file is
+   * not modified: pages are read from the file when first touched and a private copy is made of every
+   * page that is written. The offset does not need to be page aligned. The returned memory is released
+   * with Release() like any other mapping. The file must not be truncated while it is mapped.
+   * @param filePath
+   * @param offset Byte offset of the first mapped byte in the file
+   * @param numBytes
+   * @return The mapped memory or nullptr if the file could not be mapped
+   */
+  static void* MapFile(const QString& filePath, uint64_t offset, size_t numBytes);
+
+  /**
+   * @brief Returns true if ptr is the start of a mapped region created by allocate() or MapFile()
+   * @param ptr
+   * @return
+   */
+  static bool IsMapped(const void* ptr);
+
+  /**
+   * @brief Setter property for Backend
+   */
+  void setBackend(Backend value);
+  /**
+   * @brief Getter property for Backend
+   * @return Value of Backend
+   */
+  Backend getBackend() const;
+
+  /**
+   * @brief Setter property for ThresholdBytes. Allocations smaller than this stay on the heap.
+   */
+  void setThresholdBytes(size_t value);
+  /**
+   * @brief Getter property for ThresholdBytes
+   * @return Value of ThresholdBytes
+   */
+  size_t getThresholdBytes() const;
+
+  /**
+   * @brief Setter property for ScratchDirectory
+   */
+  void setScratchDirectory(const QString& value);
+  /**
+   * @brief Getter property for ScratchDirectory
+   * @return Value of ScratchDirectory
+   */
+  QString getScratchDirectory() const;
+
+private:
+  static void* MapMemory(size_t numBytes, Backend backend, const QString& scratchDirectory);
+  static bool UnmapMemory(void* ptr);
+
+  Backend m_Backend = Backend::Default;
+  size_t m_ThresholdBytes = 0;
+  QString m_ScratchDirectory = {};
+};
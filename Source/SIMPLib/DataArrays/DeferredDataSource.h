@@ -0,0 +1,79 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DeferredDataSource class is the interface a DataArray uses to fetch its values when they
+ * are not in memory yet. A DataArray that is given a source (DataArray::setDeferredSource) only records
+ * its type and dimensions. The values are read the first time the memory of the array is accessed, or
+ * only a range of tuples is read when DataArray::readTuples is called before that.
+ *
+ * Sources read raw values of the array type in the element order of the DataArray.
+ */
+class SIMPLib_EXPORT DeferredDataSource
+{
+public:
+  using Pointer = std::shared_ptr<DeferredDataSource>;
+
+  DeferredDataSource() = default;
+  virtual ~DeferredDataSource() = default;
+
+  DeferredDataSource(const DeferredDataSource&) = delete;            // Copy Constructor Not Implemented
+  DeferredDataSource(DeferredDataSource&&) = delete;                 // Move Constructor Not Implemented
+  DeferredDataSource& operator=(const DeferredDataSource&) = delete; // Copy Assignment Not Implemented
+  DeferredDataSource& operator=(DeferredDataSource&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Reads numElements values, starting at element startElement, into buffer
+   * @param buffer Destination with room for numElements values
+   * @param startElement
+   * @param numElements
+   * @return False if the values could not be read
+   */
+  virtual bool readElements(void* buffer, size_t startElement, size_t numElements) const = 0;
+
+  /**
+   * @brief Returns a human readable description of where the values come from, used in error messages
+   * @return
+   */
+  virtual QString getDescription() const = 0;
+};
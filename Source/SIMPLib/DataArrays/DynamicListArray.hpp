@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -44,7 +45,11 @@
 #include "SIMPLib/SIMPLib.h"
 
 /**
- * @brief
+ * @brief DynamicListArray stores a variable length list of K values for each of
+ * its entries (e.g., the elements that share a vertex). All of the lists live in a
+ * single compressed sparse row buffer: the list for entry i starts where the list
+ * for entry i-1 ends. Each ElementList is a view (count + pointer) into that buffer,
+ * so callers that index the lists directly do not need to know about the layout.
  */
 template <typename T, typename K>
 class DynamicListArray
@@ -99,22 +104,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "ElementList" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -125,6 +115,15 @@ public:
     return m_Size;
   }
 
+  /**
+   * @brief Returns the sum of the lengths of all the lists.
+   * @return
+   */
+  size_t getTotalNumberOfElements() const
+  {
+    return m_NumElements;
+  }
+
   /**
    * @brief deepCopy
    * @param forceNoAllocate
@@ -145,13 +144,15 @@ public:
     {
       linkCounts[ptId] = this->m_Array[ptId].ncells;
     }
-    // Allocate all that in the copy
+    // Allocate all that in the copy. Lists that were resized may sit anywhere in this buffer, so they are copied
+    // one by one; the copy gets them back to back again.
     copy->allocateLists(linkCounts);
-    // Copy the data from the original to the new
     for(size_t ptId = 0; ptId < m_Size; ptId++)
     {
-      ElementList& elementList = getElementList(ptId);
-      copy->setElementList(ptId, elementList);
+      if(linkCounts[ptId] > 0)
+      {
+        ::memcpy(copy->m_Array[ptId].cells, m_Array[ptId].cells, sizeof(K) * linkCounts[ptId]);
+      }
     }
     return copy;
   }
@@ -178,7 +179,10 @@ public:
   }
 
   /**
-   * @brief setElementList
+   * @brief Copies nCells values from data into the list for ptId. A list that
+   * gets shorter keeps its slot, a list that gets longer moves to the free space
+   * at the end of the buffer, which grows geometrically when it runs out. Callers
+   * that fill many lists should still size them up front with allocateLists().
    * @param ptId
    * @param nCells
    * @param data
@@ -190,16 +194,14 @@ public:
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+    if(m_Array[ptId].ncells != nCells)
     {
-      delete[] this->m_Array[ptId].cells;
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      resizeList(ptId, nCells);
+    }
+    if(nCells > 0)
+    {
+      ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
     }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
     return true;
   }
 
@@ -211,23 +213,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      delete[] this->m_Array[ptId].cells;
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -251,44 +237,75 @@ public:
   }
 
   /**
-   * @brief deserializeLinks
+   * @brief Reads the serialized layout written by GeometryHelpers::GeomIO::WriteDynamicListToHDF5,
+   * which is, for each entry, the number of cells (as a T) followed by the cell ids (as K).
    * @param buffer
    * @param nElements
    */
   void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
   {
+    std::vector<T> linkCounts(nElements, 0);
+    uint8_t* bufPtr = buffer.data();
+
+    // First pass gathers the list sizes so the flat buffer can be allocated once
     size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      T ncells = 0;
+      ::memcpy(&ncells, bufPtr + offset, sizeof(T));
+      linkCounts[i] = ncells;
+      offset += sizeof(T) + ncells * sizeof(K);
+    }
+
+    allocateLists(linkCounts);
 
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
+    // Second pass copies each list into its slot in the flat buffer
+    offset = 0;
     for(size_t i = 0; i < nElements; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      offset += sizeof(T);
+      T ncells = linkCounts[i];
+      if(ncells > 0)
+      {
+        ::memcpy(this->m_Array[i].cells, bufPtr + offset, ncells * sizeof(K));
+      }
+      offset += ncells * sizeof(K);
     }
   }
 
   /**
-   * @brief
+   * @brief Allocates one list per entry in linkCounts, each sized to hold the
+   * matching count. All lists share a single buffer whose contents are left
+   * uninitialized.
    * @param linkCounts
    */
   template <typename Container>
   void allocateLists(const Container& linkCounts)
   {
     allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+
+    size_t total = 0;
+    for(size_t i = 0; i < m_Size; i++)
+    {
+      total += static_cast<size_t>(linkCounts[i]);
+    }
+    m_NumElements = total;
+    m_BufferSize = total;
+    m_BufferCapacity = total;
+    if(total > 0)
     {
-      this->m_Array[i].ncells = linkCounts[i];
-      if(linkCounts[i] > 0)
+      m_Buffer.reset(new K[total]);
+    }
+
+    size_t offset = 0;
+    for(size_t i = 0; i < m_Size; i++)
+    {
+      T count = linkCounts[i];
+      this->m_Array[i].ncells = count;
+      if(count > 0)
       {
-        this->m_Array[i].cells = new K[this->m_Array[i].ncells];
+        this->m_Array[i].cells = m_Buffer.get() + offset;
+        offset += count;
       }
     }
   }
@@ -297,29 +314,20 @@ protected:
   DynamicListArray() = default;
 
   //----------------------------------------------------------------------------
-  // This will allocate memory to hold all the NeighborList structures where each
+  // This will allocate memory to hold all the ElementList structures where each
   // structure is initialized to Zero Entries and a nullptr Pointer
   void allocate(size_t sz)
   {
     static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
 
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "ElementList" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
+    m_Buffer.reset();
+    m_NumElements = 0;
+    m_BufferSize = 0;
+    m_BufferCapacity = 0;
 
     this->m_Size = sz;
     // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
+    this->m_Array.reset(new typename DynamicListArray<T, K>::ElementList[sz]);
 
     // Initialize each structure to have 0 entries and nullptr pointer.
     for(size_t i = 0; i < sz; i++)
@@ -328,9 +336,68 @@ protected:
     }
   }
 
+  //----------------------------------------------------------------------------
+  // Resizes the list for ptId to nCells, keeping as many of its values as fit.
+  // Shrinking happens in place. Growing moves the list to the end of the used
+  // part of the buffer, so resizing n lists one after the other costs O(n)
+  // amortized instead of rebuilding the whole buffer every time.
+  void resizeList(size_t ptId, T nCells)
+  {
+    ElementList& list = m_Array[ptId];
+    const size_t oldCount = static_cast<size_t>(list.ncells);
+    const size_t newCount = static_cast<size_t>(nCells);
+    m_NumElements = m_NumElements - oldCount + newCount;
+    if(newCount <= oldCount)
+    {
+      list.ncells = nCells;
+      list.cells = (newCount > 0) ? list.cells : nullptr;
+      return;
+    }
+
+    if(m_BufferSize + newCount > m_BufferCapacity)
+    {
+      // Compacting drops the space left behind by moved and shrunk lists. Doubling the live size keeps the
+      // number of reallocations logarithmic in the number of resizes.
+      reserveBuffer(2 * (m_NumElements + oldCount));
+    }
+    K* cells = m_Buffer.get() + m_BufferSize;
+    if(oldCount > 0)
+    {
+      ::memcpy(cells, list.cells, sizeof(K) * oldCount);
+    }
+    list.cells = cells;
+    list.ncells = nCells;
+    m_BufferSize += newCount;
+  }
+
+  //----------------------------------------------------------------------------
+  // Moves all lists back to back into a new buffer that can hold capacity values
+  void reserveBuffer(size_t capacity)
+  {
+    std::unique_ptr<K[]> buffer(new K[capacity]);
+    size_t offset = 0;
+    for(size_t i = 0; i < m_Size; i++)
+    {
+      const size_t count = static_cast<size_t>(m_Array[i].ncells);
+      if(count > 0)
+      {
+        ::memcpy(buffer.get() + offset, m_Array[i].cells, sizeof(K) * count);
+        m_Array[i].cells = buffer.get() + offset;
+        offset += count;
+      }
+    }
+    m_Buffer = std::move(buffer);
+    m_BufferSize = offset;
+    m_BufferCapacity = capacity;
+  }
+
 private:
-  ElementList* m_Array = nullptr; // pointer to data
+  std::unique_ptr<ElementList[]> m_Array; // one view per entry into m_Buffer
+  std::unique_ptr<K[]> m_Buffer;          // all of the lists, back to back until some are resized
   size_t m_Size = 0;
+  size_t m_NumElements = 0;    // sum of the list lengths
+  size_t m_BufferSize = 0;     // used part of m_Buffer, including the space left behind by resized lists
+  size_t m_BufferCapacity = 0; // allocated size of m_Buffer
 };
 
 typedef DynamicListArray<int32_t, int32_t> Int32Int32DynamicListArray;
@@ -38,6 +38,51 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::setDeferredSource(const std::shared_ptr<DeferredDataSource>& source)
+{
+  Q_UNUSED(source)
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::isDeferred() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::loadDeferredData()
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t IDataArray::eraseTuplesByMask(const std::vector<bool>& removeMask)
+{
+  if(removeMask.size() != getNumberOfTuples())
+  {
+    return -100;
+  }
+  std::vector<size_t> idxs;
+  for(size_t i = 0; i < removeMask.size(); i++)
+  {
+    if(removeMask[i])
+    {
+      idxs.push_back(i);
+    }
+  }
+  return eraseTuples(idxs);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -48,6 +93,22 @@ DataArrayPath IDataArray::getDataArrayPath() const
   return path;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::setH5StorageOptions(const H5StorageOptions& options)
+{
+  m_H5StorageOptions = options;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5StorageOptions IDataArray::getH5StorageOptions() const
+{
+  return m_H5StorageOptions;
+}
+
 // -----------------------------------------------------------------------------
 IDataArray::Pointer IDataArray::NullPointer()
 {
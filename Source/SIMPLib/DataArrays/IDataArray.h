@@ -23,9 +23,11 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/IDataStructureNode.h"
+#include "SIMPLib/HDF5/H5StorageOptions.h"
 #include "SIMPLib/Utilities/ToolTipGenerator.h"
 
 class IDataArray;
+class DeferredDataSource;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
 
 /**
@@ -90,6 +92,27 @@ public:
    */
   virtual bool isAllocated() const = 0;
 
+  /**
+   * @brief Attaches a source that supplies the values of this array on demand. Arrays that can load their
+   * values lazily override this; the default implementation refuses the source.
+   * @param source
+   * @return True if the array now reads its values from the source
+   */
+  virtual bool setDeferredSource(const std::shared_ptr<DeferredDataSource>& source);
+
+  /**
+   * @brief Returns true if the values of this array have not been read from their deferred source yet
+   * @return
+   */
+  virtual bool isDeferred() const;
+
+  /**
+   * @brief Reads the values of this array from its deferred source now. Does nothing if the array has
+   * no deferred source.
+   * @return False if the values could not be read
+   */
+  virtual bool loadDeferredData();
+
   /**
    * @brief Makes this class responsible for freeing the memory.
    */
@@ -148,6 +171,14 @@ public:
    */
   virtual int32_t eraseTuples(const std::vector<size_t>& idxs) = 0;
 
+  /**
+   * @brief Erases every tuple whose entry in removeMask is true. The default implementation converts the
+   * mask to a list of indices; the array classes override it to compact their storage in place.
+   * @param removeMask One entry per tuple
+   * @return 0 on success, -100 if the mask does not match the number of tuples
+   */
+  virtual int32_t eraseTuplesByMask(const std::vector<bool>& removeMask);
+
   /**
    * @brief Copies a Tuple from one position to another.
    * @param currentPos The index of the source data
@@ -256,6 +287,20 @@ public:
    */
   virtual int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const = 0;
 
+  /**
+   * @brief Sets the HDF5 storage layout (contiguous or chunked + compressed) that is used when
+   * this array is written to an HDF5 file. An array whose layout is H5StorageOptions::Layout::Default
+   * uses the default of the enclosing writer (e.g. the DataContainerWriter).
+   * @param options
+   */
+  void setH5StorageOptions(const H5StorageOptions& options);
+
+  /**
+   * @brief getH5StorageOptions
+   * @return
+   */
+  H5StorageOptions getH5StorageOptions() const;
+
   /**
    * @brief readH5Data
    * @param parentId
@@ -296,6 +341,8 @@ public:
 
 protected:
 private:
+  H5StorageOptions m_H5StorageOptions = {};
+
   IDataArray(const IDataArray&);     // Not Implemented
   void operator=(const IDataArray&); // Not Implemented
 };
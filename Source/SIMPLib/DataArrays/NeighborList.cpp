@@ -1,5 +1,8 @@
 #include "NeighborList.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <QtCore/QMap>
 #include <QtCore/QTextStream>
 
@@ -12,6 +15,7 @@ using namespace H5Support;
 #include "SIMPLib/Common/Constants.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/TupleCompaction.hpp"
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -307,7 +311,7 @@ int NeighborList<T>::eraseTuples(const std::vector<size_t>& idxs)
     return 0;
   }
 
-  size_t arraySize = m_Array.size();
+  size_t arraySize = static_cast<size_t>(getNumberOfLists());
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
   for(std::vector<size_t>::size_type i = 0; i < idxs.size(); ++i)
@@ -318,35 +322,60 @@ int NeighborList<T>::eraseTuples(const std::vector<size_t>& idxs)
     }
   }
 
-  std::vector<SharedVectorType> replacement(arraySize - idxsSize);
+  std::vector<bool> removeMask;
+  TupleCompaction::MaskFromIndices(idxs, arraySize, removeMask);
+  err = eraseTuplesByMask(removeMask);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t NeighborList<T>::eraseTuplesByMask(const std::vector<bool>& removeMask)
+{
+  size_t arraySize = static_cast<size_t>(getNumberOfLists());
+  if(removeMask.size() != arraySize)
+  {
+    return -100;
+  }
 
-  size_t idxsIndex = 0;
-  size_t rIdx = 0;
-  for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+  if(m_UseFlatStorage)
   {
-    if(dIdx != idxs[idxsIndex])
-    {
-      replacement[rIdx] = m_Array[dIdx];
-      ++rIdx;
-    }
-    else
+    // Only the slots move; the values of the removed lists become unused arena space
+    for(size_t i = 0; i < arraySize; i++)
     {
-      ++idxsIndex;
-      if(idxsIndex == idxsSize)
+      if(removeMask[i])
       {
-        idxsIndex--;
+        m_FlatUnused += m_FlatSlots[i].capacity;
       }
     }
+    size_t numKept = TupleCompaction::CompactInPlace(m_FlatSlots.begin(), arraySize, 1, removeMask);
+    m_FlatSlots.resize(numKept);
+    if(m_FlatUnused > 1024 && m_FlatUnused * 2 > m_FlatValues.size())
+    {
+      compactFlatStorage();
+    }
+    m_NumTuples = m_FlatSlots.size();
+    return 0;
   }
-  m_Array = replacement;
+
+  size_t numKept = TupleCompaction::CompactInPlace(m_Array.begin(), arraySize, 1, removeMask);
+  m_Array.resize(numKept);
   m_NumTuples = m_Array.size();
-  return err;
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 int NeighborList<T>::copyTuple(size_t currentPos, size_t newPos)
 {
+  if(m_UseFlatStorage)
+  {
+    size_t count = m_FlatSlots[currentPos].size;
+    reserveFlatSlot(newPos, count, 0);
+    std::copy_n(m_FlatValues.begin() + m_FlatSlots[currentPos].offset, count, m_FlatValues.begin() + m_FlatSlots[newPos].offset);
+    m_FlatSlots[newPos].size = static_cast<uint32_t>(count);
+    return 0;
+  }
   m_Array[newPos] = m_Array[currentPos];
   return 0;
 }
@@ -359,7 +388,8 @@ bool NeighborList<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
   {
     return false;
   }
-  if(destTupleOffset >= m_Array.size())
+  size_t numLists = static_cast<size_t>(getNumberOfLists());
+  if(destTupleOffset >= numLists)
   {
     return false;
   }
@@ -384,14 +414,30 @@ bool NeighborList<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPoi
     return false;
   }
 
-  if(totalSrcTuples * sourceArray->getNumberOfComponents() + destTupleOffset * getNumberOfComponents() > m_Array.size())
+  if(totalSrcTuples * sourceArray->getNumberOfComponents() + destTupleOffset * getNumberOfComponents() > numLists)
   {
     return false;
   }
 
   for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getList(i);
+    int srcId = static_cast<int>(i);
+    if(m_UseFlatStorage)
+    {
+      size_t count = static_cast<size_t>(source->getListSize(srcId));
+      reserveFlatSlot(destTupleOffset + i, count, 0);
+      std::copy_n(source->getListPointer(srcId), count, m_FlatValues.begin() + m_FlatSlots[destTupleOffset + i].offset);
+      m_FlatSlots[destTupleOffset + i].size = static_cast<uint32_t>(count);
+    }
+    else if(source->m_UseFlatStorage)
+    {
+      const T* values = source->getListPointer(srcId);
+      m_Array[destTupleOffset + i] = SharedVectorType(new VectorType(values, values + source->getListSize(srcId)));
+    }
+    else
+    {
+      m_Array[destTupleOffset + i] = source->getList(srcId);
+    }
   }
   return true;
 
@@ -435,6 +481,14 @@ template <typename T>
 size_t NeighborList<T>::getSize() const
 {
   size_t total = 0;
+  if(m_UseFlatStorage)
+  {
+    for(const FlatSlot& slot : m_FlatSlots)
+    {
+      total += slot.size;
+    }
+    return total;
+  }
   for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
   {
     total += m_Array[dIdx]->size();
@@ -488,6 +542,9 @@ template <typename T>
 void NeighborList<T>::initializeWithZeros()
 {
   m_Array.clear();
+  m_FlatSlots.clear();
+  m_FlatValues.clear();
+  m_FlatUnused = 0;
   m_IsAllocated = false;
 }
 
@@ -502,8 +559,19 @@ IDataArray::Pointer NeighborList<T>::deepCopy(bool forceNoAllocate) const
   }
 
   typename NeighborList<T>::Pointer daCopyPtr = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), allocate);
+  daCopyPtr->setUseFlatStorage(m_UseFlatStorage);
 
-  if(m_IsAllocated && !forceNoAllocate)
+  if(m_IsAllocated && !forceNoAllocate && m_UseFlatStorage)
+  {
+    daCopyPtr->m_FlatSlots = m_FlatSlots;
+    daCopyPtr->m_FlatValues = m_FlatValues;
+    daCopyPtr->m_FlatUnused = m_FlatUnused;
+    if(m_FlatUnused > 0)
+    {
+      daCopyPtr->compactFlatStorage();
+    }
+  }
+  else if(m_IsAllocated && !forceNoAllocate)
   {
     size_t count = (m_IsAllocated ? getNumberOfTuples() : 0);
     for(size_t i = 0; i < count; i++)
@@ -520,6 +588,18 @@ template <typename T>
 int32_t NeighborList<T>::resizeTotalElements(size_t size)
 {
   // std::cout << "NeighborList::resizeTotalElements(" << size << ")" << std::endl;
+  if(m_UseFlatStorage)
+  {
+    // Lists past the new end leave their capacity behind as unused arena space
+    for(size_t i = size; i < m_FlatSlots.size(); ++i)
+    {
+      m_FlatUnused += m_FlatSlots[i].capacity;
+    }
+    m_FlatSlots.resize(size);
+    m_NumTuples = size;
+    m_IsAllocated = (size != 0);
+    return 1;
+  }
   size_t old = m_Array.size();
   m_Array.resize(size);
   m_NumTuples = size;
@@ -551,13 +631,13 @@ void NeighborList<T>::resizeTuples(size_t numTuples)
 template <typename T>
 void NeighborList<T>::printTuple(QTextStream& out, size_t i, char delimiter) const
 {
-  SharedVectorType sharedVec = m_Array[i];
-  VectorType* vec = sharedVec.get();
-  size_t size = vec->size();
+  int grainId = static_cast<int>(i);
+  const T* values = getListPointer(grainId);
+  size_t size = static_cast<size_t>(getListSize(grainId));
   out << size;
   for(size_t j = 0; j < size; j++)
   {
-    out << delimiter << vec->at(j);
+    out << delimiter << values[j];
   }
 }
 
@@ -587,14 +667,23 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
     numNeighborsArrayName = getName() + "_NumNeighbors";
   }
 
-  Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), numNeighborsArrayName, true);
+  size_t numLists = static_cast<size_t>(getNumberOfLists());
+  Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, numNeighborsArrayName, true);
   int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
   size_t total = 0;
-  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  // In flat storage the arena can be written as is when the lists are back to back and in order
+  bool arenaIsFlat = m_UseFlatStorage;
+  for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
   {
-    numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
-    total += m_Array[dIdx]->size();
+    size_t nEle = static_cast<size_t>(getListSize(static_cast<int>(dIdx)));
+    numNeighbors[dIdx] = static_cast<int32_t>(nEle);
+    if(m_UseFlatStorage && m_FlatSlots[dIdx].offset != total && nEle > 0)
+    {
+      arenaIsFlat = false;
+    }
+    total += nEle;
   }
+  arenaIsFlat = arenaIsFlat && (m_FlatValues.size() == total);
 
   // Check to see if the NumNeighbors is already written to the file
   bool rewrite = false;
@@ -607,7 +696,7 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
   {
     // The NumNeighbors array is in the dream3d file so read it up into memory and compare with what
     // we have in memory.
-    std::vector<int32_t> fileNumNeigh(m_Array.size());
+    std::vector<int32_t> fileNumNeigh(numLists);
     err = H5Lite::readVectorDataset(parentId, numNeighborsArrayName.toStdString(), fileNumNeigh);
     if(err < 0)
     {
@@ -638,21 +727,26 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
   // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
   // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
   // is complete.
-  QVector<T> flat(total);
-  size_t currentStart = 0;
-  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  std::vector<T> flat;
+  const T* flatData = m_FlatValues.data();
+  if(!arenaIsFlat)
   {
-    size_t nEle = m_Array[dIdx]->size();
-    if(nEle == 0)
+    flat.resize(total);
+    flatData = flat.data();
+    size_t currentStart = 0;
+    for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
     {
-      continue;
-    }
-    T* start = m_Array[dIdx]->data(); // get theNeighborList<T>::Pointer to the front of the array
-    //    T* end = start + nEle; // get theNeighborList<T>::Pointer to the end of the array
-    T* dst = flat.data() + currentStart;
-    ::memcpy(dst, start, nEle * sizeof(T));
+      size_t nEle = static_cast<size_t>(getListSize(static_cast<int>(dIdx)));
+      if(nEle == 0)
+      {
+        continue;
+      }
+      const T* start = getListPointer(static_cast<int>(dIdx)); // get the pointer to the front of the list
+      T* dst = flat.data() + currentStart;
+      ::memcpy(dst, start, nEle * sizeof(T));
 
-    currentStart += m_Array[dIdx]->size();
+      currentStart += nEle;
+    }
   }
 
   // Now we can actually write the actual array data.
@@ -660,7 +754,7 @@ int NeighborList<T>::writeH5Data(hid_t parentId, const std::vector<size_t>& tDim
   hsize_t dims[1] = {total};
   if(total > 0)
   {
-    err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flat.data());
+    err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flatData);
     if(err < 0)
     {
       return -605;
@@ -771,8 +865,8 @@ QString NeighborList<T>::getInfoString(SIMPL::InfoStringFormat format) const
     QString compDimStr = "(variable)";
 
     ss << "+ Comp. Dims: " << compDimStr << "\n";
-    ss << "+ Total Elements:  " << m_Array.size() << "\n";
-    ss << "+ Minimum Memory: " << (m_Array.size() * sizeof(T)) << "\n";
+    ss << "+ Total Elements:  " << getNumberOfLists() << "\n";
+    ss << "+ Minimum Memory: " << (getNumberOfLists() * sizeof(T)) << "\n";
   }
   return info;
 }
@@ -823,6 +917,31 @@ int NeighborList<T>::readH5Data(hid_t parentId)
 
   // int32_t totalElements = std::accumulate(numNeighbors.begin(), numNeighbors.end(), 0);
 
+  if(m_UseFlatStorage)
+  {
+    // The file layout is already the flat layout so the data is adopted as the arena
+    m_FlatSlots.resize(numNeighbors.size());
+    size_t offset = 0;
+    for(size_t dIdx = 0; dIdx < numNeighbors.size(); ++dIdx)
+    {
+      uint32_t nEle = static_cast<uint32_t>(numNeighbors[dIdx]);
+      m_FlatSlots[dIdx].offset = offset;
+      m_FlatSlots[dIdx].size = nEle;
+      m_FlatSlots[dIdx].capacity = nEle;
+      offset += nEle;
+    }
+    if(offset > flat.size())
+    {
+      return -704;
+    }
+    m_FlatValues.swap(flat);
+    m_FlatValues.resize(offset);
+    m_FlatUnused = 0;
+    m_IsAllocated = true;
+    m_NumTuples = m_FlatSlots.size();
+    return err;
+  }
+
   // Loop over all the entries and make new Vectors to hold the incoming data
   m_Array.resize(numNeighbors.size());
   m_IsAllocated = true;
@@ -854,6 +973,27 @@ int NeighborList<T>::readH5Data(hid_t parentId)
 template <typename T>
 void NeighborList<T>::addEntry(int grainId, T value)
 {
+  if(m_UseFlatStorage)
+  {
+    if(grainId >= static_cast<int>(m_FlatSlots.size()))
+    {
+      m_FlatSlots.resize(grainId + 1);
+      m_IsAllocated = true;
+    }
+    size_t count = m_FlatSlots[grainId].size;
+    if(count == m_FlatSlots[grainId].capacity)
+    {
+      reserveFlatSlot(grainId, std::max<size_t>(4, count * 2), count);
+    }
+    m_FlatValues[m_FlatSlots[grainId].offset + count] = value;
+    m_FlatSlots[grainId].size++;
+    m_NumTuples = m_FlatSlots.size();
+    if(m_FlatUnused > 1024 && m_FlatUnused * 2 > m_FlatValues.size())
+    {
+      compactFlatStorage();
+    }
+    return;
+  }
   if(grainId >= static_cast<int>(m_Array.size()))
   {
     size_t old = m_Array.size();
@@ -874,6 +1014,9 @@ template <typename T>
 void NeighborList<T>::clearAllLists()
 {
   m_Array.clear();
+  m_FlatSlots.clear();
+  m_FlatValues.clear();
+  m_FlatUnused = 0;
   m_IsAllocated = false;
 }
 
@@ -881,6 +1024,26 @@ void NeighborList<T>::clearAllLists()
 template <typename T>
 void NeighborList<T>::setList(int grainId, SharedVectorType neighborList)
 {
+  if(m_UseFlatStorage)
+  {
+    if(grainId >= static_cast<int>(m_FlatSlots.size()))
+    {
+      m_FlatSlots.resize(grainId + 1);
+      m_IsAllocated = true;
+    }
+    size_t count = (nullptr != neighborList) ? neighborList->size() : 0;
+    reserveFlatSlot(grainId, count, 0);
+    if(count > 0)
+    {
+      std::copy(neighborList->begin(), neighborList->end(), m_FlatValues.begin() + m_FlatSlots[grainId].offset);
+    }
+    m_FlatSlots[grainId].size = static_cast<uint32_t>(count);
+    if(m_FlatUnused > 1024 && m_FlatUnused * 2 > m_FlatValues.size())
+    {
+      compactFlatStorage();
+    }
+    return;
+  }
   if(grainId >= static_cast<int>(m_Array.size()))
   {
     size_t old = m_Array.size();
@@ -900,24 +1063,27 @@ template <typename T>
 T NeighborList<T>::getValue(int grainId, int index, bool& ok) const
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0u)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+    Q_ASSERT(grainId < getNumberOfLists());
   }
 #endif
-  SharedVectorType vec = m_Array[grainId];
-  if(index < 0 || static_cast<size_t>(index) >= vec->size())
+  if(index < 0 || index >= getListSize(grainId))
   {
     ok = false;
     return -1;
   }
-  return (*vec)[index];
+  return getListPointer(grainId)[index];
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 int NeighborList<T>::getNumberOfLists() const
 {
+  if(m_UseFlatStorage)
+  {
+    return static_cast<int>(m_FlatSlots.size());
+  }
   return static_cast<int>(m_Array.size());
 }
 
@@ -926,11 +1092,15 @@ template <typename T>
 int NeighborList<T>::getListSize(int grainId) const
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0u)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+    Q_ASSERT(grainId < getNumberOfLists());
   }
 #endif
+  if(m_UseFlatStorage)
+  {
+    return static_cast<int>(m_FlatSlots[grainId].size);
+  }
   return static_cast<int>(m_Array[grainId]->size());
 }
 
@@ -939,11 +1109,12 @@ template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int grainId) const
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0u)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+    Q_ASSERT(grainId < getNumberOfLists());
   }
 #endif
+  requireNestedStorage("getListReference()");
   return *(m_Array[grainId]);
 }
 
@@ -952,11 +1123,12 @@ template <typename T>
 typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int grainId) const
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0u)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+    Q_ASSERT(grainId < getNumberOfLists());
   }
 #endif
+  requireNestedStorage("getList()");
   return m_Array[grainId];
 }
 
@@ -965,12 +1137,17 @@ template <typename T>
 typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int grainId) const
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0u)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+    Q_ASSERT(grainId < getNumberOfLists());
   }
 #endif
 
+  if(m_UseFlatStorage)
+  {
+    const T* values = getListPointer(grainId);
+    return VectorType(values, values + m_FlatSlots[grainId].size);
+  }
   VectorType copy(*(m_Array[grainId]));
   return copy;
 }
@@ -980,11 +1157,12 @@ template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](int grainId)
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0u)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < static_cast<int>(m_Array.size()));
+    Q_ASSERT(grainId < getNumberOfLists());
   }
 #endif
+  requireNestedStorage("operator[]");
   return *(m_Array[grainId]);
 }
 
@@ -993,14 +1171,218 @@ template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](size_t grainId)
 {
 #ifndef NDEBUG
-  if(m_Array.size() > 0ul)
+  if(getNumberOfLists() > 0)
   {
-    Q_ASSERT(grainId < m_Array.size());
+    Q_ASSERT(grainId < static_cast<size_t>(getNumberOfLists()));
   }
 #endif
+  requireNestedStorage("operator[]");
   return *(m_Array[grainId]);
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::setUseFlatStorage(bool flat)
+{
+  if(flat == m_UseFlatStorage)
+  {
+    return;
+  }
+  if(flat)
+  {
+    convertToFlatStorage();
+  }
+  else
+  {
+    convertToNestedStorage();
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool NeighborList<T>::getUseFlatStorage() const
+{
+  return m_UseFlatStorage;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* NeighborList<T>::getListPointer(int grainId) const
+{
+#ifndef NDEBUG
+  if(getNumberOfLists() > 0)
+  {
+    Q_ASSERT(grainId < getNumberOfLists());
+  }
+#endif
+  if(m_UseFlatStorage)
+  {
+    const FlatSlot& slot = m_FlatSlots[grainId];
+    return (slot.size > 0) ? m_FlatValues.data() + slot.offset : nullptr;
+  }
+  return m_Array[grainId]->empty() ? nullptr : m_Array[grainId]->data();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename NeighborList<T>::ListSpan NeighborList<T>::getListSpan(int grainId) const
+{
+  return ListSpan(getListPointer(grainId), static_cast<size_t>(getListSize(grainId)));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::setValue(int grainId, int index, T value)
+{
+  Q_ASSERT(index >= 0 && index < getListSize(grainId));
+  if(m_UseFlatStorage)
+  {
+    m_FlatValues[m_FlatSlots[grainId].offset + index] = value;
+    return;
+  }
+  (*m_Array[grainId])[index] = value;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::resizeList(int grainId, size_t size)
+{
+  if(m_UseFlatStorage)
+  {
+    if(grainId >= static_cast<int>(m_FlatSlots.size()))
+    {
+      m_FlatSlots.resize(grainId + 1);
+      m_NumTuples = m_FlatSlots.size();
+      m_IsAllocated = true;
+    }
+    size_t count = m_FlatSlots[grainId].size;
+    reserveFlatSlot(grainId, size, std::min(count, size));
+    if(size > count)
+    {
+      std::fill_n(m_FlatValues.begin() + m_FlatSlots[grainId].offset + count, size - count, m_InitValue);
+    }
+    m_FlatSlots[grainId].size = static_cast<uint32_t>(size);
+    return;
+  }
+  if(grainId >= static_cast<int>(m_Array.size()))
+  {
+    size_t old = m_Array.size();
+    m_Array.resize(grainId + 1);
+    m_IsAllocated = true;
+    // Initialize with zero length Vectors
+    for(size_t i = old; i < m_Array.size(); ++i)
+    {
+      m_Array[i] = SharedVectorType(new VectorType);
+    }
+    m_NumTuples = m_Array.size();
+  }
+  m_Array[grainId]->resize(size, m_InitValue);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::requireNestedStorage(const char* accessor) const
+{
+  if(m_UseFlatStorage)
+  {
+    throw std::logic_error(QString("NeighborList '%1': %2 is not available in flat storage. Use getListSpan() or call setUseFlatStorage(false) first.").arg(getName()).arg(accessor).toStdString());
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::convertToFlatStorage()
+{
+  size_t total = 0;
+  for(const SharedVectorType& list : m_Array)
+  {
+    total += (nullptr != list) ? list->size() : 0;
+  }
+
+  m_FlatSlots.resize(m_Array.size());
+  m_FlatValues.resize(total);
+  m_FlatUnused = 0;
+  size_t offset = 0;
+  for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+  {
+    uint32_t count = (nullptr != m_Array[dIdx]) ? static_cast<uint32_t>(m_Array[dIdx]->size()) : 0;
+    m_FlatSlots[dIdx] = {offset, count, count};
+    if(count > 0)
+    {
+      std::copy(m_Array[dIdx]->begin(), m_Array[dIdx]->end(), m_FlatValues.begin() + offset);
+    }
+    offset += count;
+  }
+  m_Array.clear();
+  m_Array.shrink_to_fit();
+  m_UseFlatStorage = true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::convertToNestedStorage()
+{
+  m_Array.resize(m_FlatSlots.size());
+  for(size_t dIdx = 0; dIdx < m_FlatSlots.size(); ++dIdx)
+  {
+    auto begin = m_FlatValues.begin() + m_FlatSlots[dIdx].offset;
+    m_Array[dIdx] = SharedVectorType(new VectorType(begin, begin + m_FlatSlots[dIdx].size));
+  }
+  m_FlatSlots.clear();
+  m_FlatSlots.shrink_to_fit();
+  m_FlatValues.clear();
+  m_FlatValues.shrink_to_fit();
+  m_FlatUnused = 0;
+  m_UseFlatStorage = false;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::reserveFlatSlot(size_t grainId, size_t capacity, size_t keepValues)
+{
+  FlatSlot& slot = m_FlatSlots[grainId];
+  if(capacity <= slot.capacity)
+  {
+    return;
+  }
+  // The last list in the arena can grow in place
+  if(slot.offset + slot.capacity == m_FlatValues.size())
+  {
+    m_FlatValues.resize(slot.offset + capacity);
+    slot.capacity = static_cast<uint32_t>(capacity);
+    return;
+  }
+  // Otherwise the list moves to the end of the arena and its old space is unused until the next compaction
+  size_t offset = m_FlatValues.size();
+  m_FlatValues.resize(offset + capacity);
+  std::copy_n(m_FlatValues.begin() + slot.offset, keepValues, m_FlatValues.begin() + offset);
+  m_FlatUnused += slot.capacity;
+  slot.offset = offset;
+  slot.capacity = static_cast<uint32_t>(capacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void NeighborList<T>::compactFlatStorage()
+{
+  size_t total = 0;
+  for(const FlatSlot& slot : m_FlatSlots)
+  {
+    total += slot.size;
+  }
+  std::vector<T> values(total);
+  size_t offset = 0;
+  for(FlatSlot& slot : m_FlatSlots)
+  {
+    std::copy_n(m_FlatValues.begin() + slot.offset, slot.size, values.begin() + offset);
+    slot.offset = offset;
+    slot.capacity = slot.size;
+    offset += slot.size;
+  }
+  m_FlatValues.swap(values);
+  m_FlatUnused = 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
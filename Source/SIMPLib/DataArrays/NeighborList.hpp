@@ -225,6 +225,13 @@ public:
    */
   int eraseTuples(const std::vector<size_t>& idxs) override;
 
+  /**
+   * @brief Erases every tuple whose entry in removeMask is true by compacting the array in place.
+   * @param removeMask One entry per tuple
+   * @return 0 on success, -100 if the mask does not match the number of tuples
+   */
+  int32_t eraseTuplesByMask(const std::vector<bool>& removeMask) override;
+
   /**
    * @brief copyTuple
    * @param currentPos
@@ -384,6 +391,89 @@ public:
    */
   int readH5Data(hid_t parentId) override;
 
+  /**
+   * @brief Selects how the lists are stored. By default every list is its own shared std::vector.
+   * With flat storage all of the lists live back to back in a single arena (values + per list
+   * offset/size/capacity), which avoids one heap allocation and control block per list and lets
+   * writeH5Data() write the arena without flattening it. Lists grow in place while they have spare
+   * capacity and are moved to the end of the arena when they run out; the arena is compacted once
+   * more than half of it is unused.
+   *
+   * Flat storage is read through getListSpan(), getListPointer(), getValue(), getListSize() and
+   * copyOfList() and written through addEntry(), setList(), setValue() and resizeList(). None of
+   * these convert the storage. The std::vector accessors (getList(), getListReference(), operator[])
+   * only exist for nested storage and throw std::logic_error on a flat list; call
+   * setUseFlatStorage(false) first to use them. AttributeMatrix::getPrereqArray() and
+   * AttributeMatrix::getAttributeArrayAs() do that for their callers.
+   * @param flat
+   */
+  void setUseFlatStorage(bool flat);
+
+  /**
+   * @brief Returns true if the lists are currently held in flat storage
+   * @return
+   */
+  bool getUseFlatStorage() const;
+
+  /**
+   * @brief Returns a pointer to the first value of the list for grainId, or nullptr if the list is
+   * empty. Works in both storage modes without converting between them. The pointer is invalidated
+   * by any call that modifies the NeighborList.
+   * @param grainId
+   * @return
+   */
+  const T* getListPointer(int grainId) const;
+
+  /**
+   * @brief Read only view of one list. It is invalidated by any call that modifies the NeighborList.
+   */
+  class ListSpan
+  {
+  public:
+    ListSpan() = default;
+    ListSpan(const T* data, size_t size)
+    : m_Data(data)
+    , m_Size(size)
+    {
+    }
+
+    const T* data() const
+    {
+      return m_Data;
+    }
+    size_t size() const
+    {
+      return m_Size;
+    }
+    bool empty() const
+    {
+      return m_Size == 0;
+    }
+    const T* begin() const
+    {
+      return m_Data;
+    }
+    const T* end() const
+    {
+      return m_Data + m_Size;
+    }
+    const T& operator[](size_t index) const
+    {
+      return m_Data[index];
+    }
+
+  private:
+    const T* m_Data = nullptr;
+    size_t m_Size = 0;
+  };
+
+  /**
+   * @brief Returns a read only view of the list for grainId. Works in both storage modes without converting between them.
+   * @param grainId
+   * @return
+   */
+  ListSpan getListSpan(int grainId) const;
+
   /**
    * @brief addEntry
    * @param grainId
@@ -403,6 +493,22 @@ public:
    */
   void setList(int grainId, SharedVectorType neighborList);
 
+  /**
+   * @brief Overwrites the value at index of the list for grainId. index must be less than the list size.
+   * @param grainId
+   * @param index
+   * @param value
+   */
+  void setValue(int grainId, int index, T value);
+
+  /**
+   * @brief Resizes the list for grainId, adding lists up to grainId if needed. New values are
+   * set to the init value.
+   * @param grainId
+   * @param size
+   */
+  void resizeList(int grainId, size_t size);
+
   /**
    * @brief getValue
    * @param grainId
@@ -425,10 +531,15 @@ public:
    */
   int getListSize(int grainId) const;
 
+  /**
+   * @brief Returns the list for grainId. Only available in nested storage.
+   * @param grainId
+   * @return
+   */
   VectorType& getListReference(int grainId) const;
 
   /**
-   * @brief getList
+   * @brief Returns the list for grainId. Only available in nested storage.
    * @param grainId
    * @return
    */
@@ -442,14 +553,14 @@ public:
   VectorType copyOfList(int grainId) const;
 
   /**
-   * @brief operator []
+   * @brief operator [] Only available in nested storage.
    * @param grainId
    * @return
    */
   VectorType& operator[](int grainId);
 
   /**
-   * @brief operator []
+   * @brief operator [] Only available in nested storage.
    * @param grainId
    * @return
    */
@@ -462,11 +573,52 @@ protected:
   NeighborList(size_t numTuples, const QString name);
 
 private:
+  /**
+   * @brief Location of one list inside the flat storage arena
+   */
+  struct FlatSlot
+  {
+    size_t offset = 0;
+    uint32_t size = 0;
+    uint32_t capacity = 0;
+  };
+
+  /**
+   * @brief Moves every list into the arena and releases the nested vectors
+   */
+  void convertToFlatStorage();
+
+  /**
+   * @brief Moves every list out of the arena into its own shared vector
+   */
+  void convertToNestedStorage();
+
+  /**
+   * @brief Throws std::logic_error if the lists are in flat storage
+   */
+  void requireNestedStorage(const char* accessor) const;
+
+  /**
+   * @brief Makes room for at least capacity values in the slot for grainId, keeping the first
+   * keepValues values. Grows in place if the slot is at the end of the arena, otherwise moves it there.
+   */
+  void reserveFlatSlot(size_t grainId, size_t capacity, size_t keepValues);
+
+  /**
+   * @brief Rewrites the arena so that the lists are back to back in order with no spare capacity
+   */
+  void compactFlatStorage();
+
   QString m_NumNeighborsArrayName;
   std::vector<SharedVectorType> m_Array;
   size_t m_NumTuples;
   bool m_IsAllocated;
-  T m_InitValue;
+  T m_InitValue = static_cast<T>(0);
+
+  bool m_UseFlatStorage = false;
+  std::vector<FlatSlot> m_FlatSlots;
+  std::vector<T> m_FlatValues;
+  size_t m_FlatUnused = 0;
 
 public:
   NeighborList(const NeighborList&) = delete;            // Copy Constructor Not Implemented
@@ -4,17 +4,21 @@ set(SUBDIR_NAME DataArrays)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayStorage.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DeferredDataSource.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StructArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TupleCompaction.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DynamicListArray.hpp
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayStorage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.cpp
@@ -38,6 +38,7 @@
 
 #include "H5Support/H5Lite.h"
 
+#include "SIMPLib/DataArrays/TupleCompaction.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
@@ -296,27 +297,28 @@ int StringDataArray::eraseTuples(const std::vector<size_t>& idxs)
     }
   }
 
-  // Create a new Array to copy into
-  std::vector<QString> newArray;
-  std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  std::vector<bool> removeMask;
+  TupleCompaction::MaskFromIndices(idxs, m_Array.size(), removeMask);
+  err = eraseTuplesByMask(removeMask);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t StringDataArray::eraseTuplesByMask(const std::vector<bool>& removeMask)
+{
+  if(!m_IsAllocated)
   {
-    bool keep = true;
-    for(std::vector<size_t>::size_type j = start; j < idxs.size(); ++j)
-    {
-      if(static_cast<size_t>(i) == idxs[j])
-      {
-        keep = false;
-        break;
-      }
-    }
-    if(keep)
-    {
-      newArray.push_back(m_Array[i]);
-    }
+    return 0;
   }
-  m_Array = newArray;
-  return err;
+  if(removeMask.size() != m_Array.size())
+  {
+    return -100;
+  }
+  size_t numKept = TupleCompaction::CompactInPlace(m_Array.begin(), m_Array.size(), 1, removeMask);
+  m_Array.resize(numKept);
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -228,6 +228,13 @@ public:
    */
   int eraseTuples(const std::vector<size_t>& idxs) override;
 
+  /**
+   * @brief Erases every tuple whose entry in removeMask is true by compacting the array in place.
+   * @param removeMask One entry per tuple
+   * @return 0 on success, -100 if the mask does not match the number of tuples
+   */
+  int32_t eraseTuplesByMask(const std::vector<bool>& removeMask) override;
+
   /**
    * @brief Copies a Tuple from one position to another.
    * @param currentPos The index of the source data
@@ -0,0 +1,307 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+
+#include <QtCore/QDir>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataArrayStorageTest
+{
+public:
+  DataArrayStorageTest() = default;
+  virtual ~DataArrayStorageTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir tempDir(UnitTest::DataArrayStorageTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs the same set of operations against an array using the given options
+  // -----------------------------------------------------------------------------
+  void CheckBackend(const DataArrayStorage& options, bool expectMapped)
+  {
+    const size_t numTuples = 100000;
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), "Test", false);
+    array->setStorageOptions(options);
+    DREAM3D_REQUIRE(array->allocate() >= 0)
+    DREAM3D_REQUIRE_EQUAL(array->isMemoryMapped(), expectMapped)
+
+    // Newly allocated memory is value initialized no matter where it lives
+    DREAM3D_REQUIRE(std::all_of(array->begin(), array->end(), [](int32_t v) { return v == 0; }))
+
+    std::iota(array->begin(), array->end(), 0);
+    int32_t* ptr = array->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(ptr[3 * numTuples - 1], static_cast<int32_t>(3 * numTuples - 1))
+
+    // Growing keeps the old values and fills the new tuples with the init value
+    array->setInitValue(-1);
+    array->resizeTuples(numTuples * 2);
+    DREAM3D_REQUIRE_EQUAL(array->isMemoryMapped(), expectMapped)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(3 * numTuples - 1), static_cast<int32_t>(3 * numTuples - 1))
+    DREAM3D_REQUIRE_EQUAL(array->getValue(3 * numTuples), -1)
+
+    std::vector<size_t> idxs = {0, 2};
+    DREAM3D_REQUIRE_EQUAL(array->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), numTuples * 2 - 2)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(0), 3)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(3), 9)
+    DREAM3D_REQUIRE_EQUAL(array->isMemoryMapped(), expectMapped)
+
+    IDataArray::Pointer copy = array->deepCopy();
+    Int32ArrayType::Pointer typedCopy = std::dynamic_pointer_cast<Int32ArrayType>(copy);
+    DREAM3D_REQUIRE_VALID_POINTER(typedCopy.get())
+    DREAM3D_REQUIRE_EQUAL(typedCopy->isMemoryMapped(), expectMapped)
+    DREAM3D_REQUIRE(std::equal(array->begin(), array->end(), typedCopy->begin()))
+
+    array->resizeTuples(0);
+    DREAM3D_REQUIRE_EQUAL(array->isMemoryMapped(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBackends()
+  {
+    CheckBackend(DataArrayStorage::Heap(), false);
+    CheckBackend(DataArrayStorage::AnonymousMap(), true);
+    CheckBackend(DataArrayStorage::FileMap(UnitTest::DataArrayStorageTest::TestDir), true);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestThresholdAndGlobalPolicy()
+  {
+    DataArrayStorage options = DataArrayStorage::AnonymousMap(1024);
+    DREAM3D_REQUIRE(options.resolveBackend(1023) == DataArrayStorage::Backend::Heap)
+    DREAM3D_REQUIRE(options.resolveBackend(1024) == DataArrayStorage::Backend::AnonymousMap)
+
+    FloatArrayType::Pointer small = FloatArrayType::CreateArray(10, "Small", false);
+    small->setStorageOptions(options);
+    small->allocate();
+    DREAM3D_REQUIRE_EQUAL(small->isMemoryMapped(), false)
+
+    // Arrays without their own options follow the global policy
+    DataArrayStorage previous = DataArrayStorage::GetGlobalPolicy();
+    DataArrayStorage::SetGlobalPolicy(DataArrayStorage::FileMap(UnitTest::DataArrayStorageTest::TestDir, 4096));
+    FloatArrayType::Pointer large = FloatArrayType::CreateArray(4096, "Large", true);
+    FloatArrayType::Pointer tiny = FloatArrayType::CreateArray(16, "Tiny", true);
+    DREAM3D_REQUIRE_EQUAL(large->isMemoryMapped(), true)
+    DREAM3D_REQUIRE_EQUAL(tiny->isMemoryMapped(), false)
+
+    // An array with explicit options ignores the global policy
+    FloatArrayType::Pointer heap = FloatArrayType::CreateArray(4096, "Heap", false);
+    heap->setStorageOptions(DataArrayStorage::Heap());
+    heap->allocate();
+    DREAM3D_REQUIRE_EQUAL(heap->isMemoryMapped(), false)
+
+    DataArrayStorage::SetGlobalPolicy(previous);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Mapped memory handed from one array to another with releaseOwnership() has to
+  // be unmapped by the array that ends up owning it.
+  // -----------------------------------------------------------------------------
+  void TestOwnershipTransfer()
+  {
+    const size_t numTuples = 50000;
+    UInt8ArrayType::Pointer source = UInt8ArrayType::CreateArray(numTuples, "Source", false);
+    source->setStorageOptions(DataArrayStorage::FileMap(UnitTest::DataArrayStorageTest::TestDir));
+    source->allocate();
+    source->initializeWithValue(7);
+
+    uint8_t* ptr = source->getPointer(0);
+    source->releaseOwnership();
+    source = UInt8ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(DataArrayStorage::IsMapped(ptr), true)
+
+    {
+      UInt8ArrayType::Pointer wrapped = UInt8ArrayType::WrapPointer(ptr, numTuples, std::vector<size_t>(1, 1), "Wrapped", true);
+      DREAM3D_REQUIRE_EQUAL(wrapped->isMemoryMapped(), true)
+      DREAM3D_REQUIRE_EQUAL(wrapped->getValue(numTuples - 1), 7)
+    }
+    DREAM3D_REQUIRE_EQUAL(DataArrayStorage::IsMapped(ptr), false)
+
+    // Heap memory wrapped the same way is still freed with delete[]
+    auto* heapPtr = new float[10]();
+    FloatArrayType::Pointer wrappedHeap = FloatArrayType::WrapPointer(heapPtr, 10, std::vector<size_t>(1, 1), "WrappedHeap", true);
+    DREAM3D_REQUIRE_EQUAL(wrappedHeap->isMemoryMapped(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUninitializedAllocate()
+  {
+    // Large enough that the initialization is split across threads
+    const size_t numElements = 4 * 1024 * 1024 + 17;
+    FloatArrayType::Pointer zeroed = FloatArrayType::CreateArray(numElements, "Zeroed", false);
+    zeroed->allocate();
+    DREAM3D_REQUIRE(std::all_of(zeroed->begin(), zeroed->end(), [](float v) { return v == 0.0f; }))
+
+    zeroed->initializeWithValue(2.0f, 5);
+    DREAM3D_REQUIRE_EQUAL(zeroed->getValue(4), 0.0f)
+    DREAM3D_REQUIRE(std::all_of(zeroed->begin() + 5, zeroed->end(), [](float v) { return v == 2.0f; }))
+
+    Int64ArrayType::Pointer raw = Int64ArrayType::CreateArray(numElements, "Raw", false);
+    DREAM3D_REQUIRE_EQUAL(raw->allocateUninitialized(), 1)
+    DREAM3D_REQUIRE_EQUAL(raw->isAllocated(), true)
+    std::iota(raw->begin(), raw->end(), 0);
+
+    // Growing only initializes the new tuples, shrinking keeps the front
+    raw->setInitValue(-1);
+    raw->resizeTuples(numElements + 10);
+    DREAM3D_REQUIRE_EQUAL(raw->getValue(numElements - 1), static_cast<int64_t>(numElements - 1))
+    DREAM3D_REQUIRE_EQUAL(raw->getValue(numElements + 9), -1)
+    raw->resizeTuples(10);
+    DREAM3D_REQUIRE_EQUAL(raw->getValue(9), 9)
+
+    // An array that was never allocated still grows into zeros followed by the init value
+    Int32ArrayType::Pointer deferred = Int32ArrayType::CreateArray(100, "Deferred", false);
+    deferred->setInitValue(7);
+    deferred->resizeTuples(200);
+    DREAM3D_REQUIRE_EQUAL(deferred->getValue(99), 0)
+    DREAM3D_REQUIRE_EQUAL(deferred->getValue(100), 7)
+
+    std::vector<int32_t> values(numElements, 3);
+    Int32ArrayType::Pointer copied = Int32ArrayType::FromStdVector(values, "Copied");
+    DREAM3D_REQUIRE(std::equal(values.begin(), values.end(), copied->begin()))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAllocateBenchmark()
+  {
+    const size_t numElements = 128 * 1024 * 1024;
+    std::vector<double> values(numElements, 1.0);
+
+    auto startTime = std::chrono::steady_clock::now();
+    {
+      DoubleArrayType::Pointer array = DoubleArrayType::CreateArray(numElements, "Initialized", false);
+      array->allocate();
+      std::copy(values.begin(), values.end(), array->begin());
+    }
+    auto midTime = std::chrono::steady_clock::now();
+    {
+      DoubleArrayType::Pointer array = DoubleArrayType::CreateArray(numElements, "Uninitialized", false);
+      array->allocateUninitialized();
+      std::copy(values.begin(), values.end(), array->begin());
+    }
+    auto endTime = std::chrono::steady_clock::now();
+
+    std::cout << "allocate + copy: " << std::chrono::duration_cast<std::chrono::milliseconds>(midTime - startTime).count() << " ms, allocateUninitialized + copy: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - midTime).count() << " ms" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkBackend(const DataArrayStorage& options, const QString& label)
+  {
+    const size_t numElements = 64 * 1024 * 1024;
+    auto startTime = std::chrono::steady_clock::now();
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numElements, "Benchmark", false);
+    array->setStorageOptions(options);
+    DREAM3D_REQUIRE(array->allocate() >= 0)
+    auto allocTime = std::chrono::steady_clock::now();
+
+    float* ptr = array->getPointer(0);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      ptr[i] = static_cast<float>(i);
+    }
+    double sum = std::accumulate(array->begin(), array->end(), 0.0);
+    auto endTime = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRE(sum > 0.0)
+
+    std::cout << label.toStdString() << ": allocate " << std::chrono::duration_cast<std::chrono::milliseconds>(allocTime - startTime).count() << " ms, write+read "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - allocTime).count() << " ms" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStorageBenchmark()
+  {
+    BenchmarkBackend(DataArrayStorage::Heap(), "Heap");
+    BenchmarkBackend(DataArrayStorage::AnonymousMap(), "AnonymousMap");
+    BenchmarkBackend(DataArrayStorage::FileMap(UnitTest::DataArrayStorageTest::TestDir), "FileMap");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    QDir dir(UnitTest::DataArrayStorageTest::TestDir);
+    dir.mkpath(".");
+    std::cout << "#### DataArrayStorageTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestBackends())
+    DREAM3D_REGISTER_TEST(TestThresholdAndGlobalPolicy())
+    DREAM3D_REGISTER_TEST(TestOwnershipTransfer())
+    DREAM3D_REGISTER_TEST(TestUninitializedAllocate())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestAllocateBenchmark())
+    DREAM3D_REGISTER_TEST(TestStorageBenchmark())
+#endif
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  DataArrayStorageTest(const DataArrayStorageTest&) = delete;            // Copy Constructor Not Implemented
+  DataArrayStorageTest(DataArrayStorageTest&&) = delete;                 // Move Constructor Not Implemented
+  DataArrayStorageTest& operator=(const DataArrayStorageTest&) = delete; // Copy Assignment Not Implemented
+  DataArrayStorageTest& operator=(DataArrayStorageTest&&) = delete;      // Move Assignment Not Implemented
+};
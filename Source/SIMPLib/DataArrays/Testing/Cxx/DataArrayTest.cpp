@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -1482,6 +1483,197 @@ true);
     TestByteSwapElementType<double>(0x412ABE865D841400);
   }
 
+  // -----------------------------------------------------------------------------
+  void TestEraseByMask()
+  {
+    // Spans several compaction chunks
+    const size_t numTuples = 300000;
+    std::vector<size_t> cDims = {2};
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(numTuples, cDims, "Erase", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setComponent(i, 0, static_cast<int32_t>(i));
+      array->setComponent(i, 1, -static_cast<int32_t>(i));
+    }
+    std::vector<bool> removeMask(numTuples, false);
+    size_t numRemoved = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(i % 3 == 0 || (i > 100000 && i < 170000))
+      {
+        removeMask[i] = true;
+        numRemoved++;
+      }
+    }
+    int32_t* ptr = array->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(array->eraseTuplesByMask(removeMask), 0)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), numTuples - numRemoved)
+    // Compacted in place, no second buffer
+    DREAM3D_REQUIRE_EQUAL(array->getPointer(0), ptr)
+    size_t t = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(removeMask[i])
+      {
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(array->getComponent(t, 0), static_cast<int32_t>(i))
+      DREAM3D_REQUIRE_EQUAL(array->getComponent(t, 1), -static_cast<int32_t>(i))
+      t++;
+    }
+
+    std::vector<bool> badMask(3, true);
+    DREAM3D_REQUIRE_EQUAL(array->eraseTuplesByMask(badMask), -100)
+
+    // Wrapped memory that the array does not own is left untouched
+    std::vector<float> external = {0.0f, 1.0f, 2.0f, 3.0f};
+    FloatArrayType::Pointer wrapped = FloatArrayType::WrapPointer(external.data(), 4, std::vector<size_t>(1, 1), "Wrapped", false);
+    std::vector<size_t> idxs = {1};
+    DREAM3D_REQUIRE_EQUAL(wrapped->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getNumberOfTuples(), 3)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(1), 2.0f)
+    DREAM3D_REQUIRE_EQUAL(external[1], 1.0f)
+
+    std::vector<bool> listMask = {false, true, false, true, false};
+    for(bool flat : {false, true})
+    {
+      Int32NeighborListType::Pointer list = Int32NeighborListType::CreateArray(5, "Lists", true);
+      list->setUseFlatStorage(flat);
+      for(int32_t i = 0; i < 5; i++)
+      {
+        for(int32_t j = 0; j <= i; j++)
+        {
+          list->addEntry(i, i * 10 + j);
+        }
+      }
+      DREAM3D_REQUIRE_EQUAL(list->eraseTuplesByMask(listMask), 0)
+      DREAM3D_REQUIRE_EQUAL(list->getNumberOfTuples(), 3)
+      DREAM3D_REQUIRE_EQUAL(list->getListSize(1), 3)
+      bool ok = false;
+      DREAM3D_REQUIRE_EQUAL(list->getValue(1, 2, ok), 22)
+      DREAM3D_REQUIRE_EQUAL(ok, true)
+      DREAM3D_REQUIRE_EQUAL(list->getListSize(2), 5)
+      DREAM3D_REQUIRE_EQUAL(list->getValue(2, 0, ok), 40)
+    }
+
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(5, "Strings", true);
+    for(size_t i = 0; i < 5; i++)
+    {
+      strings->setValue(i, QString::number(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(strings->eraseTuplesByMask(listMask), 0)
+    DREAM3D_REQUIRE_EQUAL(strings->getNumberOfTuples(), 3)
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(1), QString("2"))
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(2), QString("4"))
+    idxs = {0, 2};
+    DREAM3D_REQUIRE_EQUAL(strings->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(strings->getNumberOfTuples(), 1)
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(0), QString("2"))
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestCapacity()
+  {
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(0, "Capacity", true);
+    DREAM3D_REQUIRE_EQUAL(array->capacity(), 0)
+
+    size_t reallocations = 0;
+    size_t lastCapacity = array->capacity();
+    for(int32_t i = 0; i < 10000; i++)
+    {
+      array->push_back(i);
+      if(array->capacity() != lastCapacity)
+      {
+        reallocations++;
+        lastCapacity = array->capacity();
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(array->size(), 10000)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), 10000)
+    DREAM3D_REQUIRED(array->capacity(), >=, 10000)
+    DREAM3D_REQUIRED(reallocations, <, 40)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(9999), 9999)
+
+    // Shrinking a little keeps the allocation, pointers stay valid
+    int32_t* ptr = array->getPointer(0);
+    array->pop_back();
+    DREAM3D_REQUIRE_EQUAL(array->size(), 9999)
+    DREAM3D_REQUIRE_EQUAL(array->getPointer(0), ptr)
+
+    array->shrink_to_fit();
+    DREAM3D_REQUIRE_EQUAL(array->capacity(), 9999)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(9998), 9998)
+
+    // Shrinking a lot gives the memory back
+    array->resizeTuples(100);
+    DREAM3D_REQUIRE_EQUAL(array->capacity(), 100)
+
+    // reserve() changes the capacity but not the size
+    array->reserve(5000);
+    DREAM3D_REQUIRE_EQUAL(array->capacity(), 5000)
+    DREAM3D_REQUIRE_EQUAL(array->size(), 100)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(99), 99)
+    ptr = array->getPointer(0);
+    array->setInitValue(-3);
+    array->resizeTuples(4000);
+    DREAM3D_REQUIRE_EQUAL(array->getPointer(0), ptr)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(99), 99)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(100), -3)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(3999), -3)
+
+    // Growing one tuple at a time with more than one component
+    std::vector<size_t> cDims = {3};
+    FloatArrayType::Pointer verts = FloatArrayType::CreateArray(0, cDims, "Verts", true);
+    for(size_t i = 0; i < 1000; i++)
+    {
+      verts->resizeTuples(i + 1);
+      verts->setComponent(i, 0, static_cast<float>(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(verts->getNumberOfTuples(), 1000)
+    DREAM3D_REQUIRE_EQUAL(verts->getComponent(999, 0), 999.0f)
+    DREAM3D_REQUIRE_EQUAL(verts->getComponent(0, 0), 0.0f)
+
+    // Deep copies and wrapped pointers are sized to their contents
+    IDataArray::Pointer copy = array->deepCopy();
+    DREAM3D_REQUIRE_EQUAL(std::dynamic_pointer_cast<Int32ArrayType>(copy)->capacity(), 4000)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestAppendBenchmark()
+  {
+    const size_t numValues = 2000000;
+    auto startTime = std::chrono::steady_clock::now();
+    Int64ArrayType::Pointer pushed = Int64ArrayType::CreateArray(0, "PushBack", true);
+    for(size_t i = 0; i < numValues; i++)
+    {
+      pushed->push_back(static_cast<int64_t>(i));
+    }
+    auto pushTime = std::chrono::steady_clock::now();
+
+    std::vector<size_t> cDims = {3};
+    FloatArrayType::Pointer verts = FloatArrayType::CreateArray(0, cDims, "Verts", true);
+    for(size_t i = 0; i < numValues / 4; i++)
+    {
+      verts->resizeTuples(i + 1);
+      float* v = verts->getTuplePointer(i);
+      v[0] = v[1] = v[2] = static_cast<float>(i);
+    }
+    auto resizeTime = std::chrono::steady_clock::now();
+
+    std::vector<int64_t> reference;
+    for(size_t i = 0; i < numValues; i++)
+    {
+      reference.push_back(static_cast<int64_t>(i));
+    }
+    auto endTime = std::chrono::steady_clock::now();
+
+    DREAM3D_REQUIRE_EQUAL(pushed->getNumberOfTuples(), numValues)
+    DREAM3D_REQUIRE_EQUAL(verts->getNumberOfTuples(), numValues / 4)
+    std::cout << "push_back x" << numValues << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(pushTime - startTime).count() << " ms, resizeTuples(+1) x" << numValues / 4
+              << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(resizeTime - pushTime).count()
+              << " ms, std::vector::push_back: " << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - resizeTime).count() << " ms" << std::endl;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1507,6 +1699,11 @@ true);
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
     DREAM3D_REGISTER_TEST(TestSetTuple())
     DREAM3D_REGISTER_TEST(TestByteSwapElements())
+    DREAM3D_REGISTER_TEST(TestEraseByMask())
+    DREAM3D_REGISTER_TEST(TestCapacity())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestAppendBenchmark())
+#endif
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -0,0 +1,350 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+#include <QtCore/QDir>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+using namespace H5Support;
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class NeighborListTest
+{
+public:
+  NeighborListTest() = default;
+  virtual ~NeighborListTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir tempDir(UnitTest::NeighborListTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Fills numLists lists round robin so that every list grows a bit at a time,
+  // the same way the neighbor finding filters build them.
+  // -----------------------------------------------------------------------------
+  void fillLists(Int32NeighborListType::Pointer& list, int numLists, int maxEntries)
+  {
+    for(int e = 0; e < maxEntries; e++)
+    {
+      for(int i = 0; i < numLists; i++)
+      {
+        if(e < (i % maxEntries) + 1)
+        {
+          list->addEntry(i, i * 100 + e);
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void checkLists(const Int32NeighborListType::Pointer& list, int numLists, int maxEntries)
+  {
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfLists(), numLists)
+    for(int i = 0; i < numLists; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(list->getListSize(i), (i % maxEntries) + 1)
+      const int32_t* values = list->getListPointer(i);
+      for(int e = 0; e < list->getListSize(i); e++)
+      {
+        DREAM3D_REQUIRE_EQUAL(values[e], i * 100 + e)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFlatStorage()
+  {
+    Int32NeighborListType::Pointer list = Int32NeighborListType::CreateArray(0, "Flat", false);
+    list->setUseFlatStorage(true);
+    fillLists(list, 500, 7);
+    DREAM3D_REQUIRE(list->getUseFlatStorage())
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfTuples(), 500)
+    checkLists(list, 500, 7);
+
+    bool ok = true;
+    DREAM3D_REQUIRE_EQUAL(list->getValue(3, 2, ok), 302)
+    DREAM3D_REQUIRE(ok)
+    list->getValue(3, 4, ok);
+    DREAM3D_REQUIRE(!ok)
+
+    // setList copies the values into the arena
+    Int32NeighborListType::SharedVectorType newList(new Int32NeighborListType::VectorType(10, 42));
+    list->setList(1, newList);
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(1), 10)
+    DREAM3D_REQUIRE_EQUAL(list->copyOfList(1)[9], 42)
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(2), 3)
+
+    // copyTuple, deepCopy and eraseTuples keep the flat layout
+    list->copyTuple(1, 0);
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(0), 10)
+    IDataArray::Pointer copyPtr = list->deepCopy();
+    Int32NeighborListType::Pointer copy = std::dynamic_pointer_cast<Int32NeighborListType>(copyPtr);
+    DREAM3D_REQUIRE(copy->getUseFlatStorage())
+    DREAM3D_REQUIRE_EQUAL(copy->getSize(), list->getSize())
+
+    std::vector<size_t> idxs = {0, 1};
+    DREAM3D_REQUIRE_EQUAL(copy->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), 498)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(0), 3)
+    DREAM3D_REQUIRE_EQUAL(copy->getListPointer(0)[2], 202)
+
+    // Spans read the arena in place
+    Int32NeighborListType::ListSpan span = copy->getListSpan(0);
+    DREAM3D_REQUIRE_EQUAL(span.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(span[2], 202)
+    int32_t sum = 0;
+    for(int32_t value : span)
+    {
+      sum += value;
+    }
+    DREAM3D_REQUIRE_EQUAL(sum, 200 + 201 + 202)
+
+    // The explicit write APIs keep the flat layout
+    copy->setValue(0, 1, 7);
+    copy->resizeList(0, 5);
+    DREAM3D_REQUIRE(copy->getUseFlatStorage())
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(0), 5)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSpan(0)[1], 7)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSpan(0)[4], 0)
+    copy->resizeList(0, 2);
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(0), 2)
+    DREAM3D_REQUIRE_EQUAL(copy->getListPointer(497)[0], 49900)
+
+    // The std::vector accessors refuse flat storage instead of converting it
+    bool threw = false;
+    try
+    {
+      const Int32NeighborListType& constCopy = *copy;
+      constCopy.getListReference(0);
+    } catch(const std::logic_error&)
+    {
+      threw = true;
+    }
+    DREAM3D_REQUIRE(threw)
+    DREAM3D_REQUIRE(copy->getUseFlatStorage())
+
+    // Going back to nested storage is explicit and keeps the contents
+    copy->setUseFlatStorage(false);
+    Int32NeighborListType::VectorType& ref = (*copy)[0];
+    DREAM3D_REQUIRE_EQUAL(ref.size(), 2)
+    ref.push_back(9);
+    DREAM3D_REQUIRE_EQUAL(copy->getList(0)->at(2), 9)
+    copy->setUseFlatStorage(true);
+    DREAM3D_REQUIRE_EQUAL(copy->getListPointer(0)[2], 9)
+    copy->resizeTuples(10);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfLists(), 10)
+    copy->addEntry(12, 5);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfLists(), 13)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(11), 0)
+    DREAM3D_REQUIRE(copy->getListPointer(11) == nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int writeList(const QString& filePath, const Int32NeighborListType::Pointer& list)
+  {
+    hid_t fileId = QH5Utilities::createFile(filePath);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+    std::vector<size_t> tDims = {list->getNumberOfTuples()};
+    return list->writeH5Data(fileId, tDims);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int readList(const QString& filePath, const Int32NeighborListType::Pointer& list)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+    return list->readH5Data(fileId);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestH5RoundTrip()
+  {
+    // Files written from either storage mode are identical and can be read into either mode
+    for(bool writeFlat : {false, true})
+    {
+      Int32NeighborListType::Pointer list = Int32NeighborListType::CreateArray(0, "Neighbors", false);
+      list->setUseFlatStorage(writeFlat);
+      fillLists(list, 1000, 5);
+      int err = writeList(UnitTest::NeighborListTest::RoundTripFile, list);
+      DREAM3D_REQUIRED(err, >=, 0)
+
+      for(bool readFlat : {false, true})
+      {
+        Int32NeighborListType::Pointer readBack = Int32NeighborListType::CreateArray(0, "Neighbors", false);
+        readBack->setUseFlatStorage(readFlat);
+        err = readList(UnitTest::NeighborListTest::RoundTripFile, readBack);
+        DREAM3D_REQUIRED(err, >=, 0)
+        DREAM3D_REQUIRE_EQUAL(readBack->getUseFlatStorage(), readFlat)
+        DREAM3D_REQUIRE_EQUAL(readBack->getNumberOfTuples(), 1000)
+        checkLists(readBack, 1000, 5);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReaderUsesFlatStorage()
+  {
+    Int32NeighborListType::Pointer list = Int32NeighborListType::CreateArray(0, "Neighbors", false);
+    fillLists(list, 100, 4);
+    int err = writeList(UnitTest::NeighborListTest::RoundTripFile, list);
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    Int32NeighborListType::Pointer readBack;
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::NeighborListTest::RoundTripFile, true);
+      DREAM3D_REQUIRED(fileId, >, 0);
+      H5ScopedFileSentinel sentinel(fileId, false);
+      readBack = std::dynamic_pointer_cast<Int32NeighborListType>(H5DataArrayReader::ReadNeighborListData(fileId, "Neighbors"));
+    }
+    DREAM3D_REQUIRE_VALID_POINTER(readBack.get())
+    DREAM3D_REQUIRE(readBack->getUseFlatStorage())
+    checkLists(readBack, 100, 4);
+
+    // Untyped access keeps the flat storage, typed access hands out nested storage
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, 100), "AttributeMatrix", AttributeMatrix::Type::CellFeature);
+    am->addOrReplaceAttributeArray(readBack);
+    DREAM3D_REQUIRE(std::dynamic_pointer_cast<Int32NeighborListType>(am->getAttributeArray("Neighbors"))->getUseFlatStorage())
+    Int32NeighborListType::Pointer typed = am->getAttributeArrayAs<Int32NeighborListType>("Neighbors");
+    DREAM3D_REQUIRE(!typed->getUseFlatStorage())
+    DREAM3D_REQUIRE_EQUAL(typed->getListReference(99).size(), 4)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkStorage(bool flat, const QString& filePath)
+  {
+    const int numLists = 2000000;
+    const int maxEntries = 14;
+
+    auto start = std::chrono::steady_clock::now();
+    Int32NeighborListType::Pointer list = Int32NeighborListType::CreateArray(0, "Neighbors", false);
+    list->setUseFlatStorage(flat);
+    fillLists(list, numLists, maxEntries);
+    auto buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    // Approximate heap footprint: per list bookkeeping plus the stored values
+    size_t bytes = 0;
+    if(flat)
+    {
+      bytes = numLists * (sizeof(size_t) + 2 * sizeof(uint32_t)) + list->getSize() * sizeof(int32_t);
+    }
+    else
+    {
+      // shared_ptr + the control block holding the std::vector + the vector's own allocation
+      size_t perList = sizeof(Int32NeighborListType::SharedVectorType) + 2 * sizeof(void*) + sizeof(Int32NeighborListType::VectorType);
+      bytes = numLists * perList;
+      for(int i = 0; i < numLists; i++)
+      {
+        bytes += list->getListReference(i).capacity() * sizeof(int32_t);
+      }
+    }
+
+    start = std::chrono::steady_clock::now();
+    int err = writeList(filePath, list);
+    auto writeTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    std::cout << "\t" << (flat ? "Flat  " : "Nested") << ": Build " << buildTime << " ms  Write " << writeTime << " ms  ~" << bytes / (1024 * 1024) << " MB for " << numLists << " lists / "
+              << list->getSize() << " values" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStorageBenchmark()
+  {
+    BenchmarkStorage(false, UnitTest::NeighborListTest::NestedFile);
+    BenchmarkStorage(true, UnitTest::NeighborListTest::FlatFile);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    QDir dir(UnitTest::NeighborListTest::TestDir);
+    dir.mkpath(".");
+    std::cout << "#### NeighborListTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFlatStorage())
+    DREAM3D_REGISTER_TEST(TestH5RoundTrip())
+    DREAM3D_REGISTER_TEST(TestReaderUsesFlatStorage())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestStorageBenchmark())
+#endif
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  NeighborListTest(const NeighborListTest&) = delete;            // Copy Constructor Not Implemented
+  NeighborListTest(NeighborListTest&&) = delete;                 // Move Constructor Not Implemented
+  NeighborListTest& operator=(const NeighborListTest&) = delete; // Copy Assignment Not Implemented
+  NeighborListTest& operator=(NeighborListTest&&) = delete;      // Move Assignment Not Implemented
+};
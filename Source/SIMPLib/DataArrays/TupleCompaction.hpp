@@ -0,0 +1,127 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The TupleCompaction namespace holds the in place compaction that the array classes use to erase
+ * tuples without allocating a second buffer.
+ */
+namespace TupleCompaction
+{
+/**
+ * @brief Builds a removal mask of numTuples entries from a list of tuple indices
+ * @param idxs The indices to remove
+ * @param numTuples
+ * @param removeMask Receives the mask
+ * @return false if an index is out of range
+ */
+inline bool MaskFromIndices(const std::vector<size_t>& idxs, size_t numTuples, std::vector<bool>& removeMask)
+{
+  removeMask.assign(numTuples, false);
+  for(size_t idx : idxs)
+  {
+    if(idx >= numTuples)
+    {
+      return false;
+    }
+    removeMask[idx] = true;
+  }
+  return true;
+}
+
+/**
+ * @brief Moves every tuple whose removeMask entry is false to the front of data, keeping their order.
+ * The tuples are compacted in fixed size chunks in parallel, each chunk into its own front, and the
+ * compacted chunks are then slid down in order. Every move goes to a lower address so no second
+ * buffer is needed.
+ * @param data Start of the tuples
+ * @param numTuples
+ * @param numComponents Number of elements per tuple
+ * @param removeMask One entry per tuple, true marks a tuple to remove
+ * @return The number of tuples that were kept
+ */
+template <typename RandomIt>
+size_t CompactInPlace(RandomIt data, size_t numTuples, size_t numComponents, const std::vector<bool>& removeMask)
+{
+  constexpr size_t k_ChunkSize = 64 * 1024;
+  const size_t numChunks = (numTuples + k_ChunkSize - 1) / k_ChunkSize;
+  using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+  auto tupleIter = [data, numComponents](size_t tuple) { return data + static_cast<difference_type>(tuple * numComponents); };
+
+  std::vector<size_t> keptPerChunk(numChunks, 0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      size_t begin = chunk * k_ChunkSize;
+      size_t end = std::min(begin + k_ChunkSize, numTuples);
+      size_t dest = begin;
+      for(size_t tuple = begin; tuple < end; tuple++)
+      {
+        if(removeMask[tuple])
+        {
+          continue;
+        }
+        if(dest != tuple)
+        {
+          std::move(tupleIter(tuple), tupleIter(tuple + 1), tupleIter(dest));
+        }
+        dest++;
+      }
+      keptPerChunk[chunk] = dest - begin;
+    }
+  });
+
+  size_t dest = 0;
+  for(size_t chunk = 0; chunk < numChunks; chunk++)
+  {
+    size_t begin = chunk * k_ChunkSize;
+    if(dest != begin && keptPerChunk[chunk] > 0)
+    {
+      std::move(tupleIter(begin), tupleIter(begin + keptPerChunk[chunk]), tupleIter(dest));
+    }
+    dest += keptPerChunk[chunk];
+  }
+  return dest;
+}
+} // namespace TupleCompaction
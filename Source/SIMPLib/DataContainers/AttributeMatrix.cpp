@@ -58,6 +58,7 @@ using namespace H5Support;
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
@@ -426,13 +427,15 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects,
   {
     size_t goodcount = 1;
     std::vector<size_t> newNames(totalTuples, 0);
-    std::vector<size_t> removeList;
+    std::vector<bool> removeMask(totalTuples, false);
+    size_t numRemoved = 0;
 
     for(qint32 i = 1; i < activeObjects.size(); i++)
     {
       if(!activeObjects[i])
       {
-        removeList.push_back(i);
+        removeMask[i] = true;
+        numRemoved++;
         newNames[i] = 0;
       }
       else
@@ -442,34 +445,39 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects,
       }
     }
 
-    if(!removeList.empty())
+    if(numRemoved > 0)
     {
       QList<QString> headers = getAttributeArrayNames();
       for(const auto& header : headers)
       {
         IDataArray::Pointer p = getAttributeArray(header);
+        // Neighbor lists hold feature ids that are no longer valid after the renumbering below
         if(p->getNameOfClass() == "NeighborList<T>")
         {
           removeAttributeArray(header);
         }
         else
         {
-          p->eraseTuples(removeList);
+          p->eraseTuplesByMask(removeMask);
         }
       }
-      std::vector<size_t> tDims(1, (totalTuples - removeList.size()));
+      std::vector<size_t> tDims(1, (totalTuples - numRemoved));
       setTupleDimensions(tDims);
 
       // Loop over all the points and correct all the feature names
       size_t totalPoints = featureIds->getNumberOfTuples();
       int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
-      {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, totalPoints);
+      dataAlg.execute([featureIdPtr, &newNames](const SIMPLRange& range) {
+        for(size_t i = range.min(); i < range.max(); i++)
         {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
+          if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
+          {
+            featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
+          }
         }
-      }
+      });
     }
   }
   else
@@ -544,6 +552,21 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate) const
 
   return newAttrMat;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer AttributeMatrix::createSnapshot() const
+{
+  AttributeMatrix::Pointer amSnapshot = AttributeMatrix::New(getTupleDimensions(), getName(), getType());
+
+  if(!snapshotChildrenInto(*amSnapshot, [](const IDataArray::Pointer& d) { return d->deepCopy(false); }))
+  {
+    return AttributeMatrix::NullPointer();
+  }
+
+  return amSnapshot;
+}
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -577,6 +600,10 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
   if(classType.startsWith("DataArray"))
   {
     dPtr = H5DataArrayReader::ReadIDataArray(gid, name, preflight);
+    if(nullptr == dPtr)
+    {
+      return -1;
+    }
     if(preflight)
     {
       dPtr->resizeTuples(getNumberOfTuples());
@@ -642,6 +669,12 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     if(classType.startsWith("DataArray"))
     {
       dPtr = H5DataArrayReader::ReadIDataArray(amGid, daToRead.getName(), preflight);
+      if(nullptr == dPtr)
+      {
+        // H5DataArrayReader::GetThreadReadError() tells the caller why
+        H5Gclose(amGid);
+        return -1;
+      }
     }
     else if(classType.compare("StringDataArray") == 0)
     {
@@ -1034,6 +1067,28 @@ IDataArray::Pointer AttributeMatrix::getPrereqIDataArray(AbstractFilter* filter,
     ss = QObject::tr("Unable to cast input array %1 to the necessary type.").arg(attributeArrayName);
     filter->setErrorCondition(err, ss);
   }
+  else if(!loadPrereqArrayValues(filter, attributeArray, err))
+  {
+    return nullptr;
+  }
 
   return attributeArray;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AttributeMatrix::loadPrereqArrayValues(AbstractFilter* filter, const IDataArray::Pointer& array, int err) const
+{
+  if(nullptr == filter || filter->getInPreflight())
+  {
+    return true;
+  }
+  if(!array->loadDeferredData())
+  {
+    QString ss = QObject::tr("The values of the DataArray '%1' in the AttributeMatrix '%2' could not be read from the file they are loaded from on demand.").arg(array->getName()).arg(getName());
+    filter->setErrorCondition(err, ss);
+    return false;
+  }
+  return true;
+}
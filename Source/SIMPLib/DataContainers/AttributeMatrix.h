@@ -41,6 +41,8 @@
 
 //-- C++ includes
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <QtCore/QObject>
@@ -258,7 +260,9 @@ public:
   typename ArrayType::Pointer getAttributeArrayAs(const QString& name) const
   {
     IDataArrayShPtrType iDataArray = getAttributeArray(name);
-    return std::dynamic_pointer_cast<ArrayType>(iDataArray);
+    typename ArrayType::Pointer array = std::dynamic_pointer_cast<ArrayType>(iDataArray);
+    useNestedStorage<ArrayType>(array);
+    return array;
   }
 
   /**
@@ -373,6 +377,11 @@ public:
                .arg(attributeArrayName);
       filter->setErrorCondition(err, ss);
     }
+    if(nullptr != attributeArray && !loadPrereqArrayValues(filter, attributeArray, err))
+    {
+      return ArrayType::NullPointer();
+    }
+    useNestedStorage<ArrayType>(attributeArray);
     return attributeArray;
   }
 
@@ -393,11 +402,12 @@ public:
    * @param initValue The initial value of all the elements of the array
    * @param size The number of tuples in the Array
    * @param dims The dimensions of the components of the AttributeArray
+   * @param initialize When false the elements are not set to initValue. Only pass false if the caller overwrites every element.
    * @return A Shared Pointer to the newly created array
    */
   template <class ArrayType>
   typename ArrayType::Pointer createNonPrereqArray(AbstractFilter* filter, const QString& attributeArrayName, typename ArrayType::value_type initValue, const std::vector<size_t>& compDims,
-                                                   RenameDataPath::DataID_t id = RenameDataPath::k_Invalid_ID)
+                                                   RenameDataPath::DataID_t id = RenameDataPath::k_Invalid_ID, bool initialize = true)
   {
     typename ArrayType::Pointer attributeArray = ArrayType::NullPointer();
 
@@ -414,7 +424,7 @@ public:
     IDataArrayShPtrType iDataArray = getAttributeArray(attributeArrayName);
     if(nullptr == iDataArray.get())
     {
-      createAndAddAttributeArray<ArrayType>(filter, attributeArrayName, initValue, compDims);
+      createAndAddAttributeArray<ArrayType>(filter, attributeArrayName, initValue, compDims, RenameDataPath::k_Invalid_ID, initialize);
     }
     else if(filter)
     {
@@ -448,10 +458,11 @@ public:
    * @brief Creates and Adds the data for a named array
    * @param name The name that the array will be known by
    * @param dims The size the data on each tuple
+   * @param initialize When false the elements are not set to initValue. Only pass false if the caller overwrites every element.
    */
   template <class ArrayType>
   void createAndAddAttributeArray(AbstractFilter* filter, const QString& name, typename ArrayType::value_type initValue, std::vector<size_t> compDims,
-                                  RenameDataPath::DataID_t id = RenameDataPath::k_Invalid_ID)
+                                  RenameDataPath::DataID_t id = RenameDataPath::k_Invalid_ID, bool initialize = true)
   {
     bool allocateData = false;
     if(nullptr == filter)
@@ -462,12 +473,21 @@ public:
     {
       allocateData = !filter->getInPreflight();
     }
-    typename ArrayType::Pointer attributeArray = ArrayType::CreateArray(getNumberOfTuples(), compDims, name, allocateData);
+    // Arrays that support it are allocated uninitialized so initializeWithValue() is the only pass over the memory
+    constexpr bool k_DeferInit = HasUninitializedAllocate<ArrayType>::value;
+    typename ArrayType::Pointer attributeArray = ArrayType::CreateArray(getNumberOfTuples(), compDims, name, allocateData && !k_DeferInit);
     if(attributeArray.get() != nullptr)
     {
       if(allocateData)
       {
-        attributeArray->initializeWithValue(initValue);
+        if constexpr(k_DeferInit)
+        {
+          attributeArray->allocateUninitialized();
+        }
+        if(initialize)
+        {
+          attributeArray->initializeWithValue(initValue);
+        }
       }
       attributeArray->setInitValue(initValue);
       addOrReplaceAttributeArray(attributeArray);
@@ -589,6 +609,14 @@ public:
    */
   virtual AttributeMatrix::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Creates a read-only snapshot of the attribute matrix.  Attribute Arrays
+   * that have not been handed out since the previous snapshot are shared with it
+   * instead of being copied.
+   * @return On error, will return a null pointer.
+   */
+  virtual AttributeMatrix::Pointer createSnapshot() const;
+
   /**
    * @brief writeAttributeArraysToHDF5
    * @param parentId
@@ -669,10 +697,60 @@ protected:
   virtual QString writeXdmfAttributeDataHelper(int numComp, const QString& attrType, const QString& dataContainerName, const IDataArrayShPtrType& array, const QString& centering, int precision,
                                                const QString& xdmfTypeName, const QString& hdfFileName, uint8_t gridType = 0) const;
 
+  /**
+   * @brief Reads the values of an array that is loaded on demand before a filter executes on it, so that a
+   * file that cannot be read is reported as a filter error. Does nothing without a filter or during preflight.
+   * @param filter
+   * @param array
+   * @param err The error code to set into the filter if the values could not be read
+   * @return False if the values could not be read
+   */
+  bool loadPrereqArrayValues(AbstractFilter* filter, const IDataArray::Pointer& array, int err) const;
+
 private:
   std::vector<size_t> m_TupleDims;
   AttributeMatrix::Type m_Type = {};
 
+  /**
+   * @brief Detects array types that provide allocateUninitialized()
+   */
+  template <class ArrayType, class = void>
+  struct HasUninitializedAllocate : std::false_type
+  {
+  };
+  template <class ArrayType>
+  struct HasUninitializedAllocate<ArrayType, std::void_t<decltype(std::declval<ArrayType&>().allocateUninitialized())>> : std::true_type
+  {
+  };
+
+  /**
+   * @brief Detects array types that provide setUseFlatStorage()
+   */
+  template <class ArrayType, class = void>
+  struct HasFlatStorage : std::false_type
+  {
+  };
+  template <class ArrayType>
+  struct HasFlatStorage<ArrayType, std::void_t<decltype(std::declval<ArrayType&>().setUseFlatStorage(false))>> : std::true_type
+  {
+  };
+
+  /**
+   * @brief Typed NeighborList access hands out the std::vector accessors, which need nested storage,
+   * so a flat list is converted here once per array.
+   */
+  template <class ArrayType>
+  static void useNestedStorage(const typename ArrayType::Pointer& array)
+  {
+    if constexpr(HasFlatStorage<ArrayType>::value)
+    {
+      if(nullptr != array && array->getUseFlatStorage())
+      {
+        array->setUseFlatStorage(false);
+      }
+    }
+  }
+
   AttributeMatrix(const AttributeMatrix&);
   void operator=(const AttributeMatrix&);
 };
@@ -352,6 +352,23 @@ DataContainer::Pointer DataContainer::deepCopy(bool forceNoAllocate) const
   return dcCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer DataContainer::createSnapshot() const
+{
+  DataContainer::Pointer dcSnapshot = DataContainer::New(getName());
+
+  if(m_Geometry.get() != nullptr)
+  {
+    dcSnapshot->setGeometry(m_Geometry->deepCopy(false));
+  }
+
+  snapshotChildrenInto(*dcSnapshot, [](const AttributeMatrix::Pointer& am) { return am->createSnapshot(); });
+
+  return dcSnapshot;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
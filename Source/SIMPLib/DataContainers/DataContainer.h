@@ -409,6 +409,14 @@ public:
    */
   virtual DataContainer::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Creates a read-only snapshot of the DataContainer.  Attribute Matrices
+   * that have not been handed out since the previous snapshot are shared with it
+   * instead of being copied.  The geometry is always copied.
+   * @return
+   */
+  virtual DataContainer::Pointer createSnapshot() const;
+
   /**
    * @brief writeMeshToHDF5
    * @param dcGid
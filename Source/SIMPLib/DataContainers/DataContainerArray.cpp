@@ -45,11 +45,28 @@
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Montages/AbstractMontage.h"
 #include "SIMPLib/Montages/GridMontage.h"
 
 namespace
 {
+/**
+ * @brief Flags the DataContainers referenced by the montage as modified, as the
+ * montage hands them out without going through the DataContainerArray.
+ * @param montage
+ */
+void markMontageModified(const AbstractMontage::Pointer& montage)
+{
+  for(const auto& dc : montage->getDataContainers())
+  {
+    if(nullptr != dc)
+    {
+      dc->markModified();
+    }
+  }
+}
+
 template <class Container>
 bool validateNumberOfTuplesImpl(const DataContainerArray& dca, AbstractFilter* filter, const Container& paths)
 {
@@ -371,6 +388,11 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       if(nullptr != obs)
       {
         QString ss = QObject::tr("Error reading AttributeMatrix Data from '%1'").arg(dcProxy.getName());
+        const QString reason = H5DataArrayReader::GetThreadReadError();
+        if(!reason.isEmpty())
+        {
+          ss += QString(": %1").arg(reason);
+        }
         obs->setErrorCondition(-198745604, ss);
       }
       return -198745604;
@@ -400,13 +422,8 @@ bool DataContainerArray::doesDataContainerExist(const QString& name) const
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path) const
 {
-  if(!doesDataContainerExist(path.getDataContainerName()))
-  {
-    return false;
-  }
-
-  DataContainer::Pointer dc = getDataContainer(path);
-  return dc->doesAttributeMatrixExist(path.getAttributeMatrixName());
+  const DataContainer* dc = getConstChildByName(path.getDataContainerName());
+  return nullptr != dc && dc->doesAttributeMatrixExist(path.getAttributeMatrixName());
 }
 
 // -----------------------------------------------------------------------------
@@ -414,17 +431,14 @@ bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path) con
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeArrayExist(const DataArrayPath& path) const
 {
-  if(!doesDataContainerExist(path.getDataContainerName()))
-  {
-    return false;
-  }
-  if(!doesAttributeMatrixExist(path))
+  const DataContainer* dc = getConstChildByName(path.getDataContainerName());
+  if(nullptr == dc)
   {
     return false;
   }
-  AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
+  const AttributeMatrix* attrMat = dc->getConstChildByName(path.getAttributeMatrixName());
 
-  return attrMat->doesAttributeArrayExist(path.getDataArrayName());
+  return nullptr != attrMat && attrMat->doesAttributeArrayExist(path.getDataArrayName());
 }
 
 // -----------------------------------------------------------------------------
@@ -440,6 +454,7 @@ void DataContainerArray::setDataContainerBundles(QMap<QString, IDataContainerBun
 // -----------------------------------------------------------------------------
 QMap<QString, IDataContainerBundle::Pointer>& DataContainerArray::getDataContainerBundles()
 {
+  markChildrenModified();
   return m_DataContainerBundles;
 }
 
@@ -455,6 +470,7 @@ IDataContainerBundle::Pointer DataContainerArray::getDataContainerBundle(const Q
   if(match != m_DataContainerBundles.cend())
   {
     f = *match;
+    markChildrenModified();
   }
 
   return f;
@@ -527,6 +543,10 @@ bool DataContainerArray::renameDataContainerBundle(const QString& oldName, const
 // -----------------------------------------------------------------------------
 DataContainerArray::MontageCollection DataContainerArray::getMontageCollection() const
 {
+  for(const auto& montage : m_MontageCollection)
+  {
+    markMontageModified(montage);
+  }
   return m_MontageCollection;
 }
 
@@ -565,6 +585,7 @@ AbstractMontageShPtr DataContainerArray::getMontage(const QString& name) const
   {
     return nullptr;
   }
+  markMontageModified(*iter);
   return (*iter);
 }
 
@@ -694,6 +715,60 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate) c
   return dcaCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerArray::createWorkingCopy() const
+{
+  DataContainerArray::Pointer dcaCopy = deepCopy(false);
+
+  // Every copied node remembers the snapshot node it was copied from, so that the next snapshot of the copy shares
+  // the nodes that have not been handed out since
+  const Container dcs = getDataContainers();
+  for(const auto& dc : dcs)
+  {
+    DataContainer::Pointer dcCopy = dcaCopy->getDataContainer(dc->getName());
+    const DataContainer::Container_t ams = dc->getAttributeMatrices();
+    for(const auto& am : ams)
+    {
+      AttributeMatrix::Pointer amCopy = dcCopy->getAttributeMatrix(am->getName());
+      const AttributeMatrix::Container_t arrays = am->getAttributeArrays();
+      for(const auto& array : arrays)
+      {
+        recordSnapshot(amCopy->getAttributeArray(array->getName()).get(), array);
+      }
+      recordSnapshot(amCopy.get(), am);
+    }
+    recordSnapshot(dcCopy.get(), dc);
+  }
+
+  return dcaCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerArray::createSnapshot() const
+{
+  if(m_IsSnapshot)
+  {
+    return createWorkingCopy();
+  }
+
+  DataContainerArray::Pointer dcaSnapshot = DataContainerArray::New();
+  dcaSnapshot->m_IsSnapshot = true;
+  snapshotChildrenInto(*dcaSnapshot, [](const DataContainer::Pointer& dc) { return dc->createSnapshot(); });
+  recordSnapshot(this, dcaSnapshot);
+
+  for(const auto& montage : m_MontageCollection)
+  {
+    AbstractMontage::Pointer montageCopy = montage->propagate(dcaSnapshot);
+    dcaSnapshot->addMontage(montageCopy);
+  }
+
+  return dcaSnapshot;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -531,11 +531,12 @@ public:
    * @param initValue The initial value of all the elements of the array
    * @param size The number of tuples in the Array
    * @param dims The dimensions of the components of the AttributeArray
+   * @param initialize When false the elements are not set to initValue. Only pass false if the caller overwrites every element.
    * @return A Shared Pointer to the newly created array
    */
   template <class ArrayType>
   typename ArrayType::Pointer createNonPrereqArrayFromPath(AbstractFilter* filter, const DataArrayPath& path, typename ArrayType::value_type initValue, const std::vector<size_t>& compDims,
-                                                           const QString& property = "", RenameDataPath::DataID_t id = RenameDataPath::k_Invalid_ID)
+                                                           const QString& property = "", RenameDataPath::DataID_t id = RenameDataPath::k_Invalid_ID, bool initialize = true)
   {
     typename ArrayType::Pointer dataArray = ArrayType::NullPointer();
     QString ss;
@@ -617,7 +618,7 @@ public:
 
     // If something goes wrong at this point the error message will be directly set in the 'filter' object so we just
     // simply return what ever is given to us.
-    dataArray = attrMat->createNonPrereqArray<ArrayType>(filter, path.getDataArrayName(), initValue, compDims, id);
+    dataArray = attrMat->createNonPrereqArray<ArrayType>(filter, path.getDataArrayName(), initValue, compDims, id, initialize);
     return dataArray;
   }
 
@@ -661,12 +662,36 @@ public:
    */
   DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false) const;
 
+  /**
+   * @brief Creates a read-only snapshot of the DataContainerArray for use after
+   * a filter has been preflighted.  Only the nodes that were handed out through
+   * an accessor since the previous snapshot are copied; every other
+   * DataContainer, AttributeMatrix, and DataArray is shared with the previous
+   * snapshot.  Snapshots must not be modified, as their nodes may be referenced
+   * by other snapshots.
+   *
+   * Taking a snapshot of a snapshot returns a writable copy of it instead, such
+   * as the DataContainerArray a preflight restarts from.  The next snapshot of
+   * that copy shares every node the filters leave untouched with the snapshot
+   * it was copied from.
+   * @return
+   */
+  DataContainerArray::Pointer createSnapshot() const;
+
 protected:
   DataContainerArray();
 
 private:
   QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
   MontageCollection m_MontageCollection;
+  bool m_IsSnapshot = false;
+
+  /**
+   * @brief Creates a writable deep copy of this snapshot whose nodes record the
+   * snapshot nodes they were copied from as their last snapshot.
+   * @return
+   */
+  DataContainerArray::Pointer createWorkingCopy() const;
 
   /**
    * @brief setMontageTileFromDataContainerName
@@ -38,6 +38,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "IDataStructureNode.h"
@@ -60,8 +61,143 @@ public:
 
 private:
   ChildCollection m_ChildrenNodes;
+  // Maps the name hash of every child to its position in m_ChildrenNodes. It is
+  // updated by every method that changes the children, so const lookups never
+  // write to it and can run concurrently.
+  std::unordered_map<HashType, size_t> m_NameIndex;
+
+  /**
+   * @brief Returns the index of the child with the given name hash without
+   * flagging it as modified.  Returns -1 if no child matches.
+   * @param nameHash
+   * @return
+   */
+  int64_t findIndexByHash(HashType nameHash) const
+  {
+    const auto iter = m_NameIndex.find(nameHash);
+    if(iter == m_NameIndex.end())
+    {
+      return -1;
+    }
+    const size_t index = iter->second;
+    if(index < m_ChildrenNodes.size() && m_ChildrenNodes[index]->checkNameHash(nameHash))
+    {
+      return static_cast<int64_t>(index);
+    }
+    // The child was replaced through a non-const iterator
+    return findIndexByScan(nameHash);
+  }
+
+  /**
+   * @brief Returns the index of the child with the given name hash by
+   * comparing every child.  Returns -1 if no child matches.
+   * @param nameHash
+   * @return
+   */
+  int64_t findIndexByScan(HashType nameHash) const
+  {
+    const auto numChildren = static_cast<int64_t>(m_ChildrenNodes.size());
+    for(int64_t i = 0; i < numChildren; i++)
+    {
+      if(m_ChildrenNodes[i]->checkNameHash(nameHash))
+      {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Appends the child to the collection and the name index.
+   * @param child
+   */
+  void appendChild(const ChildShPtr& child)
+  {
+    m_ChildrenNodes.push_back(child);
+    m_NameIndex.emplace(child->getNameHash(), m_ChildrenNodes.size() - 1);
+  }
+
+  /**
+   * @brief Removes the child at the given position from the collection and
+   * the name index.  Children behind it move up one position.
+   * @param index
+   */
+  void eraseChild(size_t index)
+  {
+    const auto iter = m_NameIndex.find(m_ChildrenNodes[index]->getNameHash());
+    if(iter != m_NameIndex.end() && iter->second == index)
+    {
+      m_NameIndex.erase(iter);
+    }
+    m_ChildrenNodes.erase(m_ChildrenNodes.begin() + index);
+
+    for(size_t i = index; i < m_ChildrenNodes.size(); i++)
+    {
+      const auto movedIter = m_NameIndex.find(m_ChildrenNodes[i]->getNameHash());
+      if(movedIter != m_NameIndex.end() && movedIter->second == i + 1)
+      {
+        movedIter->second = i;
+      }
+    }
+  }
 
 protected:
+  /**
+   * @brief Flags every child as possibly modified.  Used by accessors that
+   * hand out the whole children collection.
+   */
+  void markChildrenModified() const
+  {
+    for(const auto& child : m_ChildrenNodes)
+    {
+      child->markModified();
+    }
+  }
+
+  /**
+   * @brief Fills the target container with snapshots of this container's
+   * children.  Children that have not been handed out since the previous
+   * snapshot are shared with that snapshot; all others are created with the
+   * copyChild functor.  Shared children are only reused while this container
+   * still has the same path as its previous snapshot.  The target does not
+   * become the parent of the snapshot children, which resolve their paths from
+   * this container's path instead.  Returns false if copyChild failed for any child.
+   * @param target
+   * @param copyChild
+   * @return
+   */
+  template <typename CopyFunc>
+  bool snapshotChildrenInto(Self& target, CopyFunc copyChild) const
+  {
+    const DataArrayPath path = getDataArrayPath();
+    const IDataStructureNode::Pointer previous = getLastSnapshot();
+    const bool canShare = (nullptr != previous) && (previous->getDataArrayPath() == path);
+
+    target.m_ChildrenNodes.reserve(m_ChildrenNodes.size());
+    target.m_NameIndex.reserve(m_ChildrenNodes.size());
+    for(const auto& child : m_ChildrenNodes)
+    {
+      ChildShPtr childSnapshot;
+      if(canShare && !child->isModifiedSinceSnapshot())
+      {
+        childSnapshot = std::dynamic_pointer_cast<DerivedChild_t>(child->getLastSnapshot());
+      }
+      if(nullptr == childSnapshot)
+      {
+        childSnapshot = copyChild(child);
+        if(nullptr == childSnapshot)
+        {
+          return false;
+        }
+        setSnapshotParentPath(childSnapshot.get(), path);
+      }
+
+      target.appendChild(childSnapshot);
+      recordSnapshot(child.get(), childSnapshot);
+    }
+    return true;
+  }
+
 public:
   IDataStructureContainerNode(const QString& name = "")
   : AbstractDataStructureContainer(name)
@@ -80,8 +216,9 @@ public:
    * @brief Returns a copy of the children collection.
    * @return
    */
-  constexpr const ChildCollection& getChildren() const
+  const ChildCollection& getChildren() const
   {
+    markChildrenModified();
     return m_ChildrenNodes;
   }
 
@@ -136,8 +273,9 @@ public:
    * @brief Returns an iterator pointing to the start of the children collection.
    * @return
    */
-  constexpr iterator begin() noexcept
+  iterator begin() noexcept
   {
+    markChildrenModified();
     return m_ChildrenNodes.begin();
   }
 
@@ -145,8 +283,9 @@ public:
    * @brief Returns a const iterator pointing to the start of the children collection.
    * @return
    */
-  constexpr const_iterator begin() const noexcept
+  const_iterator begin() const noexcept
   {
+    markChildrenModified();
     return m_ChildrenNodes.begin();
   }
 
@@ -210,15 +349,17 @@ public:
    */
   constexpr void clear() noexcept
   {
-    auto children = getChildren();
+    // Empty the collection first so the children do not need to be looked up one at a time
+    ChildCollection children;
+    children.swap(m_ChildrenNodes);
+    m_NameIndex.clear();
     for(auto& child : children)
     {
       if(child != nullptr)
       {
-        destroyParentConnection(child.get());
+        detachChild(child.get());
       }
     }
-    m_ChildrenNodes.clear();
   }
 
   /**
@@ -227,18 +368,16 @@ public:
    * @param name
    * @return
    */
-  constexpr iterator find(const QString& name)
+  iterator find(const QString& name)
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
+    const int64_t index = findIndexByHash(CreateStringHash(name));
+    if(index < 0)
     {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
+      return end();
     }
 
-    return end();
+    m_ChildrenNodes[index]->markModified();
+    return m_ChildrenNodes.begin() + index;
   }
 
   /**
@@ -247,18 +386,16 @@ public:
    * @param name
    * @return
    */
-  constexpr const_iterator find(const QString& name) const
+  const_iterator find(const QString& name) const
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
+    const int64_t index = findIndexByHash(CreateStringHash(name));
+    if(index < 0)
     {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
+      return cend();
     }
 
-    return cend();
+    m_ChildrenNodes[index]->markModified();
+    return m_ChildrenNodes.cbegin() + index;
   }
 
   /**
@@ -267,19 +404,34 @@ public:
    * @param name
    * @return
    */
-  constexpr ChildShPtr getChildByName(const QString& name) const
+  ChildShPtr getChildByName(const QString& name) const
   {
-    HashType nameHash = CreateStringHash(name);
+    const int64_t index = findIndexByHash(CreateStringHash(name));
+    if(index < 0)
+    {
+      return nullptr;
+    }
 
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    const ChildShPtr& child = m_ChildrenNodes[index];
+    child->markModified();
+    return child;
+  }
+
+  /**
+   * @brief Returns a read-only pointer to the child with the given name.
+   * Unlike getChildByName, this does not flag the child as modified for the
+   * next snapshot.  If no child is found, return nullptr.
+   * @param name
+   * @return
+   */
+  const DerivedChild_t* getConstChildByName(const QString& name) const
+  {
+    const int64_t index = findIndexByHash(CreateStringHash(name));
+    if(index < 0)
     {
-      if(child->checkNameHash(nameHash))
-      {
-        return child;
-      }
+      return nullptr;
     }
-    return nullptr;
+    return m_ChildrenNodes[index].get();
   }
 
   /**
@@ -290,7 +442,7 @@ public:
    */
   constexpr bool contains(const QString& name) const
   {
-    return getChildByName(name) != nullptr;
+    return findIndexByHash(CreateStringHash(name)) >= 0;
   }
 
   /**
@@ -301,8 +453,7 @@ public:
    */
   constexpr bool contains(const ChildShPtr& obj) const
   {
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    for(const auto& child : m_ChildrenNodes)
     {
       if(child == obj)
       {
@@ -320,28 +471,26 @@ public:
    */
   constexpr int64_t getIndex(const QString& name) const
   {
-    auto iter = find(name);
-    if(iter == cend())
-    {
-      return -1;
-    }
-    return iter - begin();
+    return findIndexByHash(CreateStringHash(name));
   }
 
   /**
    * @brief Returns the child node at the given index.  If index is greater than
-   * the specified index, throw out_of_range exception.
+   * the specified index, throw out_of_range exception.  The returned pointer
+   * can not be reassigned; use insertOrAssign to replace a child so the name
+   * lookup stays in sync.
    * @param index
    * @return
    */
-  constexpr ChildShPtr& operator[](size_t index)
+  constexpr const ChildShPtr& operator[](size_t index)
   {
-    if(index < 0 || index > m_ChildrenNodes.size())
+    if(index >= m_ChildrenNodes.size())
     {
       const char msg[] = "Index is out of range for the IDataStructureContainerNode's children collection.";
       throw std::out_of_range(msg);
     }
 
+    m_ChildrenNodes[index]->markModified();
     return m_ChildrenNodes[index];
   }
 
@@ -351,7 +500,7 @@ public:
    * @param name
    * @return
    */
-  constexpr ChildShPtr& operator[](const QString& name)
+  constexpr const ChildShPtr& operator[](const QString& name)
   {
     return operator[](getIndex(name));
   }
@@ -384,7 +533,8 @@ public:
       return false;
     }
     typename ChildCollection::size_type size = m_ChildrenNodes.size();
-    m_ChildrenNodes.push_back(node);
+    appendChild(node);
+    node->markModified();
 
     createParentConnection(node.get(), this);
     return (size != m_ChildrenNodes.size());
@@ -417,7 +567,8 @@ public:
       }
     }
 
-    m_ChildrenNodes.push_back(node);
+    appendChild(node);
+    node->markModified();
     createParentConnection(node.get(), this);
     return true;
   }
@@ -429,8 +580,8 @@ public:
   void erase(iterator iter)
   {
     ChildShPtr child = (*iter);
-    m_ChildrenNodes.erase(iter);
-    destroyParentConnection(child.get());
+    eraseChild(static_cast<size_t>(iter - m_ChildrenNodes.begin()));
+    detachChild(child.get());
   }
 
   /**
@@ -445,16 +596,45 @@ public:
       return NullPointer();
     }
 
-    for(auto iter = m_ChildrenNodes.begin(); iter != m_ChildrenNodes.end(); ++iter)
+    int64_t index = findIndexByHash(rmChild->getNameHash());
+    if(index < 0 || m_ChildrenNodes[index].get() != rmChild)
     {
-      if((*iter).get() == rmChild)
+      // Another node with the same name, e.g. after the child was replaced
+      index = -1;
+      const auto numChildren = static_cast<int64_t>(m_ChildrenNodes.size());
+      for(int64_t i = 0; i < numChildren; i++)
       {
-        ChildShPtr ptr = *iter;
-        m_ChildrenNodes.erase(iter);
-        return ptr;
+        if(m_ChildrenNodes[i].get() == rmChild)
+        {
+          index = i;
+          break;
+        }
       }
     }
+    if(index < 0)
+    {
+      return NullPointer();
+    }
 
-    return NullPointer();
+    ChildShPtr ptr = m_ChildrenNodes[index];
+    eraseChild(static_cast<size_t>(index));
+    return ptr;
+  }
+
+  /**
+   * @brief Moves the renamed child to its new name in the name index.
+   * @param child
+   * @param oldNameHash
+   */
+  void updateChildName(const IDataStructureNode* child, HashType oldNameHash) override
+  {
+    const auto iter = m_NameIndex.find(oldNameHash);
+    if(iter == m_NameIndex.end() || iter->second >= m_ChildrenNodes.size() || m_ChildrenNodes[iter->second].get() != child)
+    {
+      return;
+    }
+    const size_t index = iter->second;
+    m_NameIndex.erase(iter);
+    m_NameIndex.emplace(child->getNameHash(), index);
   }
 };
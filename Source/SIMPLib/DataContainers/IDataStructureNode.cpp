@@ -119,12 +119,16 @@ bool IDataStructureNode::setName(const QString& newName)
   {
     m_Name = newName;
     updateNameHash();
+    markModified();
     return true;
   }
   else if(!m_Parent->hasChildWithName(newName))
   {
+    const HashType oldNameHash = m_NameHash;
     m_Name = newName;
     updateNameHash();
+    markModified();
+    m_Parent->updateChildName(this, oldNameHash);
     return true;
   }
 
@@ -156,6 +160,16 @@ void IDataStructureNode::setParentNode(ParentType* parent)
   }
 
   m_Parent = parent;
+  m_SnapshotParentPath = DataArrayPath();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataStructureNode::setLastSnapshot(const Pointer& snapshot) const
+{
+  m_LastSnapshot = snapshot;
+  m_ModifiedSinceSnapshot = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -177,7 +191,7 @@ DataArrayPath IDataStructureNode::getParentPath() const
 {
   if(!hasParent())
   {
-    return DataArrayPath();
+    return m_SnapshotParentPath;
   }
   return getParentNode()->getDataArrayPath();
 }
@@ -195,7 +209,39 @@ void AbstractDataStructureContainer::createParentConnection(IDataStructureNode*
 // -----------------------------------------------------------------------------
 void AbstractDataStructureContainer::destroyParentConnection(IDataStructureNode* child) const
 {
-  child->clearParentNode();
+  // Snapshot nodes are shared between several containers without a parent pointer.
+  // Only the container that owns the parent pointer may clear it.
+  if(child->getParentNode() == this)
+  {
+    child->clearParentNode();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractDataStructureContainer::detachChild(IDataStructureNode* child) const
+{
+  if(child->m_Parent == this)
+  {
+    child->m_Parent = nullptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractDataStructureContainer::setSnapshotParentPath(IDataStructureNode* child, const DataArrayPath& parentPath) const
+{
+  child->m_SnapshotParentPath = parentPath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractDataStructureContainer::recordSnapshot(const IDataStructureNode* child, const IDataStructureNode::Pointer& snapshot) const
+{
+  child->setLastSnapshot(snapshot);
 }
 
 // -----------------------------------------------------------------------------
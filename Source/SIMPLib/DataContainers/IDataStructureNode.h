@@ -82,6 +82,9 @@ private:
   QString m_Name;
   ParentType* m_Parent = nullptr;
   HashType m_NameHash = 0;
+  mutable bool m_ModifiedSinceSnapshot = true;
+  mutable WeakPointer m_LastSnapshot;
+  DataArrayPath m_SnapshotParentPath;
 
   /**
    * @brief Updates the name hash variable based on the current name.
@@ -106,6 +109,14 @@ private:
     setParentNode(nullptr);
   }
 
+  /**
+   * @brief Stores the snapshot taken of this node and clears the modified flag.
+   * This should only be called from IDataStructureContainerNode::snapshotChildrenInto
+   * or when snapshotting the root of a data structure.
+   * @param snapshot
+   */
+  void setLastSnapshot(const Pointer& snapshot) const;
+
   // void addParentNode(const ParentType& newParent);
   // bool removeParentNode(const ParentType& removedParent);
 
@@ -134,6 +145,15 @@ public:
     return m_NameHash == nameHash;
   }
 
+  /**
+   * @brief Returns the hash of the node's name.
+   * @return
+   */
+  HashType getNameHash() const
+  {
+    return m_NameHash;
+  }
+
   /**
    * @brief Returns the node's name.
    * @return
@@ -162,7 +182,9 @@ public:
   virtual DataArrayPath getDataArrayPath() const = 0;
 
   /**
-   * @brief Returns the parent node's DataArrayPath.  If no parent node exists, return an empty path;
+   * @brief Returns the parent node's DataArrayPath.  Snapshot nodes have no parent node
+   * and return the path of the container they were snapshotted from instead.  If neither
+   * exists, return an empty path;
    * @return
    */
   DataArrayPath getParentPath() const;
@@ -175,6 +197,36 @@ public:
   {
     return m_Parent != nullptr;
   }
+
+  /**
+   * @brief Flags the node as possibly modified since its last snapshot was
+   * taken.  Container accessors call this for every child they hand out so
+   * that the next snapshot copies the child instead of sharing it.
+   */
+  void markModified() const
+  {
+    m_ModifiedSinceSnapshot = true;
+  }
+
+  /**
+   * @brief Returns true if the node may have changed since its last snapshot
+   * was taken.  Nodes that were never snapshotted always return true.
+   * @return
+   */
+  bool isModifiedSinceSnapshot() const
+  {
+    return m_ModifiedSinceSnapshot;
+  }
+
+  /**
+   * @brief Returns the snapshot taken of this node by the most recent call to
+   * DataContainerArray::createSnapshot if it is still alive.  Returns nullptr otherwise.
+   * @return
+   */
+  Pointer getLastSnapshot() const
+  {
+    return m_LastSnapshot.lock();
+  }
 };
 
 /**
@@ -209,6 +261,14 @@ public:
    */
   virtual IDataStructureNode::Pointer removeChildNode(const IDataStructureNode* rmChild) = 0;
 
+  /**
+   * @brief Called by IDataStructureNode::setName after a child was renamed so the
+   * container can move the child to its new name in the name lookup.
+   * @param child
+   * @param oldNameHash
+   */
+  virtual void updateChildName(const IDataStructureNode* child, HashType oldNameHash) = 0;
+
 protected:
   /**
    * @brief Sets the child's parent container.  This does not add the child to the parent's collection.
@@ -218,10 +278,37 @@ protected:
    */
   void createParentConnection(IDataStructureNode* child, AbstractDataStructureContainer* parent) const;
 
+  /**
+   * @brief Stores the path of the container a snapshot node was created from.
+   * Snapshot nodes can be shared between several snapshots, so they never get a
+   * parent pointer and resolve their path from this instead.  The path is the
+   * same in every snapshot sharing the node, since nodes are only shared while
+   * their container's path is unchanged.
+   * @param child
+   * @param parentPath
+   */
+  void setSnapshotParentPath(IDataStructureNode* child, const DataArrayPath& parentPath) const;
+
+  /**
+   * @brief Records the given snapshot as the child's most recent snapshot.
+   * @param child
+   * @param snapshot
+   */
+  void recordSnapshot(const IDataStructureNode* child, const IDataStructureNode::Pointer& snapshot) const;
+
   /**
    * @brief Clears the child's parent pointer.  This does not remove the child from the parent's collection.
    * THIS METHOD IS ONLY USED BY IDataStructureNode<T> AND SHOULD NOT BE USED BY ANY CLASS THAT DERIVES FROM IT.
    * @param child
    */
   void destroyParentConnection(IDataStructureNode* child) const;
+
+  /**
+   * @brief Clears the child's parent pointer if it points at this container.
+   * Unlike destroyParentConnection, this does not ask the container to remove
+   * the child again and should only be called after the child was already
+   * removed from the children collection.
+   * @param child
+   */
+  void detachChild(IDataStructureNode* child) const;
 };
@@ -0,0 +1,353 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataContainerArraySnapshotTest
+{
+public:
+  DataContainerArraySnapshotTest() = default;
+  virtual ~DataContainerArraySnapshotTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray(int numDataContainers, int numArrays)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    std::vector<size_t> tDims = {10, 10, 10};
+    std::vector<size_t> cDims = {1};
+    for(int i = 0; i < numDataContainers; i++)
+    {
+      DataContainer::Pointer dc = DataContainer::New("DataContainer_" + QString::number(i));
+      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+      for(int j = 0; j < numArrays; j++)
+      {
+        am->insertOrAssign(FloatArrayType::CreateArray(tDims, cDims, "Array_" + QString::number(j), false));
+      }
+      dc->addOrReplaceAttributeMatrix(am);
+      dca->addOrReplaceDataContainer(dc);
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUntouchedNodesAreShared()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(2, 3);
+    DataContainerArray::Pointer snapshot0 = dca->createSnapshot();
+
+    // Nothing has been handed out yet, so every DataContainer is shared
+    DataContainerArray::Pointer snapshot1 = dca->createSnapshot();
+    DREAM3D_REQUIRE(snapshot0 != snapshot1)
+    DREAM3D_REQUIRE(snapshot0->getDataContainer("DataContainer_0") == snapshot1->getDataContainer("DataContainer_0"))
+    DREAM3D_REQUIRE(snapshot0->getDataContainer("DataContainer_1") == snapshot1->getDataContainer("DataContainer_1"))
+
+    // Touch a single array in the first DataContainer
+    IDataArray::Pointer touched = dca->getPrereqIDataArrayFromPath(nullptr, DataArrayPath("DataContainer_0", "CellData", "Array_1"));
+    DREAM3D_REQUIRE_VALID_POINTER(touched.get())
+
+    DataContainerArray::Pointer snapshot2 = dca->createSnapshot();
+    DataContainer::Pointer dc0Before = snapshot1->getDataContainer("DataContainer_0");
+    DataContainer::Pointer dc0After = snapshot2->getDataContainer("DataContainer_0");
+    DREAM3D_REQUIRE(dc0Before != dc0After)
+    DREAM3D_REQUIRE(snapshot1->getDataContainer("DataContainer_1") == snapshot2->getDataContainer("DataContainer_1"))
+
+    AttributeMatrix::Pointer amBefore = dc0Before->getAttributeMatrix("CellData");
+    AttributeMatrix::Pointer amAfter = dc0After->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE(amBefore != amAfter)
+    DREAM3D_REQUIRE(amBefore->getAttributeArray("Array_0") == amAfter->getAttributeArray("Array_0"))
+    DREAM3D_REQUIRE(amBefore->getAttributeArray("Array_1") != amAfter->getAttributeArray("Array_1"))
+    DREAM3D_REQUIRE(amBefore->getAttributeArray("Array_2") == amAfter->getAttributeArray("Array_2"))
+
+    // The snapshot never shares nodes with the working structure
+    DREAM3D_REQUIRE(amAfter->getAttributeArray("Array_1") != touched)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSharedNodesOutliveOlderSnapshots()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(1, 2);
+    DataContainerArray::Pointer snapshot0 = dca->createSnapshot();
+
+    dca->getAttributeMatrix(DataArrayPath("DataContainer_0", "CellData", ""));
+    DataContainerArray::Pointer snapshot1 = dca->createSnapshot();
+
+    IDataArray::Pointer shared = snapshot1->getPrereqIDataArrayFromPath(nullptr, DataArrayPath("DataContainer_0", "CellData", "Array_0"));
+    DREAM3D_REQUIRE_VALID_POINTER(shared.get())
+
+    // Releasing the older snapshot must not detach the nodes the newer one still uses
+    snapshot0 = DataContainerArray::NullPointer();
+    DREAM3D_REQUIRE(snapshot1->doesAttributeArrayExist(DataArrayPath("DataContainer_0", "CellData", "Array_0")))
+    DREAM3D_REQUIRE(shared->getDataArrayPath() == DataArrayPath("DataContainer_0", "CellData", "Array_0"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSharedNodesOutliveNewerSnapshots()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(1, 2);
+    DataContainerArray::Pointer snapshot0 = dca->createSnapshot();
+
+    dca->getAttributeMatrix(DataArrayPath("DataContainer_0", "CellData", ""));
+    DataContainerArray::Pointer snapshot1 = dca->createSnapshot();
+
+    const DataArrayPath arrayPath("DataContainer_0", "CellData", "Array_0");
+    IDataArray::Pointer shared = snapshot0->getPrereqIDataArrayFromPath(nullptr, arrayPath);
+    DREAM3D_REQUIRE(shared == snapshot1->getPrereqIDataArrayFromPath(nullptr, arrayPath))
+
+    // Shared nodes do not point at either snapshot, so releasing one cannot leave a stale parent behind
+    DREAM3D_REQUIRE_EQUAL(shared->hasParent(), false)
+    snapshot1 = DataContainerArray::NullPointer();
+    DREAM3D_REQUIRE(shared == snapshot0->getPrereqIDataArrayFromPath(nullptr, arrayPath))
+    DREAM3D_REQUIRE(shared->getDataArrayPath() == arrayPath)
+    DREAM3D_REQUIRE(snapshot0->getAttributeMatrix(DataArrayPath("DataContainer_0", "CellData", ""))->getDataArrayPath() == DataArrayPath("DataContainer_0", "CellData", ""))
+
+    // A copy of a snapshot gets regular parent pointers again
+    DataContainerArray::Pointer copy = snapshot0->deepCopy(false);
+    IDataArray::Pointer copied = copy->getPrereqIDataArrayFromPath(nullptr, arrayPath);
+    DREAM3D_REQUIRE(copied->hasParent())
+    DREAM3D_REQUIRE(copied->getDataArrayPath() == arrayPath)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStructuralChangesAreCopied()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(3, 2);
+    DataContainerArray::Pointer snapshot0 = dca->createSnapshot();
+
+    dca->renameDataContainer("DataContainer_1", "Renamed");
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer_0", "CellData", ""));
+    am->removeAttributeArray("Array_0");
+    dca->removeDataContainer("DataContainer_0");
+    dca->addOrReplaceDataContainer(DataContainer::New("DataContainer_0"));
+    dca->getAttributeMatrix(DataArrayPath("DataContainer_2", "CellData", ""))->resizeAttributeArrays({5, 5, 5});
+
+    DataContainerArray::Pointer snapshot1 = dca->createSnapshot();
+    DataContainerArray::Pointer deepCopy = dca->deepCopy(false);
+
+    DREAM3D_REQUIRE(snapshot1->getDataContainerNames() == deepCopy->getDataContainerNames())
+    DREAM3D_REQUIRE_EQUAL(snapshot1->getDataContainer("DataContainer_0")->getNumAttributeMatrices(), 0)
+
+    // A renamed DataContainer is copied so that paths in the older snapshot stay valid
+    AttributeMatrix::Pointer renamedAm = snapshot1->getAttributeMatrix(DataArrayPath("Renamed", "CellData", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(renamedAm.get())
+    DREAM3D_REQUIRE(renamedAm->getDataArrayPath() == DataArrayPath("Renamed", "CellData", ""))
+    DREAM3D_REQUIRE(renamedAm->getAttributeArray("Array_0")->getDataArrayPath() == DataArrayPath("Renamed", "CellData", "Array_0"))
+
+    AttributeMatrix::Pointer oldAm = snapshot0->getAttributeMatrix(DataArrayPath("DataContainer_1", "CellData", ""));
+    DREAM3D_REQUIRE(oldAm->getAttributeArray("Array_0")->getDataArrayPath() == DataArrayPath("DataContainer_1", "CellData", "Array_0"))
+
+    // A resized AttributeMatrix is copied, so the older snapshot keeps its tuple count
+    AttributeMatrix::Pointer resizedAm = snapshot1->getAttributeMatrix(DataArrayPath("DataContainer_2", "CellData", ""));
+    DREAM3D_REQUIRE_EQUAL(resizedAm->getNumberOfTuples(), 125)
+    DREAM3D_REQUIRE_EQUAL(resizedAm->getAttributeArray("Array_0")->getNumberOfTuples(), 125)
+    AttributeMatrix::Pointer unresizedAm = snapshot0->getAttributeMatrix(DataArrayPath("DataContainer_2", "CellData", ""));
+    DREAM3D_REQUIRE_EQUAL(unresizedAm->getNumberOfTuples(), 1000)
+    DREAM3D_REQUIRE_EQUAL(unresizedAm->getAttributeArray("Array_0")->getNumberOfTuples(), 1000)
+    DREAM3D_REQUIRE_EQUAL(snapshot0->getAttributeMatrix(DataArrayPath("DataContainer_0", "CellData", ""))->getNumAttributeArrays(), 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotOfSnapshot()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(2, 2);
+    DataContainerArray::Pointer snapshot0 = dca->createSnapshot();
+
+    // A snapshot of a snapshot is a writable copy with regular parent pointers
+    DataContainerArray::Pointer restart = snapshot0->createSnapshot();
+    const DataArrayPath amPath0("DataContainer_0", "CellData", "");
+    const DataArrayPath amPath1("DataContainer_1", "CellData", "");
+    AttributeMatrix::Pointer am = restart->getAttributeMatrix(amPath0);
+    DREAM3D_REQUIRE(am != snapshot0->getAttributeMatrix(amPath0))
+    DREAM3D_REQUIRE(am->hasParent())
+    DREAM3D_REQUIRE(am->getAttributeArray("Array_0")->hasParent())
+
+    am->resizeAttributeArrays({5, 5, 5});
+    DREAM3D_REQUIRE_EQUAL(snapshot0->getAttributeMatrix(amPath0)->getNumberOfTuples(), 1000)
+
+    // The next snapshot only copies what was touched since the copy and shares the rest with the first snapshot
+    DataContainerArray::Pointer snapshot1 = restart->createSnapshot();
+    DREAM3D_REQUIRE(snapshot1->getAttributeMatrix(amPath1) == snapshot0->getAttributeMatrix(amPath1))
+    DREAM3D_REQUIRE(snapshot1->getAttributeMatrix(amPath0) != snapshot0->getAttributeMatrix(amPath0))
+    DREAM3D_REQUIRE_EQUAL(snapshot1->getAttributeMatrix(amPath0)->getNumberOfTuples(), 125)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotScaling()
+  {
+    std::cout << "\tSimulated preflight: one touched and one created array per filter" << std::endl;
+    std::cout << "\t" << std::setw(8) << "Arrays" << std::setw(10) << "Filters" << std::setw(18) << "deepCopy (ms)" << std::setw(18) << "snapshot (ms)" << std::endl;
+
+    for(int numArrays : {100, 1000, 5000})
+    {
+      for(int numFilters : {10, 50, 150})
+      {
+        std::vector<DataContainerArray::Pointer> snapshots;
+        snapshots.reserve(numFilters);
+
+        DataContainerArray::Pointer dca = createDataContainerArray(4, numArrays / 4);
+        auto start = std::chrono::steady_clock::now();
+        for(int i = 0; i < numFilters; i++)
+        {
+          simulateFilter(dca, i);
+          snapshots.push_back(dca->deepCopy(false));
+        }
+        auto deepCopyTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        snapshots.clear();
+        dca = createDataContainerArray(4, numArrays / 4);
+        start = std::chrono::steady_clock::now();
+        for(int i = 0; i < numFilters; i++)
+        {
+          simulateFilter(dca, i);
+          snapshots.push_back(dca->createSnapshot());
+        }
+        auto snapshotTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << "\t" << std::setw(8) << numArrays << std::setw(10) << numFilters << std::setw(18) << deepCopyTime.count() << std::setw(18) << snapshotTime.count() << std::endl;
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void simulateFilter(const DataContainerArray::Pointer& dca, int index)
+  {
+    DataArrayPath path("DataContainer_" + QString::number(index % 4), "CellData", "Array_0");
+    dca->getPrereqIDataArrayFromPath(nullptr, path);
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(path);
+    am->insertOrAssign(FloatArrayType::CreateArray(am->getNumberOfTuples(), {1}, "Created_" + QString::number(index), false));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createPipeline(int numFilters)
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath("DataContainer", "", ""));
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{100.0, 100.0, 100.0}};
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    for(int i = 0; i < numFilters; i++)
+    {
+      CreateDataArray::Pointer createArray = CreateDataArray::New();
+      createArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+      createArray->setNumberOfComponents(1);
+      createArray->setInitializationType(0);
+      createArray->setInitializationValue("0");
+      createArray->setNewArray(DataArrayPath("DataContainer", "CellData", "Array_" + QString::number(i)));
+      pipeline->pushBack(createArray);
+    }
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPreflightTimes()
+  {
+    for(int numFilters : {10, 50, 150, 500})
+    {
+      FilterPipeline::Pointer pipeline = createPipeline(numFilters);
+
+      auto start = std::chrono::steady_clock::now();
+      int err = pipeline->preflightPipeline();
+      auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+      DREAM3D_REQUIRED(err, >=, 0)
+
+      std::cout << "\tPreflight of " << numFilters << " filters: " << elapsed.count() << " milliseconds" << std::endl;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataContainerArraySnapshotTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestUntouchedNodesAreShared())
+    DREAM3D_REGISTER_TEST(TestSharedNodesOutliveOlderSnapshots())
+    DREAM3D_REGISTER_TEST(TestSharedNodesOutliveNewerSnapshots())
+    DREAM3D_REGISTER_TEST(TestStructuralChangesAreCopied())
+    DREAM3D_REGISTER_TEST(TestSnapshotOfSnapshot())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestSnapshotScaling())
+    DREAM3D_REGISTER_TEST(TestPreflightTimes())
+#endif
+  }
+
+private:
+  DataContainerArraySnapshotTest(const DataContainerArraySnapshotTest&); // Copy Constructor Not Implemented
+  void operator=(const DataContainerArraySnapshotTest&);                 // Move assignment Not Implemented
+};
@@ -0,0 +1,258 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataStructureNameIndexTest
+{
+public:
+  DataStructureNameIndexTest() = default;
+  virtual ~DataStructureNameIndexTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer createAttributeMatrix(int numArrays)
+  {
+    std::vector<size_t> tDims = {1};
+    std::vector<size_t> cDims = {1};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    for(int i = 0; i < numArrays; i++)
+    {
+      am->insertOrAssign(FloatArrayType::CreateArray(tDims, cDims, "Array_" + QString::number(i), false));
+    }
+    return am;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every child has to be found at its position in the collection and nothing else may be found
+  // -----------------------------------------------------------------------------
+  void requireConsistentIndex(const AttributeMatrix::Pointer& am)
+  {
+    AttributeMatrix::NameList names = am->getNamesOfChildren();
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(names.size()), am->size())
+    for(int i = 0; i < names.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(am->getIndex(names[i]), i)
+      DREAM3D_REQUIRE(am->getAttributeArray(names[i])->getName() == names[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInsertAndRemove()
+  {
+    AttributeMatrix::Pointer am = createAttributeMatrix(100);
+    requireConsistentIndex(am);
+
+    // Names are kept in insertion order
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_0"), 0)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_99"), 99)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Missing"), -1)
+
+    // Duplicate names are rejected
+    std::vector<size_t> tDims = {1};
+    std::vector<size_t> cDims = {1};
+    DREAM3D_REQUIRE_EQUAL(am->push_back(FloatArrayType::CreateArray(tDims, cDims, "Array_5", false)), false)
+    DREAM3D_REQUIRE_EQUAL(am->size(), 100)
+
+    // Removing from the front, the middle and the back moves the children behind them
+    DREAM3D_REQUIRE_VALID_POINTER(am->removeAttributeArray("Array_0").get())
+    DREAM3D_REQUIRE_VALID_POINTER(am->removeAttributeArray("Array_50").get())
+    DREAM3D_REQUIRE_VALID_POINTER(am->removeAttributeArray("Array_99").get())
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_0"), -1)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_1"), 0)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_51"), 49)
+    requireConsistentIndex(am);
+
+    // Replacing a child keeps the lookup pointing at the new one and detaches the old one
+    IDataArray::Pointer replaced = am->getAttributeArray("Array_10");
+    IDataArray::Pointer replacement = FloatArrayType::CreateArray(tDims, cDims, "Array_10", false);
+    DREAM3D_REQUIRE(am->insertOrAssign(replacement))
+    DREAM3D_REQUIRE(am->getAttributeArray("Array_10") == replacement)
+    DREAM3D_REQUIRE_EQUAL(replaced->hasParent(), false)
+    DREAM3D_REQUIRE(replacement->getParentNode() == am.get())
+    requireConsistentIndex(am);
+
+    // A child that is destroyed or moved to another container leaves the index
+    AttributeMatrix::Pointer other = AttributeMatrix::New(tDims, "Other", AttributeMatrix::Type::Cell);
+    other->insertOrAssign(am->getAttributeArray("Array_20"));
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_20"), -1)
+    DREAM3D_REQUIRE_EQUAL(other->getIndex("Array_20"), 0)
+    requireConsistentIndex(am);
+
+    am->clear();
+    DREAM3D_REQUIRE_EQUAL(am->size(), 0)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_1"), -1)
+    DREAM3D_REQUIRE(am->push_back(FloatArrayType::CreateArray(tDims, cDims, "Array_1", false)))
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_1"), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRename()
+  {
+    AttributeMatrix::Pointer am = createAttributeMatrix(10);
+
+    DREAM3D_REQUIRE_EQUAL(am->renameAttributeArray("Array_3", "Renamed"), SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_3"), -1)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Renamed"), 3)
+    requireConsistentIndex(am);
+
+    // Renaming the node directly also updates its container
+    am->getAttributeArray("Array_4")->setName("Direct");
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Array_4"), -1)
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("Direct"), 4)
+    DREAM3D_REQUIRE_EQUAL(am->getAttributeArray("Array_5")->setName("Direct"), false)
+    requireConsistentIndex(am);
+
+    // Renames applied to a whole structure, as RenameDataPath does
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    DataArrayPath::RenameContainer renames;
+    renames.push_back(std::make_pair(DataArrayPath("DataContainer", "CellData", "Array_0"), DataArrayPath("DataContainer", "CellData", "First")));
+    renames.push_back(std::make_pair(DataArrayPath("DataContainer", "CellData", ""), DataArrayPath("DataContainer", "Cells", "")));
+    renames.push_back(std::make_pair(DataArrayPath("DataContainer", "", ""), DataArrayPath("Geometry", "", "")));
+    dca->renameDataArrayPaths(renames);
+
+    DREAM3D_REQUIRE(dca->getDataContainer("DataContainer") == nullptr)
+    DREAM3D_REQUIRE(dca->getDataContainer("Geometry") == dc)
+    DREAM3D_REQUIRE(dc->getAttributeMatrix("CellData") == nullptr)
+    DREAM3D_REQUIRE(dc->getAttributeMatrix("Cells") == am)
+    DREAM3D_REQUIRE_VALID_POINTER(dca->getAttributeMatrix(DataArrayPath("Geometry", "Cells", "")).get())
+    DREAM3D_REQUIRE_EQUAL(am->getIndex("First"), 0)
+    requireConsistentIndex(am);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSnapshotsKeepTheirIndex()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = createAttributeMatrix(20);
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+
+    DataContainerArray::Pointer snapshot0 = dca->createSnapshot();
+    am->removeAttributeArray("Array_0");
+    am->renameAttributeArray("Array_1", "Renamed");
+    DataContainerArray::Pointer snapshot1 = dca->createSnapshot();
+
+    AttributeMatrix::Pointer am0 = snapshot0->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    AttributeMatrix::Pointer am1 = snapshot1->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    DREAM3D_REQUIRE_EQUAL(am0->getIndex("Array_0"), 0)
+    DREAM3D_REQUIRE_EQUAL(am0->getIndex("Array_1"), 1)
+    DREAM3D_REQUIRE_EQUAL(am1->getIndex("Array_0"), -1)
+    DREAM3D_REQUIRE_EQUAL(am1->getIndex("Renamed"), 0)
+    requireConsistentIndex(am0);
+    requireConsistentIndex(am1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNameIndexScaling()
+  {
+    std::cout << "\t" << std::setw(10) << "Children" << std::setw(18) << "insert (ms)" << std::setw(18) << "lookup (ms)" << std::setw(20) << "ns per lookup" << std::endl;
+
+    for(int numArrays : {100, 1000, 10000, 100000})
+    {
+      std::vector<size_t> tDims = {1};
+      std::vector<size_t> cDims = {1};
+      std::vector<IDataArray::Pointer> arrays;
+      arrays.reserve(numArrays);
+      for(int i = 0; i < numArrays; i++)
+      {
+        arrays.push_back(FloatArrayType::CreateArray(tDims, cDims, "Array_" + QString::number(i), false));
+      }
+
+      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+      auto start = std::chrono::steady_clock::now();
+      for(const auto& array : arrays)
+      {
+        am->insertOrAssign(array);
+      }
+      auto insertTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+      DREAM3D_REQUIRE_EQUAL(am->size(), static_cast<size_t>(numArrays))
+
+      QList<QString> names = am->getNamesOfChildren();
+      size_t found = 0;
+      start = std::chrono::steady_clock::now();
+      for(const auto& name : names)
+      {
+        found += (nullptr != am->getAttributeArray(name)) ? 1 : 0;
+      }
+      auto lookupTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+      DREAM3D_REQUIRE_EQUAL(found, static_cast<size_t>(numArrays))
+
+      std::cout << "\t" << std::setw(10) << numArrays << std::setw(18) << insertTime.count() << std::setw(18) << lookupTime.count() / 1000000 << std::setw(20)
+                << lookupTime.count() / numArrays << std::endl;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataStructureNameIndexTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestInsertAndRemove())
+    DREAM3D_REGISTER_TEST(TestRename())
+    DREAM3D_REGISTER_TEST(TestSnapshotsKeepTheirIndex())
+    DREAM3D_REGISTER_TEST(TestNameIndexScaling())
+  }
+
+private:
+  DataStructureNameIndexTest(const DataStructureNameIndexTest&); // Copy Constructor Not Implemented
+  void operator=(const DataStructureNameIndexTest&);             // Move assignment Not Implemented
+};
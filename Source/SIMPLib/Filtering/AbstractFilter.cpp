@@ -621,6 +621,26 @@ void AbstractFilter::clearRenamedPaths()
   m_RenamedPaths.clear();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::copyRenameState(const AbstractFilter& other)
+{
+  m_CreatedPaths = other.m_CreatedPaths;
+  m_RenamedPaths = other.m_RenamedPaths;
+  // Set by FilterPipeline once the filter has been preflighted and its created paths are known
+  setProperty("HasRenameValues", other.property("HasRenameValues"));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::copyConditionCodes(const AbstractFilter& other)
+{
+  m_ErrorCode = other.m_ErrorCode;
+  m_WarningCode = other.m_WarningCode;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
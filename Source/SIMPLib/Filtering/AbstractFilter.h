@@ -482,6 +482,20 @@ public:
    */
   void clearRenamedPaths();
 
+  /**
+   * @brief Copies the bookkeeping used to detect renamed DataArrayPaths from another instance of the same filter.
+   * This lets a copy of the filter be preflighted in its place and the results be handed back afterwards.
+   * @param other
+   */
+  void copyRenameState(const AbstractFilter& other);
+
+  /**
+   * @brief Copies the error and warning codes from another instance of the same filter without emitting any
+   * message. The messages of a preflighted copy have already been delivered, so only the codes are handed back.
+   * @param other
+   */
+  void copyConditionCodes(const AbstractFilter& other);
+
 Q_SIGNALS:
   /**
    * @brief Signal is emitted when filter has completed the execute() method
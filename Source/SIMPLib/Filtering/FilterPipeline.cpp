@@ -46,6 +46,7 @@
 #include "SIMPLib/Filtering/BadFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
@@ -63,6 +64,26 @@ QString CreateDateTimeStamp()
 {
   return QDateTime::currentDateTime().toString("yyyy:MM:dd HH:mm:ss");
 }
+
+/**
+ * @brief Sends a message a filter generated during an earlier preflight as if the filter had just generated it.
+ * Errors and warnings go through the filter so it gets its error and warning codes back.
+ */
+void ReplayPreflightMessage(AbstractFilter* filter, const AbstractMessage::Pointer& msg)
+{
+  if(auto errorMsg = std::dynamic_pointer_cast<FilterErrorMessage>(msg))
+  {
+    filter->setErrorCondition(errorMsg->getCode(), errorMsg->getMessageText());
+  }
+  else if(auto warningMsg = std::dynamic_pointer_cast<FilterWarningMessage>(msg))
+  {
+    filter->setWarningCondition(warningMsg->getCode(), warningMsg->getMessageText());
+  }
+  else
+  {
+    Q_EMIT filter->messageGenerated(msg);
+  }
+}
 }
 /**
  * @brief This message handler is used by FilterPipeline to re-emit filter progress messages as pipeline progress messages
@@ -764,20 +785,99 @@ int FilterPipeline::preflightPipeline()
   clearErrorCode();
   int preflightError = 0;
 
+  if(m_PreflightCanceled)
+  {
+    resetPreflightCancel();
+    return -204;
+  }
+
   DataArrayPath::RenameContainer renamedPaths;
 
+  // Filters in front of the first changed filter are restored from the cache instead of being preflighted again
+  const size_t numFilters = static_cast<size_t>(m_Pipeline.size());
+  size_t firstFilter = 0;
+  QByteArray upstreamKey;
+  if(nullptr != m_PreflightCache)
+  {
+    // The keys are computed from the filter properties as they are. Whoever shows parameter widgets writes their
+    // values into the filters before preflighting, so nothing is requested from the widgets here.
+    std::vector<QByteArray> keys;
+    keys.reserve(numFilters);
+    for(const auto& filter : m_Pipeline)
+    {
+      upstreamKey = PreflightCache::CreateKey(filter, upstreamKey);
+      keys.push_back(upstreamKey);
+    }
+    firstFilter = m_PreflightCache->getMatchingCount(keys);
+    upstreamKey = (firstFilter > 0) ? keys[firstFilter - 1] : QByteArray();
+
+    DataContainerArray::Pointer lastSnapshot;
+    for(size_t i = 0; i < firstFilter; i++)
+    {
+      const AbstractFilter::Pointer& filter = m_Pipeline[static_cast<int>(i)];
+      PreflightCache::Entry entry = m_PreflightCache->getEntry(i);
+      renamedPaths = entry.RenamedPaths;
+      if(nullptr != entry.Snapshot)
+      {
+        filter->setDataContainerArray(entry.Snapshot);
+        lastSnapshot = entry.Snapshot;
+      }
+      if(!filter->getEnabled())
+      {
+        continue;
+      }
+#if RENAME_ENABLED
+      filter->setProperty("HasRenameValues", true);
+#endif
+      filter->clearErrorCode();
+      filter->clearWarningCode();
+      connectFilterNotifications(filter.get());
+      for(const auto& msg : entry.Messages)
+      {
+        ReplayPreflightMessage(filter.get(), msg);
+      }
+      disconnectFilterNotifications(filter.get());
+      preflightError |= entry.ErrorCode;
+    }
+
+    // Snapshots must not be modified, so the remaining filters work on a writable copy of the last one that keeps
+    // sharing the untouched nodes with it
+    if(nullptr != lastSnapshot && firstFilter < numFilters)
+    {
+      dca = lastSnapshot->createSnapshot();
+    }
+  }
+
   // Start looping through each filter in the Pipeline and preflight everything
-  for(const auto& filter : m_Pipeline)
+  size_t preflightedCount = 0;
+  for(size_t i = firstFilter; i < numFilters; i++)
   {
+    const AbstractFilter::Pointer& filter = m_Pipeline[static_cast<int>(i)];
+    if(m_PreflightCanceled)
+    {
+      preflightError = -204;
+      break;
+    }
+
+    std::vector<AbstractMessage::Pointer> messages;
+    DataContainerArray::Pointer snapshot;
+
+    // The cache key has to describe the parameters the filter starts the next preflight with. That includes the
+    // upstream renames applied below but not values the filter's own preflight writes into its parameters.
+    const auto createCacheKey = [&]() { return (nullptr != m_PreflightCache) ? PreflightCache::CreateKey(filter, upstreamKey) : QByteArray(); };
+    QByteArray filterKey = createCacheKey();
+
     // Do not preflight disabled filters
     if(filter->getEnabled())
     {
-      filter->setDataContainerArray(dca->deepCopy(true));
 #if RENAME_ENABLED
       // Avoid renaming filters as soon as they are added to the pipeline
       if(filter->property("HasRenameValues").toBool())
       {
+        // CalculateRenamedPaths preflights the filter so it needs a scratch copy it can modify
+        filter->setDataContainerArray(dca->deepCopy(true));
         filter->renameDataArrayPaths(renamedPaths);
+        filterKey = createCacheKey();
         RenameDataPath::CalculateRenamedPaths(filter, renamedPaths);
       }
       else
@@ -788,13 +888,24 @@ int FilterPipeline::preflightPipeline()
       filter->setDataContainerArray(dca);
       setCurrentFilter(filter);
       connectFilterNotifications(filter.get());
+      if(nullptr != m_PreflightCache)
+      {
+        connect(filter.get(), &AbstractFilter::messageGenerated, [&messages](const AbstractMessage::Pointer& msg) { messages.push_back(msg); });
+      }
       filter->clearRenamedPaths();
       filter->preflight();
       disconnectFilterNotifications(filter.get());
-
+      if(m_PreflightCanceled)
+      {
+        // The filter may have stopped part way through, so its results are neither kept nor cached
+        preflightError = -204;
+        break;
+      }
       filter->setCancel(false); // Reset the cancel flag
       preflightError |= filter->getErrorCode();
-      filter->setDataContainerArray(dca->deepCopy(false));
+      // Only the parts of the structure this filter touched are copied. Everything else is shared with the previous filter's snapshot.
+      snapshot = dca->createSnapshot();
+      filter->setDataContainerArray(snapshot);
 #if RENAME_ENABLED
       // Check if an existing renamed path was deleted by this filter
       const std::list<DataArrayPath> deletedPaths = filter->getDeletedPaths();
@@ -836,8 +947,10 @@ int FilterPipeline::preflightPipeline()
     else
     {
       // Some widgets require the updated path to be valid before it can be set in the widget
-      filter->setDataContainerArray(dca->deepCopy(false));
+      snapshot = dca->createSnapshot();
+      filter->setDataContainerArray(snapshot);
       filter->renameDataArrayPaths(renamedPaths);
+      filterKey = createCacheKey();
 
       // Undo filter renaming
       const DataArrayPath::RenameContainer filterRenamedPaths = filter->getRenamedPaths();
@@ -850,12 +963,70 @@ int FilterPipeline::preflightPipeline()
       }
     }
 #endif
+
+    if(nullptr != m_PreflightCache)
+    {
+      upstreamKey = filterKey;
+      PreflightCache::Entry entry;
+      entry.Key = upstreamKey;
+      entry.Snapshot = snapshot;
+      entry.RenamedPaths = renamedPaths;
+      entry.ErrorCode = filter->getEnabled() ? filter->getErrorCode() : 0;
+      entry.Messages = std::move(messages);
+      m_PreflightCache->setEntry(i, std::move(entry));
+    }
+    preflightedCount++;
   }
   setCurrentFilter(AbstractFilter::NullPointer());
 
+  if(nullptr != m_PreflightCache)
+  {
+    if(!m_PreflightCanceled)
+    {
+      m_PreflightCache->truncate(numFilters);
+    }
+    m_PreflightCache->recordPreflight(firstFilter, preflightedCount);
+  }
+  if(m_PreflightCanceled)
+  {
+    resetPreflightCancel();
+  }
+
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::cancelPreflight()
+{
+  m_PreflightCanceled = true;
+  for(const auto& filter : m_Pipeline)
+  {
+    filter->setCancel(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::resetPreflightCancel()
+{
+  m_PreflightCanceled = false;
+  for(const auto& filter : m_Pipeline)
+  {
+    filter->setCancel(false);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::isPreflightCanceled() const
+{
+  return m_PreflightCanceled;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -894,6 +1065,11 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
   QTextStream out(&msg);
   out << "Pipeline Start: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
+
+  // Every parallel algorithm started by the filters runs inside this pipeline's task arena
+  ParallelExecutionContext::Pointer executionContext = (nullptr != m_ExecutionContext) ? m_ExecutionContext : ParallelExecutionContext::CreateDefault();
+  ParallelExecutionContext::Scope executionScope(executionContext);
+
   // Start looping through the Pipeline
   for(const auto& filt : m_Pipeline)
   {
@@ -1076,6 +1252,30 @@ AbstractFilter::Pointer FilterPipeline::getCurrentFilter() const
   return m_CurrentFilter;
 }
 
+// -----------------------------------------------------------------------------
+void FilterPipeline::setExecutionContext(const ParallelExecutionContext::Pointer& value)
+{
+  m_ExecutionContext = value;
+}
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::Pointer FilterPipeline::getExecutionContext() const
+{
+  return m_ExecutionContext;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setPreflightCache(const PreflightCacheShPtrType& value)
+{
+  m_PreflightCache = value;
+}
+
+// -----------------------------------------------------------------------------
+PreflightCacheShPtrType FilterPipeline::getPreflightCache() const
+{
+  return m_PreflightCache;
+}
+
 // -----------------------------------------------------------------------------
 FilterPipeline::ExecutionResult FilterPipeline::getExecutionResult() const
 {
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <QtCore/QJsonObject>
@@ -46,11 +47,14 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 class IObserver;
 class FilterPipelineMessageHandler;
 class DataContainerArray;
 using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
+class PreflightCache;
+using PreflightCacheShPtrType = std::shared_ptr<PreflightCache>;
 
 /**
  * @class FilterPipeline FilterPipeline.h DREAM3DLib/Common/FilterPipeline.h
@@ -165,6 +169,18 @@ public:
    */
   AbstractFilter::Pointer getCurrentFilter() const;
 
+  /**
+   * @brief Setter property for ExecutionContext. The context bounds the threads the parallel
+   * algorithms of this pipeline's filters use. If no context is set, execute() creates one from
+   * the process wide defaults of ParallelExecutionContext.
+   */
+  void setExecutionContext(const ParallelExecutionContext::Pointer& value);
+  /**
+   * @brief Getter property for ExecutionContext
+   * @return Value of ExecutionContext
+   */
+  ParallelExecutionContext::Pointer getExecutionContext() const;
+
   /**
    * @brief Returns true if the pipeline is executing
    * @return
@@ -200,6 +216,33 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief Asks a running preflightPipeline() to stop before it preflights the next filter. The filters are canceled as
+   * well, so a filter that checks getCancel() while it preflights can stop early. The canceled preflight returns -204
+   * without reporting an error. If no preflight is running the next one stops before its first filter. This may be
+   * called from any thread as long as no filters are added or removed at the same time.
+   */
+  void cancelPreflight();
+
+  /**
+   * @brief Returns true if the current or next preflight was asked to stop
+   * @return
+   */
+  bool isPreflightCanceled() const;
+
+  /**
+   * @brief Setter property for PreflightCache. With a cache preflightPipeline() restores the filters in front of the
+   * first filter whose parameters or upstream filters changed from the cache and only preflights the rest. Restored
+   * filters get their DataContainerArray and error codes back and send their messages again, but their preflight()
+   * is not called. Without a cache every filter is preflighted.
+   */
+  void setPreflightCache(const PreflightCacheShPtrType& value);
+  /**
+   * @brief Getter property for PreflightCache
+   * @return Value of PreflightCache
+   */
+  PreflightCacheShPtrType getPreflightCache() const;
+
   /**
    * @brief
    */
@@ -356,12 +399,15 @@ Q_SIGNALS:
 
 private:
   AbstractFilter::Pointer m_CurrentFilter = {};
+  ParallelExecutionContext::Pointer m_ExecutionContext = {};
 
   FilterContainerType m_Pipeline;
   QString m_PipelineName;
 
   FilterPipeline::State m_State = FilterPipeline::State::Idle;
   FilterPipeline::ExecutionResult m_ExecutionResult = FilterPipeline::ExecutionResult::Invalid;
+  std::atomic<bool> m_PreflightCanceled = {false};
+  PreflightCacheShPtrType m_PreflightCache = {};
 
   QVector<QObject*> m_MessageReceivers;
 
@@ -373,6 +419,11 @@ private:
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Clears the preflight cancel request and the cancel flags cancelPreflight() set on the filters
+   */
+  void resetPreflightCancel();
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
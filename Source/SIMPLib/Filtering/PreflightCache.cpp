@@ -0,0 +1,200 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PreflightCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
+
+namespace
+{
+// -----------------------------------------------------------------------------
+bool LooksLikeFilePath(const QString& value)
+{
+  return value.contains('/') || value.contains('\\');
+}
+
+// -----------------------------------------------------------------------------
+// Adds the size and modification time of every file a parameter points to, so editing an input file on disk
+// invalidates the filters that read it
+void HashFileStamps(const QJsonValue& value, QCryptographicHash& hash)
+{
+  if(value.isString())
+  {
+    const QString path = value.toString();
+    if(!LooksLikeFilePath(path))
+    {
+      return;
+    }
+    QFileInfo fi(path);
+    if(fi.isFile())
+    {
+      hash.addData(path.toUtf8());
+      hash.addData(QByteArray::number(fi.size()));
+      hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+    }
+  }
+  else if(value.isObject())
+  {
+    const QJsonObject obj = value.toObject();
+    for(auto iter = obj.constBegin(); iter != obj.constEnd(); ++iter)
+    {
+      HashFileStamps(iter.value(), hash);
+    }
+  }
+  else if(value.isArray())
+  {
+    const QJsonArray array = value.toArray();
+    for(const auto& item : array)
+    {
+      HashFileStamps(item, hash);
+    }
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+PreflightCache::PreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+PreflightCache::~PreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+PreflightCache::Pointer PreflightCache::New()
+{
+  return Pointer(new PreflightCache());
+}
+
+// -----------------------------------------------------------------------------
+QByteArray PreflightCache::CreateKey(const AbstractFilter::Pointer& filter, const QByteArray& upstreamKey)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(upstreamKey);
+  hash.addData(filter->getNameOfClass().toUtf8());
+  hash.addData(filter->getEnabled() ? "1" : "0");
+
+  // Disabled filters are hashed with their parameters as well, as they still take part in renaming paths
+  QJsonObject obj;
+  filter->writeFilterParameters(obj);
+  hash.addData(QJsonDocument(obj).toJson(QJsonDocument::Compact));
+  HashFileStamps(obj, hash);
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+size_t PreflightCache::getMatchingCount(const std::vector<QByteArray>& keys) const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  size_t count = 0;
+  while(count < keys.size() && count < m_Entries.size() && m_Entries[count].Key == keys[count])
+  {
+    count++;
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+PreflightCache::Entry PreflightCache::getEntry(size_t index) const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(index >= m_Entries.size())
+  {
+    return Entry();
+  }
+  return m_Entries[index];
+}
+
+// -----------------------------------------------------------------------------
+void PreflightCache::setEntry(size_t index, Entry entry)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(index >= m_Entries.size())
+  {
+    m_Entries.resize(index + 1);
+  }
+  m_Entries[index] = std::move(entry);
+}
+
+// -----------------------------------------------------------------------------
+void PreflightCache::truncate(size_t count)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(count < m_Entries.size())
+  {
+    m_Entries.resize(count);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void PreflightCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Entries.clear();
+  m_ReusedFilterCount = 0;
+  m_PreflightedFilterCount = 0;
+}
+
+// -----------------------------------------------------------------------------
+size_t PreflightCache::size() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+void PreflightCache::recordPreflight(size_t reused, size_t preflighted)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_ReusedFilterCount = reused;
+  m_PreflightedFilterCount = preflighted;
+}
+
+// -----------------------------------------------------------------------------
+size_t PreflightCache::getReusedFilterCount() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_ReusedFilterCount;
+}
+
+// -----------------------------------------------------------------------------
+size_t PreflightCache::getPreflightedFilterCount() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_PreflightedFilterCount;
+}
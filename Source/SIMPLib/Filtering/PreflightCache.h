@@ -0,0 +1,169 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+/**
+ * @brief The PreflightCache class keeps the results of a pipeline's last preflight so the next preflight of the same
+ * pipeline can start at the first filter that changed.
+ *
+ * Every filter gets a key that hashes its class, enabled state and parameters together with the key of the filter
+ * before it, so equal keys mean the filter and everything upstream of it are unchanged. Files that parameters point
+ * to contribute their size and modification time. The cache stores the DataContainerArray snapshot, the renamed
+ * paths, the error code and the messages of every filter under its key.
+ *
+ * The keys only depend on the filters' contents, so one cache can serve pipelines built from copies of the same
+ * filters. A cache may be used by one preflight at a time.
+ *
+ * The snapshots are the DataContainerArrays the preflighted filters hold. Looking up their contents updates the
+ * snapshot bookkeeping of their nodes, so they may only be read on the thread that runs the preflights. Other threads
+ * get a deepCopy() of a snapshot instead.
+ */
+class SIMPLib_EXPORT PreflightCache
+{
+public:
+  using Self = PreflightCache;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+
+  /**
+   * @brief The results of one filter's preflight
+   */
+  struct Entry
+  {
+    QByteArray Key;
+    DataContainerArray::Pointer Snapshot;
+    DataArrayPath::RenameContainer RenamedPaths;
+    int ErrorCode = 0;
+    std::vector<AbstractMessage::Pointer> Messages;
+  };
+
+  static Pointer New();
+
+  ~PreflightCache();
+
+  /**
+   * @brief Creates the key of a filter
+   * @param filter
+   * @param upstreamKey Key of the filter before it or an empty key for the first filter
+   * @return
+   */
+  static QByteArray CreateKey(const AbstractFilter::Pointer& filter, const QByteArray& upstreamKey);
+
+  /**
+   * @brief Returns the number of leading entries whose keys match the given keys, i.e. the number of filters that
+   * do not have to be preflighted again
+   * @param keys
+   * @return
+   */
+  size_t getMatchingCount(const std::vector<QByteArray>& keys) const;
+
+  /**
+   * @brief Returns the entry at the given index
+   * @param index
+   * @return
+   */
+  Entry getEntry(size_t index) const;
+
+  /**
+   * @brief Stores the entry at the given index, growing the cache if needed
+   * @param index
+   * @param entry
+   */
+  void setEntry(size_t index, Entry entry);
+
+  /**
+   * @brief Drops the entries past the given number of filters
+   * @param count
+   */
+  void truncate(size_t count);
+
+  /**
+   * @brief Drops all entries so the next preflight starts at the first filter
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of entries
+   * @return
+   */
+  size_t size() const;
+
+  /**
+   * @brief Records how many filters the last preflight took from the cache and how many it preflighted
+   * @param reused
+   * @param preflighted
+   */
+  void recordPreflight(size_t reused, size_t preflighted);
+
+  /**
+   * @brief Returns the number of filters the last preflight took from the cache
+   * @return
+   */
+  size_t getReusedFilterCount() const;
+
+  /**
+   * @brief Returns the number of filters the last preflight preflighted
+   * @return
+   */
+  size_t getPreflightedFilterCount() const;
+
+protected:
+  PreflightCache();
+
+private:
+  mutable std::mutex m_Mutex;
+  std::vector<Entry> m_Entries;
+  size_t m_ReusedFilterCount = 0;
+  size_t m_PreflightedFilterCount = 0;
+
+public:
+  PreflightCache(const PreflightCache&) = delete;            // Copy Constructor Not Implemented
+  PreflightCache(PreflightCache&&) = delete;                 // Move Constructor Not Implemented
+  PreflightCache& operator=(const PreflightCache&) = delete; // Copy Assignment Not Implemented
+  PreflightCache& operator=(PreflightCache&&) = delete;      // Move Assignment Not Implemented
+};
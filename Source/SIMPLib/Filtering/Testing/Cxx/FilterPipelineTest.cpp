@@ -33,14 +33,25 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <chrono>
+
 #include <QtCore/QFile>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/RenameAttributeArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 
 #ifdef SIMPL_BUILD_TEST_FILTERS
@@ -151,6 +162,189 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  CreateDataArray::Pointer createArrayFilter(const QString& arrayName)
+  {
+    CreateDataArray::Pointer createArray = CreateDataArray::New();
+    createArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    createArray->setNumberOfComponents(1);
+    createArray->setInitializationType(0);
+    createArray->setInitializationValue("0");
+    createArray->setNewArray(DataArrayPath("DataContainer", "CellData", arrayName));
+    return createArray;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createArrayPipeline(int numArrays)
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName(DataArrayPath("DataContainer", "", ""));
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{10.0, 10.0, 10.0}};
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    for(int i = 0; i < numArrays; i++)
+    {
+      pipeline->pushBack(createArrayFilter("Array_" + QString::number(i)));
+    }
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QList<QString> finalArrayNames(const FilterPipeline::Pointer& pipeline)
+  {
+    DataContainerArray::Pointer dca = pipeline->getFilterContainer().back()->getDataContainerArray();
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    if(nullptr == am)
+    {
+      return {};
+    }
+    return am->getAttributeArrayNames();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflight()
+  {
+    const int numArrays = 148;
+    const int numFilters = numArrays + 2;
+    FilterPipeline::Pointer pipeline = createArrayPipeline(numArrays);
+    PreflightCache::Pointer cache = PreflightCache::New();
+    pipeline->setPreflightCache(cache);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getPreflightedFilterCount(), numFilters)
+    DREAM3D_REQUIRE_EQUAL(cache->size(), numFilters)
+
+    // Nothing changed, so nothing is preflighted
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), numFilters)
+    DREAM3D_REQUIRE_EQUAL(cache->getPreflightedFilterCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(finalArrayNames(pipeline).size(), numArrays)
+
+    // Editing filter 140 preflights it and the filters behind it
+    const int editedIndex = 140;
+    DataContainerArray::Pointer upstreamDca = pipeline->getFilterContainer()[editedIndex - 1]->getDataContainerArray();
+    auto edited = std::dynamic_pointer_cast<CreateDataArray>(pipeline->getFilterContainer()[editedIndex]);
+    DREAM3D_REQUIRE_VALID_POINTER(edited.get())
+    edited->setNewArray(DataArrayPath("DataContainer", "CellData", "Edited"));
+
+    auto start = std::chrono::steady_clock::now();
+    err = pipeline->preflightPipeline();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), editedIndex)
+    DREAM3D_REQUIRE_EQUAL(cache->getPreflightedFilterCount(), numFilters - editedIndex)
+    DREAM3D_REQUIRE(pipeline->getFilterContainer()[editedIndex - 1]->getDataContainerArray() == upstreamDca)
+    std::cout << "\tIncremental preflight of " << numFilters - editedIndex << " of " << numFilters << " filters: " << elapsed.count() << " milliseconds" << std::endl;
+
+    // The result has to match a full preflight of the same pipeline
+    QList<QString> incrementalNames = finalArrayNames(pipeline);
+    DREAM3D_REQUIRE(incrementalNames.contains("Edited"))
+    DREAM3D_REQUIRE(!incrementalNames.contains("Array_" + QString::number(editedIndex - 2)))
+    pipeline->setPreflightCache(PreflightCacheShPtrType());
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    QList<QString> fullNames = finalArrayNames(pipeline);
+    std::sort(incrementalNames.begin(), incrementalNames.end());
+    std::sort(fullNames.begin(), fullNames.end());
+    DREAM3D_REQUIRE(incrementalNames == fullNames)
+
+    // Errors of restored filters are reported again
+    pipeline->setPreflightCache(cache);
+    edited->setNewArray(DataArrayPath("DataContainer", "CellData", "Array_0"));
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, <, 0)
+    DREAM3D_REQUIRED(edited->getErrorCode(), <, 0)
+    edited->clearErrorCode();
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), numFilters)
+    DREAM3D_REQUIRED(err, <, 0)
+    DREAM3D_REQUIRED(edited->getErrorCode(), <, 0)
+
+    // A pending cancel also stops a preflight that would only restore filters from the cache
+    pipeline->cancelPreflight();
+    DREAM3D_REQUIRE_EQUAL(edited->getCancel(), true)
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(err, -204)
+    DREAM3D_REQUIRE_EQUAL(pipeline->isPreflightCanceled(), false)
+    DREAM3D_REQUIRE_EQUAL(edited->getCancel(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflightAfterRename()
+  {
+    const int numArrays = 20;
+    const int numTailArrays = 5;
+    FilterPipeline::Pointer pipeline = createArrayPipeline(numArrays);
+    RenameAttributeArray::Pointer renameArray = RenameAttributeArray::New();
+    renameArray->setSelectedArrayPath(DataArrayPath("DataContainer", "CellData", "Array_5"));
+    renameArray->setNewArrayName("Moved");
+    pipeline->pushBack(renameArray);
+    const int renameIndex = numArrays + 2;
+    for(int i = 0; i < numTailArrays; i++)
+    {
+      pipeline->pushBack(createArrayFilter("Tail_" + QString::number(i)));
+    }
+    const int numFilters = renameIndex + 1 + numTailArrays;
+    PreflightCache::Pointer cache = PreflightCache::New();
+    pipeline->setPreflightCache(cache);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    // Renaming the array upstream updates the array the downstream filter selected
+    const int sourceIndex = 2 + 5;
+    auto source = std::dynamic_pointer_cast<CreateDataArray>(pipeline->getFilterContainer()[sourceIndex]);
+    DREAM3D_REQUIRE_VALID_POINTER(source.get())
+    source->setNewArray(DataArrayPath("DataContainer", "CellData", "Source"));
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), sourceIndex)
+    DREAM3D_REQUIRE(renameArray->getSelectedArrayPath().getDataArrayName() == "Source")
+
+    // The cached keys describe the renamed parameters, so the next preflight reuses every filter
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), numFilters)
+    DREAM3D_REQUIRE_EQUAL(cache->getPreflightedFilterCount(), 0)
+
+    // An unrelated edit behind the renamed filter only preflights the filters from the edited one on
+    const int editedIndex = renameIndex + 3;
+    auto edited = std::dynamic_pointer_cast<CreateDataArray>(pipeline->getFilterContainer()[editedIndex]);
+    DREAM3D_REQUIRE_VALID_POINTER(edited.get())
+    edited->setNewArray(DataArrayPath("DataContainer", "CellData", "Edited"));
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getReusedFilterCount(), editedIndex)
+    DREAM3D_REQUIRE_EQUAL(cache->getPreflightedFilterCount(), numFilters - editedIndex)
+
+    QList<QString> names = finalArrayNames(pipeline);
+    DREAM3D_REQUIRE(names.contains("Moved"))
+    DREAM3D_REQUIRE(names.contains("Edited"))
+    DREAM3D_REQUIRE(!names.contains("Source"))
+    DREAM3D_REQUIRE(!names.contains("Array_5"))
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -165,6 +359,8 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflight());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflightAfterRename());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
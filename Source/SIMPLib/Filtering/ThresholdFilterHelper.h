@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -123,6 +125,51 @@ public:
     }
   }
 
+  /**
+   * @brief Compares count values against compValue and writes 1 where the comparison holds and 0 where it does not.
+   * The operator is resolved once for the whole range so the inner loops stay simple enough to vectorize.
+   * @param compType
+   * @param compValue
+   * @param data
+   * @param count
+   * @param output
+   */
+  template <typename T>
+  static void CompareRange(SIMPL::Comparison::Enumeration compType, double compValue, const T* data, size_t count, uint8_t* output)
+  {
+    T v = static_cast<T>(compValue);
+    switch(compType)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<uint8_t>(data[i] < v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<uint8_t>(data[i] > v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<uint8_t>(data[i] == v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      for(size_t i = 0; i < count; ++i)
+      {
+        output[i] = static_cast<uint8_t>(data[i] != v);
+      }
+      break;
+    default:
+      std::fill(output, output + count, static_cast<uint8_t>(0));
+      break;
+    }
+  }
+
   /**
    * @brief execute
    * @param input
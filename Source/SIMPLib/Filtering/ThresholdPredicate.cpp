@@ -0,0 +1,361 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ThresholdPredicate.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Filtering/ComparisonSet.h"
+#include "SIMPLib/Filtering/ComparisonValue.h"
+#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+using OpCode = ThresholdPredicate::OpCode;
+
+namespace
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+void CompareBlock(const void* data, SIMPL::Comparison::Enumeration compOperator, double compValue, size_t start, size_t count, uint8_t* output)
+{
+  ThresholdFilterHelper::CompareRange<T>(compOperator, compValue, static_cast<const T*>(data) + start, count, output);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool FindCompareFunction(const IDataArray::Pointer& array, ThresholdPredicate::CompareFunction& compare, const void*& data)
+{
+  typename DataArray<T>::Pointer typedArray = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == typedArray)
+  {
+    return false;
+  }
+  compare = &CompareBlock<T>;
+  data = typedArray->getPointer(0);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+ThresholdPredicate::CompareFunction GetCompareFunction(const IDataArray::Pointer& array, const void*& data)
+{
+  ThresholdPredicate::CompareFunction compare = nullptr;
+  FindCompareFunction<float>(array, compare, data) || FindCompareFunction<double>(array, compare, data) || FindCompareFunction<int8_t>(array, compare, data) ||
+      FindCompareFunction<uint8_t>(array, compare, data) || FindCompareFunction<int16_t>(array, compare, data) || FindCompareFunction<uint16_t>(array, compare, data) ||
+      FindCompareFunction<int32_t>(array, compare, data) || FindCompareFunction<uint32_t>(array, compare, data) || FindCompareFunction<int64_t>(array, compare, data) ||
+      FindCompareFunction<uint64_t>(array, compare, data) || FindCompareFunction<bool>(array, compare, data) || FindCompareFunction<size_t>(array, compare, data);
+  return compare;
+}
+
+// -----------------------------------------------------------------------------
+ThresholdPredicate::Instruction MakeInstruction(OpCode op)
+{
+  ThresholdPredicate::Instruction instruction;
+  instruction.op = op;
+  return instruction;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdPredicate::ThresholdPredicate() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdPredicate::~ThresholdPredicate() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdPredicate::Pointer ThresholdPredicate::Compile(ComparisonInputsAdvanced& inputs, const AttributeMatrix::Pointer& attributeMatrix, QString& invalidArrayName)
+{
+  if(nullptr == attributeMatrix)
+  {
+    return nullptr;
+  }
+
+  Pointer predicate = Pointer(new ThresholdPredicate());
+  predicate->m_NumTuples = attributeMatrix->getNumberOfTuples();
+  if(!predicate->compileComparisons(inputs.getInputs(), attributeMatrix, invalidArrayName))
+  {
+    return nullptr;
+  }
+  if(inputs.shouldInvert())
+  {
+    predicate->m_Instructions.push_back(MakeInstruction(OpCode::Not));
+  }
+
+  size_t depth = 0;
+  for(const Instruction& instruction : predicate->m_Instructions)
+  {
+    if(instruction.op == OpCode::Compare || instruction.op == OpCode::Constant)
+    {
+      depth++;
+      predicate->m_MaxDepth = std::max(predicate->m_MaxDepth, depth);
+    }
+    else if(instruction.op == OpCode::And || instruction.op == OpCode::Or)
+    {
+      depth--;
+    }
+  }
+
+  return predicate;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdPredicate::compileComparisons(const QVector<AbstractComparison::Pointer>& comparisons, const AttributeMatrix::Pointer& attributeMatrix, QString& invalidArrayName)
+{
+  bool firstValueFound = false;
+  for(const AbstractComparison::Pointer& comparison : comparisons)
+  {
+    if(ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison))
+    {
+      if(!compileComparisons(comparisonSet->getComparisons(), attributeMatrix, invalidArrayName))
+      {
+        return false;
+      }
+      if(comparisonSet->getInvertComparison())
+      {
+        m_Instructions.push_back(MakeInstruction(OpCode::Not));
+      }
+    }
+    else if(ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison))
+    {
+      IDataArray::Pointer array = attributeMatrix->getAttributeArray(comparisonValue->getAttributeArrayName());
+      Instruction instruction;
+      instruction.op = OpCode::Compare;
+      instruction.compare = (nullptr != array && array->getNumberOfTuples() == m_NumTuples && array->getNumberOfComponents() == 1) ? GetCompareFunction(array, instruction.data) : nullptr;
+      if(nullptr == instruction.compare)
+      {
+        invalidArrayName = comparisonValue->getAttributeArrayName();
+        return false;
+      }
+      instruction.compOperator = static_cast<SIMPL::Comparison::Enumeration>(comparisonValue->getCompOperator());
+      instruction.value = comparisonValue->getCompValue();
+      m_Instructions.push_back(instruction);
+    }
+    else
+    {
+      continue;
+    }
+
+    if(firstValueFound)
+    {
+      m_Instructions.push_back(MakeInstruction(SIMPL::Union::Operator_Or == comparison->getUnionOperator() ? OpCode::Or : OpCode::And));
+    }
+    firstValueFound = true;
+  }
+
+  // An empty set does not select anything
+  if(!firstValueFound)
+  {
+    m_Instructions.push_back(MakeInstruction(OpCode::Constant));
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const uint8_t* ThresholdPredicate::evaluateBlock(uint8_t* registers, size_t start, size_t count) const
+{
+  size_t depth = 0;
+  for(const Instruction& instruction : m_Instructions)
+  {
+    switch(instruction.op)
+    {
+    case OpCode::Compare:
+      instruction.compare(instruction.data, instruction.compOperator, instruction.value, start, count, registers + depth * k_BlockSize);
+      depth++;
+      break;
+    case OpCode::Constant:
+      std::fill(registers + depth * k_BlockSize, registers + depth * k_BlockSize + count, static_cast<uint8_t>(instruction.value != 0.0));
+      depth++;
+      break;
+    case OpCode::And:
+    {
+      depth--;
+      uint8_t* lhs = registers + (depth - 1) * k_BlockSize;
+      const uint8_t* rhs = registers + depth * k_BlockSize;
+      for(size_t i = 0; i < count; i++)
+      {
+        lhs[i] &= rhs[i];
+      }
+      break;
+    }
+    case OpCode::Or:
+    {
+      depth--;
+      uint8_t* lhs = registers + (depth - 1) * k_BlockSize;
+      const uint8_t* rhs = registers + depth * k_BlockSize;
+      for(size_t i = 0; i < count; i++)
+      {
+        lhs[i] |= rhs[i];
+      }
+      break;
+    }
+    case OpCode::Not:
+    {
+      uint8_t* values = registers + (depth - 1) * k_BlockSize;
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] ^= 1;
+      }
+      break;
+    }
+    }
+  }
+  return registers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+bool ThresholdPredicate::evaluateInto(DataArray<T>& output) const
+{
+  if(output.getNumberOfTuples() != m_NumTuples || output.getNumberOfComponents() != 1)
+  {
+    return false;
+  }
+
+  T* outputPtr = output.getPointer(0);
+  size_t numBlocks = (m_NumTuples + k_BlockSize - 1) / k_BlockSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<uint8_t> registers(m_MaxDepth * k_BlockSize);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t start = block * k_BlockSize;
+      size_t count = std::min(k_BlockSize, m_NumTuples - start);
+      const uint8_t* result = evaluateBlock(registers.data(), start, count);
+      for(size_t i = 0; i < count; i++)
+      {
+        outputPtr[start + i] = static_cast<T>(result[i]);
+      }
+    }
+  });
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdPredicate::evaluate(const IDataArray::Pointer& output) const
+{
+#define THRESHOLD_PREDICATE_EVALUATE(Type)                                                                                                                                                             \
+  if(DataArray<Type>::Pointer typedOutput = std::dynamic_pointer_cast<DataArray<Type>>(output))                                                                                                       \
+  {                                                                                                                                                                                                    \
+    return evaluateInto<Type>(*typedOutput);                                                                                                                                                           \
+  }
+
+  THRESHOLD_PREDICATE_EVALUATE(bool)
+  THRESHOLD_PREDICATE_EVALUATE(int8_t)
+  THRESHOLD_PREDICATE_EVALUATE(uint8_t)
+  THRESHOLD_PREDICATE_EVALUATE(int16_t)
+  THRESHOLD_PREDICATE_EVALUATE(uint16_t)
+  THRESHOLD_PREDICATE_EVALUATE(int32_t)
+  THRESHOLD_PREDICATE_EVALUATE(uint32_t)
+  THRESHOLD_PREDICATE_EVALUATE(int64_t)
+  THRESHOLD_PREDICATE_EVALUATE(uint64_t)
+  THRESHOLD_PREDICATE_EVALUATE(float)
+  THRESHOLD_PREDICATE_EVALUATE(double)
+  THRESHOLD_PREDICATE_EVALUATE(size_t)
+
+#undef THRESHOLD_PREDICATE_EVALUATE
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+UInt64ArrayType::Pointer ThresholdPredicate::evaluatePacked(const QString& name) const
+{
+  size_t numWords = (m_NumTuples + 63) / 64;
+  UInt64ArrayType::Pointer mask = UInt64ArrayType::CreateArray(numWords, name, false);
+  if(mask->allocateUninitialized() < 0)
+  {
+    return nullptr;
+  }
+
+  uint64_t* words = mask->getPointer(0);
+  size_t numBlocks = (m_NumTuples + k_BlockSize - 1) / k_BlockSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<uint8_t> registers(m_MaxDepth * k_BlockSize);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t start = block * k_BlockSize;
+      size_t count = std::min(k_BlockSize, m_NumTuples - start);
+      const uint8_t* result = evaluateBlock(registers.data(), start, count);
+      for(size_t offset = 0; offset < count; offset += 64)
+      {
+        size_t bits = std::min(static_cast<size_t>(64), count - offset);
+        uint64_t word = 0;
+        for(size_t b = 0; b < bits; b++)
+        {
+          word |= static_cast<uint64_t>(result[offset + b]) << b;
+        }
+        words[(start + offset) / 64] = word;
+      }
+    }
+  });
+
+  return mask;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ThresholdPredicate::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<ThresholdPredicate::Instruction>& ThresholdPredicate::getInstructions() const
+{
+  return m_Instructions;
+}
@@ -0,0 +1,171 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/AbstractComparison.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+
+/**
+ * @brief The ThresholdPredicate class compiles the ComparisonSet tree of a ComparisonInputsAdvanced into a flat
+ * postfix program and evaluates it in a single parallel pass over the tuples of an AttributeMatrix. The tuples are
+ * processed in blocks; each comparison is run over a whole block with ThresholdFilterHelper::CompareRange and the
+ * partial results are combined in a small stack of block sized registers, so no full size temporary is created
+ * for the individual comparisons. The result can be written into any scalar array or packed into 64 bit words.
+ */
+class SIMPLib_EXPORT ThresholdPredicate
+{
+public:
+  using Self = ThresholdPredicate;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+
+  /**
+   * @brief Number of tuples that are evaluated together. This is a multiple of 64 so that every block covers
+   * whole words of a packed mask.
+   */
+  static constexpr size_t k_BlockSize = 1024;
+
+  enum class OpCode : uint8_t
+  {
+    Compare,
+    Constant,
+    And,
+    Or,
+    Not
+  };
+
+  /**
+   * @brief Compares count values of a source array, starting at tuple start, against a value
+   */
+  using CompareFunction = void (*)(const void* data, SIMPL::Comparison::Enumeration compOperator, double compValue, size_t start, size_t count, uint8_t* output);
+
+  struct Instruction
+  {
+    OpCode op = OpCode::Constant;
+    CompareFunction compare = nullptr;
+    const void* data = nullptr;
+    SIMPL::Comparison::Enumeration compOperator = SIMPL::Comparison::Operator_Unknown;
+    double value = 0.0;
+  };
+
+  /**
+   * @brief Compiles the comparisons against the arrays of the given AttributeMatrix. The union operator of the
+   * first comparison of every set is ignored, the others combine with the result so far from left to right.
+   * Returns a null pointer if one of the arrays does not exist or has a type that can not be compared, in
+   * which case invalidArrayName holds the name of that array.
+   * @param inputs
+   * @param attributeMatrix
+   * @param invalidArrayName
+   * @return
+   */
+  static Pointer Compile(ComparisonInputsAdvanced& inputs, const AttributeMatrix::Pointer& attributeMatrix, QString& invalidArrayName);
+
+  ~ThresholdPredicate();
+
+  /**
+   * @brief Evaluates the predicate into an existing single component array with one tuple per tuple of the
+   * AttributeMatrix. Matching tuples are set to 1 (true), all others to 0 (false). Returns false if the output
+   * array does not have the expected size or type.
+   * @param output
+   * @return
+   */
+  bool evaluate(const IDataArray::Pointer& output) const;
+
+  /**
+   * @brief Evaluates the predicate into a new packed mask. Bit (i % 64) of word (i / 64) holds the result of
+   * tuple i, which needs one eighth of the memory of a BoolArrayType. Returns a null pointer if the array could
+   * not be allocated.
+   * @param name
+   * @return
+   */
+  UInt64ArrayType::Pointer evaluatePacked(const QString& name) const;
+
+  /**
+   * @brief Returns the number of tuples the predicate is evaluated over
+   * @return
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the compiled instructions
+   * @return
+   */
+  const std::vector<Instruction>& getInstructions() const;
+
+protected:
+  ThresholdPredicate();
+
+private:
+  std::vector<Instruction> m_Instructions;
+  size_t m_MaxDepth = 0;
+  size_t m_NumTuples = 0;
+
+  /**
+   * @brief Appends the instructions for a list of comparisons that are combined with their union operators
+   * @param comparisons
+   * @param attributeMatrix
+   * @param invalidArrayName
+   * @return
+   */
+  bool compileComparisons(const QVector<AbstractComparison::Pointer>& comparisons, const AttributeMatrix::Pointer& attributeMatrix, QString& invalidArrayName);
+
+  /**
+   * @brief Evaluates count tuples starting at tuple start. The returned pointer points into registers.
+   * @param registers Scratch space of m_MaxDepth * k_BlockSize bytes
+   * @param start
+   * @param count
+   * @return
+   */
+  const uint8_t* evaluateBlock(uint8_t* registers, size_t start, size_t count) const;
+
+  template <typename T>
+  bool evaluateInto(DataArray<T>& output) const;
+
+public:
+  ThresholdPredicate(const ThresholdPredicate&) = delete;            // Copy Constructor Not Implemented
+  ThresholdPredicate(ThresholdPredicate&&) = delete;                 // Move Constructor Not Implemented
+  ThresholdPredicate& operator=(const ThresholdPredicate&) = delete; // Copy Assignment Not Implemented
+  ThresholdPredicate& operator=(ThresholdPredicate&&) = delete;      // Move Assignment Not Implemented
+};
@@ -31,10 +31,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -43,12 +47,18 @@
 
 using namespace H5Support;
 
+#include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Geometry/IGeometry.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_sort.h>
+#endif
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
@@ -227,7 +237,9 @@ public:
   virtual ~Connectivity() = default;
 
   /**
-   * @brief FindElementsContainingVert
+   * @brief FindElementsContainingVert Builds, for every vertex, the list of elements that
+   * reference it. The lists are filled with a parallel two pass count/scatter directly into
+   * the flat buffer of the DynamicListArray and each list is sorted by element id.
    * @param elemList
    * @param dynamicList
    * @param numVerts
@@ -237,39 +249,50 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const K* elems = elemList->getPointer(0);
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
-
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, std::string("_INTERNAL_USE_ONLY_Vertices"), true);
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
-
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
     // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
-    {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    std::vector<std::atomic<T>> linkCount(numVerts);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t elemId = range.min(); elemId < range.max(); elemId++)
       {
-        linkCount[verts[j]]++;
+        const K* verts = elems + elemId * numVertsPerElem;
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          linkCount[verts[j]].fetch_add(1, std::memory_order_relaxed);
+        }
       }
-    }
+    });
 
     // Now allocate storage for the links
     dynamicList->allocateLists(linkCount);
 
-    for(elemId = 0; elemId < numElems; elemId++)
-    {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    // Scatter each element id into the lists of its vertices
+    std::vector<std::atomic<T>> linkLoc(numVerts);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t elemId = range.min(); elemId < range.max(); elemId++)
       {
-        dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
+        const K* verts = elems + elemId * numVertsPerElem;
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          T pos = linkLoc[verts[j]].fetch_add(1, std::memory_order_relaxed);
+          dynamicList->insertCellReference(verts[j], pos, elemId);
+        }
       }
-    }
+    });
+
+    // The scatter order depends on scheduling; sort so the lists are deterministic
+    ParallelDataAlgorithm sortAlg;
+    sortAlg.setRange(0, numVerts);
+    sortAlg.execute([&](const SIMPLRange& range) {
+      for(size_t v = range.min(); v < range.max(); v++)
+      {
+        K* cells = dynamicList->getElementListPointer(v);
+        std::sort(cells, cells + dynamicList->getNumberOfElements(v));
+      }
+    });
   }
 
   /**
@@ -287,7 +310,6 @@ public:
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numSharedVerts = 0;
-    QVector<T> linkCount(numElems, 0);
     int err = 0;
 
     switch(geometryType)
@@ -327,26 +349,16 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, std::string("_INTERNAL_USE_ONLY_Visited"), true);
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
-
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
+    const K* elems = elemList->getPointer(0);
 
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
-    {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
+    // Collects the neighbors of element t into neighbors, in the order they are discovered
+    auto findNeighbors = [&](size_t t, std::vector<K>& neighbors) {
+      neighbors.clear();
+      const K* seedElem = elems + t * numVertsPerElem;
       for(size_t v = 0; v < numVertsPerElem; ++v)
       {
-        //   qDebug() << " vert " << v << "\n";
         T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
-        K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
+        const K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
 
         for(T vt = 0; vt < nEs; ++vt)
         {
@@ -354,16 +366,14 @@ public:
           {
             continue;
           } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
+          if(std::find(neighbors.begin(), neighbors.end(), vertIdxs[vt]) != neighbors.end())
           {
             continue;
           } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
+          const K* vertCell = elems + vertIdxs[vt] * numVertsPerElem;
           size_t vCount = 0;
           // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
+          // If there is numSharedVerts match then that element is a neighbor of the source.
           for(size_t i = 0; i < numVertsPerElem; i++)
           {
             for(size_t j = 0; j < numVertsPerElem; j++)
@@ -375,31 +385,40 @@ public:
             }
           }
 
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
           if(vCount == numSharedVerts)
           {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
+            neighbors.push_back(vertIdxs[vt]);
           }
         }
       }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
+    };
+
+    // First pass counts the neighbors of each element so the flat buffer can be sized
+    std::vector<T> linkCount(numElems, 0);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      std::vector<K> neighbors;
+      neighbors.reserve(32);
+      for(size_t t = range.min(); t < range.max(); t++)
       {
-        visited[loop_neighbors[k]] = false;
+        findNeighbors(t, neighbors);
+        linkCount[t] = static_cast<T>(neighbors.size());
       }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
-    }
+    });
+
+    dynamicList->allocateLists(linkCount);
+
+    // Second pass writes each element's neighbors into its slot
+    dataAlg.execute([&](const SIMPLRange& range) {
+      std::vector<K> neighbors;
+      neighbors.reserve(32);
+      for(size_t t = range.min(); t < range.max(); t++)
+      {
+        findNeighbors(t, neighbors);
+        std::copy(neighbors.begin(), neighbors.end(), dynamicList->getElementListPointer(t));
+      }
+    });
 
     return err;
   }
@@ -412,62 +431,7 @@ public:
   template <typename T>
   static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resizeTuples(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(*elemList, Create2DEdgeTable(elemList->getNumberOfComponents()), false, *edgeList);
   }
 
   /**
@@ -478,42 +442,7 @@ public:
   template <typename T>
   static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resizeTuples(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(*tetList, k_TetEdges, false, *edgeList);
   }
 
   /**
@@ -524,51 +453,7 @@ public:
   template <typename T>
   static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edge_List)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edge_List->resizeTuples(edgeSet.size());
-    T* uEdges = edge_List->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(*hexList, k_HexEdges, false, *edge_List);
   }
 
   /**
@@ -579,41 +464,7 @@ public:
   template <typename T>
   static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resizeTuples(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    FindUniqueSubElements<T, 3>(*tetList, k_TetFaces, false, *faceList);
   }
 
   /**
@@ -624,45 +475,7 @@ public:
   template <typename T>
   static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resizeTuples(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    FindUniqueSubElements<T, 4>(*hexList, k_HexFaces, false, *faceList);
   }
 
   /**
@@ -673,75 +486,7 @@ public:
   template <typename T>
   static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resizeTuples(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(*elemList, Create2DEdgeTable(elemList->getNumberOfComponents()), true, *edgeList);
   }
 
   /**
@@ -752,55 +497,7 @@ public:
   template <typename T>
   static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resizeTuples(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(*tetList, k_TetEdges, true, *edgeList);
   }
 
   /**
@@ -811,64 +508,7 @@ public:
   template <typename T>
   static void FindUnsharedHexEdges(typename DataArray<T>::Pointer& hexList, typename DataArray<T>::Pointer& edge_List)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edge_List->resizeTuples(edgeMap.size());
-    T* bEdges = edge_List->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(*hexList, k_HexEdges, true, *edge_List);
   }
 
   /**
@@ -879,54 +519,7 @@ public:
   template <typename T>
   static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resizeTuples(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
-    }
+    FindUniqueSubElements<T, 3>(*tetList, k_TetFaces, true, *faceList);
   }
 
   /**
@@ -937,59 +530,100 @@ public:
   template <typename T>
   static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
+    FindUniqueSubElements<T, 4>(*hexList, k_HexFaces, true, *faceList);
+  }
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
+  /**
+   * @brief Extracts the unique sub-elements (edges or faces) of an element list.  Each element
+   * contributes one key per entry of the local vertex table, made of the element's vertex ids at
+   * those local positions sorted in ascending order.  The keys are generated and sorted in parallel
+   * and written to subElemList in ascending lexicographic order, so the ids of the resulting edges
+   * and faces do not depend on whether TBB is available.
+   * @param elemList Element connectivity list
+   * @param localVerts Local vertex positions of each sub-element within an element
+   * @param unsharedOnly If true, only sub-elements used by exactly one element are kept
+   * @param subElemList Output list of sub-elements; resized to the number found
+   */
+  template <typename T, size_t N, typename TableType>
+  static void FindUniqueSubElements(const DataArray<T>& elemList, const TableType& localVerts, bool unsharedOnly, DataArray<T>& subElemList)
+  {
+    using KeyType = std::array<T, N>;
 
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
+    const size_t numElems = elemList.getNumberOfTuples();
+    const size_t numVertsPerElem = elemList.getNumberOfComponents();
+    const size_t keysPerElem = localVerts.size();
 
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
+    std::vector<KeyType> keys(numElems * keysPerElem);
+    const T* elems = elemList.data();
 
-      for(auto&& quad : quadList)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElems);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t i = range.min(); i < range.max(); i++)
       {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
+        const T* verts = elems + i * numVertsPerElem;
+        KeyType* elemKeys = keys.data() + i * keysPerElem;
+        for(size_t k = 0; k < keysPerElem; k++)
+        {
+          for(size_t v = 0; v < N; v++)
+          {
+            elemKeys[k][v] = verts[localVerts[k][v]];
+          }
+          std::sort(elemKeys[k].begin(), elemKeys[k].end());
+        }
       }
-    }
+    });
 
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_sort(keys.begin(), keys.end());
+#else
+    std::sort(keys.begin(), keys.end());
+#endif
 
-    while(mapIter != faceMap.end())
+    size_t numKept = 0;
+    const size_t numKeys = keys.size();
+    for(size_t i = 0; i < numKeys;)
     {
-      if((*mapIter).second > 1)
+      size_t next = i + 1;
+      while(next < numKeys && keys[next] == keys[i])
       {
-        faceMap.erase(mapIter++);
+        next++;
       }
-      else
+      if(!unsharedOnly || next - i == 1)
       {
-        ++mapIter;
+        keys[numKept++] = keys[i];
       }
+      i = next;
     }
 
-    faceList->resizeTuples(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
+    subElemList.resizeTuples(numKept);
+    T* subElems = subElemList.data();
+    for(size_t i = 0; i < numKept; i++)
+    {
+      std::copy(keys[i].cbegin(), keys[i].cend(), subElems + i * N);
+    }
+  }
 
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
+private:
+  /**
+   * @brief Returns the local vertex table for the edges of a polygon with the given number of vertices
+   * @param numVertsPerElem
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> Create2DEdgeTable(size_t numVertsPerElem)
+  {
+    std::vector<std::array<size_t, 2>> edges(numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
     {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
+      edges[j] = {j, (j + 1) % numVertsPerElem};
     }
+    return edges;
   }
+
+  static constexpr std::array<std::array<size_t, 2>, 6> k_TetEdges = {{{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}}};
+  static constexpr std::array<std::array<size_t, 2>, 12> k_HexEdges = {{{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 5}, {5, 6}, {6, 7}, {7, 4}}};
+  static constexpr std::array<std::array<size_t, 3>, 4> k_TetFaces = {{{0, 1, 2}, {1, 2, 3}, {0, 2, 3}, {0, 1, 3}}};
+  static constexpr std::array<std::array<size_t, 4>, 6> k_HexFaces = {{{0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}, {0, 1, 2, 3}, {4, 5, 6, 7}}};
 };
 
 /**
@@ -35,6 +35,26 @@
 
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+void FindIndicesWithGetIndex(const IGeometryGrid& geom, const T* coords, size_t numPoints, size_t* indices)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&geom, coords, indices](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      std::optional<size_t> index = geom.getIndex(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+      indices[i] = index.has_value() ? *index : IGeometryGrid::k_InvalidIndex;
+    }
+  });
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -45,6 +65,22 @@ IGeometryGrid::IGeometryGrid() = default;
 // -----------------------------------------------------------------------------
 IGeometryGrid::~IGeometryGrid() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometryGrid::findIndices(const float* coords, size_t numPoints, size_t* indices) const
+{
+  FindIndicesWithGetIndex(*this, coords, numPoints, indices);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometryGrid::findIndices(const double* coords, size_t numPoints, size_t* indices) const
+{
+  FindIndicesWithGetIndex(*this, coords, numPoints, indices);
+}
+
 // -----------------------------------------------------------------------------
 IGeometryGrid::Pointer IGeometryGrid::NullPointer()
 {
@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <optional>
 #include <tuple>
@@ -100,6 +101,22 @@ public:
   virtual std::optional<size_t> getIndex(float xCoord, float yCoord, float zCoord) const = 0;
   virtual std::optional<size_t> getIndex(double xCoord, double yCoord, double zCoord) const = 0;
 
+  /**
+   * @brief Value stored by findIndices() for points that are outside of the geometry
+   */
+  static constexpr size_t k_InvalidIndex = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief Finds the cell that contains each of a list of points. The points are located in parallel.
+   * Subclasses override this when a batch of points can be located faster than by calling getIndex()
+   * for every point.
+   * @param coords The x, y, z coordinates of the points (3 * numPoints values)
+   * @param numPoints The number of points
+   * @param indices Receives the cell index of each point or k_InvalidIndex (numPoints values)
+   */
+  virtual void findIndices(const float* coords, size_t numPoints, size_t* indices) const;
+  virtual void findIndices(const double* coords, size_t numPoints, size_t* indices) const;
+
 public:
   IGeometryGrid(const IGeometryGrid&) = delete;            // Copy Constructor Not Implemented
   IGeometryGrid(IGeometryGrid&&) = delete;                 // Move Constructor Not Implemented
@@ -45,6 +45,8 @@
 
 #include <QtCore/QTextStream>
 
+#include <algorithm>
+#include <cmath>
 #include <thread>
 
 #include "SIMPLib/Geometry/RectGridGeom.h"
@@ -53,6 +55,7 @@
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 /**
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
@@ -385,6 +388,152 @@ private:
   };
 };
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Returns the cell i with bounds[i] <= coord < bounds[i + 1] using a binary search of the
+// sorted bounds or IGeometryGrid::k_InvalidIndex if coord is outside of the bounds (or NaN).
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t FindCell(const float* bounds, size_t numBounds, T coord)
+{
+  if(nullptr == bounds || numBounds < 2 || !(coord >= bounds[0] && coord < bounds[numBounds - 1]))
+  {
+    return IGeometryGrid::k_InvalidIndex;
+  }
+  const float* upper = std::upper_bound(bounds, bounds + numBounds, coord, [](T value, float bound) { return value < bound; });
+  return static_cast<size_t>(upper - bounds) - 1;
+}
+
+/**
+ * @brief The AxisLocator class finds the cell along one axis of a rectilinear grid. Axes whose bounds are
+ * (close to) evenly spaced are located arithmetically and the estimate is corrected against the actual
+ * bounds, so the result is always the same as the one of FindCell(). Other axes use a binary search.
+ */
+class AxisLocator
+{
+public:
+  explicit AxisLocator(const FloatArrayType::Pointer& bounds)
+  {
+    if(nullptr == bounds || bounds->getNumberOfTuples() < 2)
+    {
+      return;
+    }
+    m_Bounds = bounds->getPointer(0);
+    m_NumBounds = bounds->getNumberOfTuples();
+
+    const size_t numCells = m_NumBounds - 1;
+    m_Origin = m_Bounds[0];
+    m_Spacing = (static_cast<double>(m_Bounds[numCells]) - m_Origin) / static_cast<double>(numCells);
+    if(!(m_Spacing > 0.0))
+    {
+      return;
+    }
+    // An estimate that is off by less than half a cell needs at most one correction step
+    double maxDeviation = 0.0;
+    for(size_t i = 1; i < numCells; i++)
+    {
+      maxDeviation = std::max(maxDeviation, std::abs(static_cast<double>(m_Bounds[i]) - (m_Origin + m_Spacing * static_cast<double>(i))));
+    }
+    m_Uniform = (maxDeviation < 0.5 * m_Spacing);
+  }
+
+  bool isUniform() const
+  {
+    return m_Uniform;
+  }
+
+  template <typename T>
+  size_t locate(T coord) const
+  {
+    if(!m_Uniform)
+    {
+      return FindCell(m_Bounds, m_NumBounds, coord);
+    }
+    if(!(coord >= m_Bounds[0] && coord < m_Bounds[m_NumBounds - 1]))
+    {
+      return IGeometryGrid::k_InvalidIndex;
+    }
+    const size_t lastCell = m_NumBounds - 2;
+    size_t cell = std::min(static_cast<size_t>((static_cast<double>(coord) - m_Origin) / m_Spacing), lastCell);
+    while(cell > 0 && coord < m_Bounds[cell])
+    {
+      cell--;
+    }
+    while(cell < lastCell && coord >= m_Bounds[cell + 1])
+    {
+      cell++;
+    }
+    return cell;
+  }
+
+private:
+  const float* m_Bounds = nullptr;
+  size_t m_NumBounds = 0;
+  double m_Origin = 0.0;
+  double m_Spacing = 0.0;
+  bool m_Uniform = false;
+};
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::optional<size_t> FindIndex(const FloatArrayType::Pointer& xBounds, const FloatArrayType::Pointer& yBounds, const FloatArrayType::Pointer& zBounds, T xCoord, T yCoord, T zCoord)
+{
+  if(nullptr == xBounds || nullptr == yBounds || nullptr == zBounds)
+  {
+    return {};
+  }
+  size_t x = FindCell(xBounds->getPointer(0), xBounds->getNumberOfTuples(), xCoord);
+  size_t y = FindCell(yBounds->getPointer(0), yBounds->getNumberOfTuples(), yCoord);
+  size_t z = FindCell(zBounds->getPointer(0), zBounds->getNumberOfTuples(), zCoord);
+  if(x == IGeometryGrid::k_InvalidIndex || y == IGeometryGrid::k_InvalidIndex || z == IGeometryGrid::k_InvalidIndex)
+  {
+    return {};
+  }
+
+  size_t xSize = xBounds->getNumberOfTuples() - 1;
+  size_t ySize = yBounds->getNumberOfTuples() - 1;
+  return (ySize * xSize * z) + (xSize * y) + x;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void FindIndices(const FloatArrayType::Pointer& xBounds, const FloatArrayType::Pointer& yBounds, const FloatArrayType::Pointer& zBounds, const T* coords, size_t numPoints, size_t* indices)
+{
+  if(nullptr == xBounds || nullptr == yBounds || nullptr == zBounds)
+  {
+    std::fill(indices, indices + numPoints, IGeometryGrid::k_InvalidIndex);
+    return;
+  }
+
+  // The spacing of each axis is examined once for the whole batch
+  const AxisLocator xLocator(xBounds);
+  const AxisLocator yLocator(yBounds);
+  const AxisLocator zLocator(zBounds);
+  const size_t xSize = xBounds->getNumberOfTuples() - 1;
+  const size_t ySize = yBounds->getNumberOfTuples() - 1;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&, coords, indices](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      size_t x = xLocator.locate(coords[3 * i]);
+      size_t y = yLocator.locate(coords[3 * i + 1]);
+      size_t z = zLocator.locate(coords[3 * i + 2]);
+      if(x == IGeometryGrid::k_InvalidIndex || y == IGeometryGrid::k_InvalidIndex || z == IGeometryGrid::k_InvalidIndex)
+      {
+        indices[i] = IGeometryGrid::k_InvalidIndex;
+      }
+      else
+      {
+        indices[i] = (ySize * xSize * z) + (xSize * y) + x;
+      }
+    }
+  });
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -715,32 +864,7 @@ void RectGridGeom::getCoords(size_t idx, double coords[3]) const
 // -----------------------------------------------------------------------------
 std::optional<size_t> RectGridGeom::getIndex(float xCoord, float yCoord, float zCoord) const
 {
-  FloatArrayType& xBnds = *m_xBounds;
-  FloatArrayType& yBnds = *m_yBounds;
-  FloatArrayType& zBnds = *m_zBounds;
-
-  if(xCoord < xBnds.front() || xCoord >= xBnds.back())
-  {
-    return {};
-  }
-
-  if(yCoord < yBnds.front() || yCoord >= yBnds.back())
-  {
-    return {};
-  }
-
-  if(zCoord < zBnds.front() || zCoord >= zBnds.back())
-  {
-    return {};
-  }
-
-  size_t x = std::distance(xBnds.cbegin(), std::adjacent_find(xBnds.cbegin(), xBnds.cend(), [xCoord](const float a, const float b) { return (xCoord >= a && xCoord < b); }));
-  size_t y = std::distance(yBnds.cbegin(), std::adjacent_find(yBnds.cbegin(), yBnds.cend(), [yCoord](const float a, const float b) { return (yCoord >= a && yCoord < b); }));
-  size_t z = std::distance(zBnds.cbegin(), std::adjacent_find(zBnds.cbegin(), zBnds.cend(), [zCoord](const float a, const float b) { return (zCoord >= a && zCoord < b); }));
-
-  size_t xSize = xBnds.size() - 1;
-  size_t ySize = yBnds.size() - 1;
-  return (ySize * xSize * z) + (xSize * y) + x;
+  return FindIndex(m_xBounds, m_yBounds, m_zBounds, xCoord, yCoord, zCoord);
 }
 
 // -----------------------------------------------------------------------------
@@ -748,33 +872,23 @@ std::optional<size_t> RectGridGeom::getIndex(float xCoord, float yCoord, float z
 // -----------------------------------------------------------------------------
 std::optional<size_t> RectGridGeom::getIndex(double xCoord, double yCoord, double zCoord) const
 {
-  FloatArrayType& xBnds = *m_xBounds;
-  FloatArrayType& yBnds = *m_yBounds;
-  FloatArrayType& zBnds = *m_zBounds;
-
-  if(xCoord < xBnds.front() || xCoord >= xBnds.back())
-  {
-    return {};
-  }
-
-  if(yCoord < yBnds.front() || yCoord >= yBnds.back())
-  {
-    return {};
-  }
-
-  if(zCoord < zBnds.front() || zCoord >= zBnds.back())
-  {
-    return {};
-  }
+  return FindIndex(m_xBounds, m_yBounds, m_zBounds, xCoord, yCoord, zCoord);
+}
 
-  // Use standard distance to get the index of the returned iterator from adjacent_find
-  size_t x = std::distance(xBnds.cbegin(), std::adjacent_find(xBnds.cbegin(), xBnds.cend(), [xCoord](const float a, const float b) { return (xCoord >= a && xCoord < b); }));
-  size_t y = std::distance(yBnds.cbegin(), std::adjacent_find(yBnds.cbegin(), yBnds.cend(), [yCoord](const float a, const float b) { return (yCoord >= a && yCoord < b); }));
-  size_t z = std::distance(zBnds.cbegin(), std::adjacent_find(zBnds.cbegin(), zBnds.cend(), [zCoord](const float a, const float b) { return (zCoord >= a && zCoord < b); }));
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::findIndices(const float* coords, size_t numPoints, size_t* indices) const
+{
+  FindIndices(m_xBounds, m_yBounds, m_zBounds, coords, numPoints, indices);
+}
 
-  size_t xSize = xBnds.size() - 1;
-  size_t ySize = yBnds.size() - 1;
-  return (ySize * xSize * z) + (xSize * y) + x;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::findIndices(const double* coords, size_t numPoints, size_t* indices) const
+{
+  FindIndices(m_xBounds, m_yBounds, m_zBounds, coords, numPoints, indices);
 }
 
 // -----------------------------------------------------------------------------
@@ -264,6 +264,16 @@ public:
   std::optional<size_t> getIndex(float xCoord, float yCoord, float zCoord) const override;
   std::optional<size_t> getIndex(double xCoord, double yCoord, double zCoord) const override;
 
+  /**
+   * @brief Finds the cell that contains each of a list of points. Axes with evenly spaced bounds are
+   * located arithmetically, all other axes with a binary search of the bounds.
+   * @param coords The x, y, z coordinates of the points (3 * numPoints values)
+   * @param numPoints The number of points
+   * @param indices Receives the cell index of each point or k_InvalidIndex (numPoints values)
+   */
+  void findIndices(const float* coords, size_t numPoints, size_t* indices) const override;
+  void findIndices(const double* coords, size_t numPoints, size_t* indices) const override;
+
 protected:
   RectGridGeom();
 
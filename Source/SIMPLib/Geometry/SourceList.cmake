@@ -27,6 +27,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexSpatialIndex.h
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
@@ -53,6 +54,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexSpatialIndex.cpp
 )
 
 if(SIMPL_USE_EIGEN)
@@ -0,0 +1,368 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QDir>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+using namespace H5Support;
+
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryConnectivityTest
+{
+public:
+  GeometryConnectivityTest() = default;
+
+  virtual ~GeometryConnectivityTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir tempDir(UnitTest::GeometryConnectivityTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void requireSameLists(const ElementDynamicList::Pointer& expected, const ElementDynamicList::Pointer& actual)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(actual.get())
+    DREAM3D_REQUIRE_EQUAL(actual->size(), expected->size())
+    DREAM3D_REQUIRE_EQUAL(actual->getTotalNumberOfElements(), expected->getTotalNumberOfElements())
+    for(size_t i = 0; i < expected->size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(actual->getNumberOfElements(i), expected->getNumberOfElements(i))
+      for(size_t j = 0; j < expected->getNumberOfElements(i); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(actual->getElementListPointer(i)[j], expected->getElementListPointer(i)[j])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Builds a dim x dim grid of quads, each split into two triangles
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer createTriangleGrid(size_t dim)
+  {
+    size_t vDim = dim + 1;
+    SharedVertexList::Pointer verts = TriangleGeom::CreateSharedVertexList(vDim * vDim);
+    verts->initializeWithZeros();
+    SharedTriList::Pointer tris = TriangleGeom::CreateSharedTriList(2 * dim * dim);
+    size_t t = 0;
+    for(size_t y = 0; y < dim; y++)
+    {
+      for(size_t x = 0; x < dim; x++)
+      {
+        size_t v0 = y * vDim + x;
+        size_t v1 = v0 + 1;
+        size_t v2 = v0 + vDim;
+        size_t v3 = v2 + 1;
+        tris->setComponent(t, 0, v0);
+        tris->setComponent(t, 1, v1);
+        tris->setComponent(t, 2, v3);
+        t++;
+        tris->setComponent(t, 0, v0);
+        tris->setComponent(t, 1, v3);
+        tris->setComponent(t, 2, v2);
+        t++;
+      }
+    }
+    return TriangleGeom::CreateGeometry(tris, verts, "Triangles");
+  }
+
+  // -----------------------------------------------------------------------------
+  // Builds a dim x dim x dim grid of hexahedra
+  // -----------------------------------------------------------------------------
+  HexahedralGeom::Pointer createHexGrid(size_t dim)
+  {
+    size_t vDim = dim + 1;
+    SharedVertexList::Pointer verts = HexahedralGeom::CreateSharedVertexList(vDim * vDim * vDim);
+    verts->initializeWithZeros();
+    SharedHexList::Pointer hexas = HexahedralGeom::CreateSharedHexList(dim * dim * dim);
+    size_t h = 0;
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          size_t v0 = (z * vDim + y) * vDim + x;
+          size_t v4 = v0 + vDim * vDim;
+          size_t verts8[8] = {v0, v0 + 1, v0 + vDim + 1, v0 + vDim, v4, v4 + 1, v4 + vDim + 1, v4 + vDim};
+          for(size_t c = 0; c < 8; c++)
+          {
+            hexas->setComponent(h, c, verts8[c]);
+          }
+          h++;
+        }
+      }
+    }
+    return HexahedralGeom::CreateGeometry(hexas, verts, "Hexahedra");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleEdges()
+  {
+    TriangleGeom::Pointer geom = createTriangleGrid(1);
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    SharedEdgeList::Pointer edges = geom->getEdges();
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 5)
+
+    // Edges come out sorted by their (smaller, larger) vertex pair
+    size_t expected[5][2] = {{0, 1}, {0, 2}, {0, 3}, {1, 3}, {2, 3}};
+    for(size_t i = 0; i < 5; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(edges->getComponent(i, 0), expected[i][0])
+      DREAM3D_REQUIRE_EQUAL(edges->getComponent(i, 1), expected[i][1])
+    }
+
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedEdges()->getNumberOfTuples(), 4)
+
+    geom = createTriangleGrid(10);
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getEdges()->getNumberOfTuples(), 3 * 10 * 10 + 2 * 10)
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedEdges()->getNumberOfTuples(), 4 * 10)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestQuadEdges()
+  {
+    SharedVertexList::Pointer verts = QuadGeom::CreateSharedVertexList(6);
+    verts->initializeWithZeros();
+    SharedQuadList::Pointer quads = QuadGeom::CreateSharedQuadList(2);
+    size_t conn[2][4] = {{0, 1, 4, 3}, {1, 2, 5, 4}};
+    for(size_t i = 0; i < 2; i++)
+    {
+      for(size_t c = 0; c < 4; c++)
+      {
+        quads->setComponent(i, c, conn[i][c]);
+      }
+    }
+    QuadGeom::Pointer geom = QuadGeom::CreateGeometry(quads, verts, "Quads");
+
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getEdges()->getNumberOfTuples(), 7)
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedEdges()->getNumberOfTuples(), 6)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetConnectivity()
+  {
+    SharedVertexList::Pointer verts = TetrahedralGeom::CreateSharedVertexList(5);
+    verts->initializeWithZeros();
+    SharedTetList::Pointer tets = TetrahedralGeom::CreateSharedTetList(2);
+    size_t conn[2][4] = {{0, 1, 2, 3}, {4, 2, 1, 3}};
+    for(size_t i = 0; i < 2; i++)
+    {
+      for(size_t c = 0; c < 4; c++)
+      {
+        tets->setComponent(i, c, conn[i][c]);
+      }
+    }
+    TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(tets, verts, "Tets");
+
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getEdges()->getNumberOfTuples(), 9)
+    DREAM3D_REQUIRE(geom->findFaces() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getTriangles()->getNumberOfTuples(), 7)
+    DREAM3D_REQUIRE(geom->findUnsharedFaces() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedFaces()->getNumberOfTuples(), 6)
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedEdges()->getNumberOfTuples(), 6)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexConnectivity()
+  {
+    HexahedralGeom::Pointer geom = createHexGrid(3);
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getEdges()->getNumberOfTuples(), 3 * 3 * 4 * 4)
+    DREAM3D_REQUIRE(geom->findFaces() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getQuads()->getNumberOfTuples(), 3 * 3 * 3 * 4)
+    DREAM3D_REQUIRE(geom->findUnsharedFaces() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedFaces()->getNumberOfTuples(), 6 * 3 * 3)
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    DREAM3D_REQUIRE_EQUAL(geom->getUnsharedEdges()->getNumberOfTuples(), 12 * 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestElementTopology()
+  {
+    TriangleGeom::Pointer geom = createTriangleGrid(2);
+    DREAM3D_REQUIRE(geom->findElementsContainingVert() >= 0)
+    ElementDynamicList::Pointer containing = geom->getElementsContainingVert();
+    DREAM3D_REQUIRE_EQUAL(containing->size(), 9)
+    DREAM3D_REQUIRE_EQUAL(containing->getTotalNumberOfElements(), 3 * 8)
+
+    // The center vertex is shared by all the triangles except the two off-diagonal corners
+    size_t expected[6] = {0, 1, 3, 4, 6, 7};
+    DREAM3D_REQUIRE_EQUAL(containing->getNumberOfElements(4), 6)
+    for(size_t i = 0; i < 6; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(containing->getElementListPointer(4)[i], expected[i])
+    }
+
+    DREAM3D_REQUIRE(geom->findElementNeighbors() >= 0)
+    ElementDynamicList::Pointer neighbors = geom->getElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(neighbors->size(), 8)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(0), 2)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(0)[0], 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(0)[1], 3)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(1), 2)
+
+    ElementDynamicList::Pointer copy = neighbors->deepCopy();
+    requireSameLists(neighbors, copy);
+
+    // Changing the length of one list must leave the others intact
+    MeshIndexType replacement[3] = {5, 6, 7};
+    copy->setElementList(0, 3, replacement);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfElements(0), 3)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(0)[2], 7)
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfElements(1), 2)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(1)[0], neighbors->getElementListPointer(1)[0])
+
+    // Growing and shrinking every list one after the other keeps all the other lists intact
+    ElementDynamicList::Pointer grown = containing->deepCopy();
+    std::vector<MeshIndexType> values;
+    for(size_t i = 0; i < grown->size(); i++)
+    {
+      values.assign(grown->getElementListPointer(i), grown->getElementListPointer(i) + grown->getNumberOfElements(i));
+      values.push_back(100 + i);
+      grown->setElementList(i, static_cast<uint16_t>(values.size()), values.data());
+    }
+    DREAM3D_REQUIRE_EQUAL(grown->getTotalNumberOfElements(), containing->getTotalNumberOfElements() + containing->size())
+    for(size_t i = 0; i < grown->size(); i++)
+    {
+      const uint16_t count = containing->getNumberOfElements(i);
+      DREAM3D_REQUIRE_EQUAL(grown->getNumberOfElements(i), count + 1)
+      DREAM3D_REQUIRE_EQUAL(grown->getElementListPointer(i)[count], 100 + i)
+      grown->setElementList(i, count, containing->getElementListPointer(i));
+    }
+    requireSameLists(containing, grown);
+    requireSameLists(containing, grown->deepCopy());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDynamicListH5RoundTrip()
+  {
+    TriangleGeom::Pointer geom = createTriangleGrid(4);
+    DREAM3D_REQUIRE(geom->findElementsContainingVert() >= 0)
+    DREAM3D_REQUIRE(geom->findElementNeighbors() >= 0)
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::GeometryConnectivityTest::RoundTripFile);
+      DREAM3D_REQUIRED(fileId, >, 0)
+      H5ScopedFileSentinel sentinel(fileId, false);
+      DREAM3D_REQUIRED(geom->writeGeometryToHDF5(fileId, false), >=, 0)
+    }
+
+    TriangleGeom::Pointer readBack = TriangleGeom::New();
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::GeometryConnectivityTest::RoundTripFile, true);
+      DREAM3D_REQUIRED(fileId, >, 0)
+      H5ScopedFileSentinel sentinel(fileId, false);
+      DREAM3D_REQUIRED(readBack->readGeometryFromHDF5(fileId, false), >=, 0)
+    }
+    requireSameLists(geom->getElementNeighbors(), readBack->getElementNeighbors());
+    requireSameLists(geom->getElementsContainingVert(), readBack->getElementsContainingVert());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConnectivityTimings()
+  {
+    using Clock = std::chrono::steady_clock;
+    auto millis = [](Clock::time_point start) { return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count(); };
+
+    for(size_t dim : {100, 500, 1000})
+    {
+      TriangleGeom::Pointer geom = createTriangleGrid(dim);
+      Clock::time_point start = Clock::now();
+      geom->findEdges();
+      int64_t edgeTime = millis(start);
+      start = Clock::now();
+      geom->findUnsharedEdges();
+      int64_t unsharedTime = millis(start);
+      start = Clock::now();
+      geom->findElementsContainingVert();
+      int64_t containingTime = millis(start);
+      start = Clock::now();
+      geom->findElementNeighbors();
+      int64_t neighborTime = millis(start);
+      std::cout << "  Triangles: " << geom->getNumberOfElements() << "  findEdges: " << edgeTime << " ms  findUnsharedEdges: " << unsharedTime << " ms  findElementsContainingVert: " << containingTime
+                << " ms  findElementNeighbors: " << neighborTime << " ms" << std::endl;
+    }
+
+    for(size_t dim : {20, 50, 100})
+    {
+      HexahedralGeom::Pointer geom = createHexGrid(dim);
+      Clock::time_point start = Clock::now();
+      geom->findEdges();
+      int64_t edgeTime = millis(start);
+      start = Clock::now();
+      geom->findFaces();
+      int64_t faceTime = millis(start);
+      start = Clock::now();
+      geom->findUnsharedFaces();
+      int64_t unsharedTime = millis(start);
+      std::cout << "  Hexahedra: " << geom->getNumberOfElements() << "  findEdges: " << edgeTime << " ms  findFaces: " << faceTime << " ms  findUnsharedFaces: " << unsharedTime << " ms"
+                << std::endl;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryConnectivityTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    QDir dir(UnitTest::GeometryConnectivityTest::TestDir);
+    dir.mkpath(".");
+
+    DREAM3D_REGISTER_TEST(TestTriangleEdges());
+    DREAM3D_REGISTER_TEST(TestQuadEdges());
+    DREAM3D_REGISTER_TEST(TestTetConnectivity());
+    DREAM3D_REGISTER_TEST(TestHexConnectivity());
+    DREAM3D_REGISTER_TEST(TestElementTopology());
+    DREAM3D_REGISTER_TEST(TestDynamicListH5RoundTrip());
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestConnectivityTimings());
+#endif
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  GeometryConnectivityTest(const GeometryConnectivityTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryConnectivityTest&) = delete;           // Move assignment Not Implemented
+};
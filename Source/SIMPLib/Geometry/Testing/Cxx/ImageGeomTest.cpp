@@ -176,6 +176,35 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindIndices()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    SizeVec3Type dims(10, 20, 30);
+    FloatVec3Type spacing = {0.5f, 0.5f, 0.5f};
+    FloatVec3Type origin = {-10.0f, 5.0f, 2.0f};
+    geom->setDimensions(dims);
+    geom->setOrigin(origin);
+    geom->setSpacing(spacing);
+
+    // Points inside, on the edge of and outside of the geometry
+    std::vector<float> coords = {-9.9f, 5.25f, 2.15f, -6.95f, 5.9f, 2.55f, -10.0001f, 5.75f, 2.75f, -9.75f, 15.1f, 2.75f, -5.01f, 14.99f, 16.99f};
+    const size_t numPoints = coords.size() / 3;
+    std::vector<size_t> indices(numPoints, 0);
+    geom->findIndices(coords.data(), numPoints, indices.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      std::optional<size_t> result = geom->getIndex(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+      DREAM3D_REQUIRE_EQUAL(indices[i], result.has_value() ? *result : IGeometryGrid::k_InvalidIndex)
+    }
+    DREAM3D_REQUIRE_EQUAL(indices[0], 0)
+    DREAM3D_REQUIRE_EQUAL(indices[1], 216)
+    DREAM3D_REQUIRE_EQUAL(indices[2], IGeometryGrid::k_InvalidIndex)
+    DREAM3D_REQUIRE_EQUAL(indices[3], IGeometryGrid::k_InvalidIndex)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -187,6 +216,7 @@ public:
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
     DREAM3D_REGISTER_TEST(TestCoordsToIndex());
+    DREAM3D_REGISTER_TEST(TestFindIndices());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
@@ -1,5 +1,9 @@
 
+#include <chrono>
+#include <random>
+
 #include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
 class RectGridGeomTest
@@ -80,6 +84,126 @@ public:
     DREAM3D_REQUIRE_EQUAL(idxOpt.has_value(), false)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createBounds(size_t numCells, bool uniform, const QString& name)
+  {
+    FloatArrayType::Pointer bounds = FloatArrayType::CreateArray(numCells + 1, name, true);
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(numCells));
+    std::uniform_real_distribution<float> distribution(0.1f, 2.0f);
+    float value = -1.5f;
+    for(size_t i = 0; i <= numCells; i++)
+    {
+      (*bounds)[i] = value;
+      value += uniform ? 0.25f : distribution(generator);
+    }
+    return bounds;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  RectGridGeom::Pointer createGeometry(const SizeVec3Type& dims, bool uniformX, bool uniformY, bool uniformZ)
+  {
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(dims);
+    geom->setXBounds(createBounds(dims[0], uniformX, "xBnds"));
+    geom->setYBounds(createBounds(dims[1], uniformY, "yBnds"));
+    geom->setZBounds(createBounds(dims[2], uniformZ, "zBnds"));
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<double> createPoints(const RectGridGeom::Pointer& geom, size_t numPoints)
+  {
+    std::vector<double> coords(3 * numPoints);
+    std::mt19937 generator(42);
+    FloatArrayType::Pointer bounds[3] = {geom->getXBounds(), geom->getYBounds(), geom->getZBounds()};
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      for(size_t d = 0; d < 3; d++)
+      {
+        // Some points lie exactly on a bound and some are outside of the grid
+        std::uniform_real_distribution<double> distribution(bounds[d]->front() - 1.0, bounds[d]->back() + 1.0);
+        coords[3 * i + d] = (i % 7 == 0) ? (*bounds[d])[i % bounds[d]->getNumberOfTuples()] : distribution(generator);
+      }
+    }
+    return coords;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindIndices()
+  {
+    // Every combination of evenly and unevenly spaced axes must give the same cells as getIndex()
+    for(int32_t combination = 0; combination < 8; combination++)
+    {
+      RectGridGeom::Pointer geom = createGeometry(SizeVec3Type(17, 9, 23), (combination & 1) != 0, (combination & 2) != 0, (combination & 4) != 0);
+      const size_t numPoints = 5000;
+      std::vector<double> coords = createPoints(geom, numPoints);
+      std::vector<float> floatCoords(coords.begin(), coords.end());
+
+      std::vector<size_t> indices(numPoints, 0);
+      std::vector<size_t> floatIndices(numPoints, 0);
+      geom->findIndices(coords.data(), numPoints, indices.data());
+      geom->findIndices(floatCoords.data(), numPoints, floatIndices.data());
+      size_t numInside = 0;
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        std::optional<size_t> idxOpt = geom->getIndex(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+        DREAM3D_REQUIRE_EQUAL(indices[i], idxOpt.has_value() ? *idxOpt : IGeometryGrid::k_InvalidIndex)
+        idxOpt = geom->getIndex(floatCoords[3 * i], floatCoords[3 * i + 1], floatCoords[3 * i + 2]);
+        DREAM3D_REQUIRE_EQUAL(floatIndices[i], idxOpt.has_value() ? *idxOpt : IGeometryGrid::k_InvalidIndex)
+        numInside += idxOpt.has_value() ? 1 : 0;
+      }
+      DREAM3D_REQUIRED(numInside, >, 0)
+      DREAM3D_REQUIRED(numInside, <, numPoints)
+    }
+
+    // Points that are not numbers are outside of the grid
+    RectGridGeom::Pointer geom = createGeometry(SizeVec3Type(4, 4, 4), true, false, true);
+    double nanCoords[3] = {std::numeric_limits<double>::quiet_NaN(), 0.0, 0.0};
+    size_t index = 0;
+    geom->findIndices(nanCoords, 1, &index);
+    DREAM3D_REQUIRE_EQUAL(index, IGeometryGrid::k_InvalidIndex)
+    DREAM3D_REQUIRE_EQUAL(geom->getIndex(nanCoords[0], nanCoords[1], nanCoords[2]).has_value(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkFindIndices()
+  {
+    const size_t numPoints = 1000000;
+    for(bool uniform : {true, false})
+    {
+      RectGridGeom::Pointer geom = createGeometry(SizeVec3Type(2000, 2000, 2000), uniform, uniform, uniform);
+      std::vector<double> coords = createPoints(geom, numPoints);
+      std::vector<size_t> indices(numPoints, 0);
+
+      auto start = std::chrono::steady_clock::now();
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        std::optional<size_t> idxOpt = geom->getIndex(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+        indices[i] = idxOpt.has_value() ? *idxOpt : IGeometryGrid::k_InvalidIndex;
+      }
+      auto end = std::chrono::steady_clock::now();
+      auto getIndexTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+      start = std::chrono::steady_clock::now();
+      geom->findIndices(coords.data(), numPoints, indices.data());
+      end = std::chrono::steady_clock::now();
+      auto findIndicesTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+      std::cout << "\t" << numPoints << " points on a 2000^3 " << (uniform ? "uniform" : "non-uniform") << " grid: getIndex " << getIndexTime << " ms, findIndices " << findIndicesTime << " ms"
+                << std::endl;
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -90,6 +214,10 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestGetIndex());
+    DREAM3D_REGISTER_TEST(TestFindIndices());
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkFindIndices());
+#endif
   }
 
 private:
@@ -1,7 +1,9 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  GeometryConnectivityTest
   ImageGeomTest
   RectGridGeomTest
+  VertexSpatialIndexTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
@@ -0,0 +1,245 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class VertexSpatialIndexTest
+{
+public:
+  VertexSpatialIndexTest() = default;
+  ~VertexSpatialIndexTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Random vertices in [-10, 10] x [-10, 10] x [-1, 1] with a few non-finite ones mixed in
+  // -----------------------------------------------------------------------------
+  VertexGeom::Pointer createCloud(size_t numVertices)
+  {
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(numVertices, SIMPL::Geometry::VertexGeometry);
+    float* verts = geom->getVertexPointer(0);
+    for(size_t i = 0; i < numVertices; i++)
+    {
+      verts[3 * i + 0] = distribution(generator);
+      verts[3 * i + 1] = distribution(generator);
+      verts[3 * i + 2] = distribution(generator) * 0.1f;
+    }
+    verts[3 * 7 + 0] = std::nanf("");
+    verts[3 * 11 + 2] = std::numeric_limits<float>::infinity();
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool isFinite(const float* vert)
+  {
+    return std::isfinite(vert[0]) && std::isfinite(vert[1]) && std::isfinite(vert[2]);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  double distance2(const float* vert, const float* point)
+  {
+    double dx = static_cast<double>(vert[0]) - point[0];
+    double dy = static_cast<double>(vert[1]) - point[1];
+    double dz = static_cast<double>(vert[2]) - point[2];
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBuild()
+  {
+    VertexGeom::Pointer geom = createCloud(1000);
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::Create(geom->getVertices());
+    DREAM3D_REQUIRE_VALID_POINTER(index.get())
+    DREAM3D_REQUIRE(index->getVertices() == geom->getVertices())
+
+    // An index is never built for a missing vertex list
+    DREAM3D_REQUIRE(nullptr == VertexSpatialIndex::Create(SharedVertexList::NullPointer()))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestQueries()
+  {
+    const size_t numVertices = 50000;
+    VertexGeom::Pointer geom = createCloud(numVertices);
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::Create(geom->getVertices());
+    const float* verts = geom->getVertexPointer(0);
+
+    std::mt19937 generator(54321);
+    std::uniform_real_distribution<float> distribution(-12.0f, 12.0f);
+    for(size_t q = 0; q < 50; q++)
+    {
+      float boxMin[3] = {distribution(generator), distribution(generator), -0.5f};
+      float boxMax[3] = {boxMin[0] + 4.0f, boxMin[1] + 2.0f, 0.5f};
+      // A box that covers the whole cloud goes through the linear scan instead of the bins
+      if(q == 0)
+      {
+        boxMin[0] = boxMin[1] = boxMin[2] = -100.0f;
+        boxMax[0] = boxMax[1] = boxMax[2] = 100.0f;
+      }
+      std::vector<size_t> expected;
+      for(size_t i = 0; i < numVertices; i++)
+      {
+        const float* vert = verts + 3 * i;
+        if(isFinite(vert) && vert[0] >= boxMin[0] && vert[0] <= boxMax[0] && vert[1] >= boxMin[1] && vert[1] <= boxMax[1] && vert[2] >= boxMin[2] && vert[2] <= boxMax[2])
+        {
+          expected.push_back(i);
+        }
+      }
+      DREAM3D_REQUIRE(expected == index->findInBox(boxMin, boxMax))
+      DREAM3D_REQUIRE(expected == VertexSpatialIndex::FindInBox(geom->getVertices(), boxMin, boxMax))
+
+      float center[3] = {distribution(generator), distribution(generator), 0.0f};
+      float radius = 1.5f;
+      expected.clear();
+      for(size_t i = 0; i < numVertices; i++)
+      {
+        if(isFinite(verts + 3 * i) && distance2(verts + 3 * i, center) <= static_cast<double>(radius) * radius)
+        {
+          expected.push_back(i);
+        }
+      }
+      DREAM3D_REQUIRE(expected == index->findInSphere(center, radius))
+
+      int64_t nearest = -1;
+      double nearestDist2 = std::numeric_limits<double>::max();
+      for(size_t i = 0; i < numVertices; i++)
+      {
+        if(isFinite(verts + 3 * i) && distance2(verts + 3 * i, center) < nearestDist2)
+        {
+          nearestDist2 = distance2(verts + 3 * i, center);
+          nearest = static_cast<int64_t>(i);
+        }
+      }
+      DREAM3D_REQUIRE_EQUAL(index->findNearest(center), nearest)
+    }
+
+    // The non-finite vertices are never returned
+    float everything = std::numeric_limits<float>::max();
+    float boxMin[3] = {-everything, -everything, -everything};
+    float boxMax[3] = {everything, everything, everything};
+    DREAM3D_REQUIRE_EQUAL(index->findInBox(boxMin, boxMax).size(), numVertices - 2)
+    DREAM3D_REQUIRE_EQUAL(VertexSpatialIndex::FindInBox(geom->getVertices(), boxMin, boxMax).size(), numVertices - 2)
+    DREAM3D_REQUIRE(VertexSpatialIndex::FindInBox(SharedVertexList::NullPointer(), boxMin, boxMax).empty())
+
+    // The batched search matches the single point search
+    std::vector<float> points = {0.0f, 0.0f, 0.0f, 25.0f, -25.0f, 3.0f, 9.5f, 9.5f, -1.0f};
+    std::vector<int64_t> batch = index->findNearest(points.data(), 3);
+    for(size_t p = 0; p < 3; p++)
+    {
+      DREAM3D_REQUIRE_EQUAL(batch[p], index->findNearest(points.data() + 3 * p))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFlatCloud()
+  {
+    // A flat scan with float noise along z: the thin axis must not blow up the number of bins
+    const size_t numVertices = 100000;
+    std::mt19937 generator(54321);
+    std::uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> noise(0.0f, 1.0E-6f);
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(numVertices, SIMPL::Geometry::VertexGeometry);
+    float* verts = geom->getVertexPointer(0);
+    for(size_t i = 0; i < numVertices; i++)
+    {
+      verts[3 * i + 0] = distribution(generator);
+      verts[3 * i + 1] = distribution(generator);
+      verts[3 * i + 2] = noise(generator);
+    }
+
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::Create(geom->getVertices());
+    DREAM3D_REQUIRE_VALID_POINTER(index.get())
+    size_t dims[3] = {0, 0, 0};
+    index->getBinDimensions(dims);
+    DREAM3D_REQUIRE_EQUAL(dims[2], 1)
+    DREAM3D_REQUIRE(dims[0] > 1 && dims[1] > 1)
+    DREAM3D_REQUIRE(dims[0] * dims[1] * dims[2] <= numVertices)
+
+    float boxMin[3] = {100.0f, 200.0f, -1.0f};
+    float boxMax[3] = {300.0f, 250.0f, 1.0f};
+    std::vector<size_t> expected;
+    for(size_t i = 0; i < numVertices; i++)
+    {
+      const float* vert = verts + 3 * i;
+      if(vert[0] >= boxMin[0] && vert[0] <= boxMax[0] && vert[1] >= boxMin[1] && vert[1] <= boxMax[1])
+      {
+        expected.push_back(i);
+      }
+    }
+    DREAM3D_REQUIRE(expected == index->findInBox(boxMin, boxMax))
+
+    // Never more bins than vertices, even for a handful of vertices spread over all three axes
+    VertexGeom::Pointer small = createCloud(20);
+    index = VertexSpatialIndex::Create(small->getVertices(), 1);
+    index->getBinDimensions(dims);
+    DREAM3D_REQUIRE(dims[0] * dims[1] * dims[2] <= 18)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkQueries()
+  {
+    using Clock = std::chrono::steady_clock;
+    auto millis = [](Clock::time_point start) { return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count(); };
+
+    const size_t numVertices = 10000000;
+    VertexGeom::Pointer geom = createCloud(numVertices);
+
+    Clock::time_point start = Clock::now();
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::Create(geom->getVertices());
+    int64_t buildTime = millis(start);
+
+    float boxMin[3] = {0.0f, 0.0f, -1.0f};
+    float boxMax[3] = {1.0f, 1.0f, 1.0f};
+    start = Clock::now();
+    size_t numFound = 0;
+    for(size_t q = 0; q < 100; q++)
+    {
+      numFound += index->findInBox(boxMin, boxMax).size();
+    }
+    int64_t queryTime = millis(start);
+
+    std::cout << "  Vertices: " << numVertices << "  build: " << buildTime << " ms  100 box queries: " << queryTime << " ms (" << numFound / 100 << " vertices each)" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### VertexSpatialIndexTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBuild())
+    DREAM3D_REGISTER_TEST(TestQueries())
+    DREAM3D_REGISTER_TEST(TestFlatCloud())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkQueries())
+#endif
+  }
+
+public:
+  VertexSpatialIndexTest(const VertexSpatialIndexTest&) = delete;            // Copy Constructor Not Implemented
+  VertexSpatialIndexTest(VertexSpatialIndexTest&&) = delete;                 // Move Constructor Not Implemented
+  VertexSpatialIndexTest& operator=(const VertexSpatialIndexTest&) = delete; // Copy Assignment Not Implemented
+  VertexSpatialIndexTest& operator=(VertexSpatialIndexTest&&) = delete;      // Move Assignment Not Implemented
+};
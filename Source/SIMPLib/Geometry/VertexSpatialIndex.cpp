@@ -0,0 +1,691 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_sort.h>
+#endif
+
+namespace
+{
+// Number of vertices handed to a task at a time
+constexpr size_t k_BlockSize = 65536;
+
+constexpr size_t k_MaxBinsPerAxis = 1048576;
+
+// When the bins overlapping a query hold more than 1/k_ScanRatio of the vertices, a linear scan over all of them is
+// cheaper than gathering the bins and sorting the result, and it produces the indices already in order
+constexpr size_t k_ScanRatio = 8;
+
+// Fraction of a bin by which the nearest vertex search shrinks the region it has covered, so that rounding in the
+// bin assignment can never end the search early
+constexpr double k_FaceTolerance = 1.0E-6;
+
+// -----------------------------------------------------------------------------
+bool IsFinite(const float* coords)
+{
+  return std::isfinite(coords[0]) && std::isfinite(coords[1]) && std::isfinite(coords[2]);
+}
+
+// -----------------------------------------------------------------------------
+size_t GetNumberOfBlocks(size_t count)
+{
+  return (count + k_BlockSize - 1) / k_BlockSize;
+}
+
+/**
+ * @brief Returns, in ascending order, the indices below count that pass the test. Each block of indices is counted
+ * first so that every block then writes its indices straight to their final position.
+ * @param count
+ * @param selected
+ * @return
+ */
+template <typename Predicate>
+std::vector<size_t> CompactIndices(size_t count, const Predicate& selected)
+{
+  const size_t numBlocks = GetNumberOfBlocks(count);
+  std::vector<size_t> offsets(numBlocks + 1, 0);
+
+  ParallelDataAlgorithm countAlg;
+  countAlg.setRange(0, numBlocks);
+  countAlg.execute([&](const SIMPLRange& range) {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t numSelected = 0;
+      for(size_t i = block * k_BlockSize; i < std::min((block + 1) * k_BlockSize, count); i++)
+      {
+        numSelected += selected(i) ? 1 : 0;
+      }
+      offsets[block + 1] = numSelected;
+    }
+  });
+  for(size_t block = 0; block < numBlocks; block++)
+  {
+    offsets[block + 1] += offsets[block];
+  }
+
+  std::vector<size_t> indices(offsets.back());
+  ParallelDataAlgorithm writeAlg;
+  writeAlg.setRange(0, numBlocks);
+  writeAlg.execute([&](const SIMPLRange& range) {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t next = offsets[block];
+      for(size_t i = block * k_BlockSize; i < std::min((block + 1) * k_BlockSize, count); i++)
+      {
+        if(selected(i))
+        {
+          indices[next++] = i;
+        }
+      }
+    }
+  });
+  return indices;
+}
+
+// -----------------------------------------------------------------------------
+void SortIndices(std::vector<size_t>& indices)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_sort(indices.begin(), indices.end());
+#else
+  std::sort(indices.begin(), indices.end());
+#endif
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::VertexSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::~VertexSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexSpatialIndex::Create(const SharedVertexList::Pointer& vertices, size_t pointsPerBin)
+{
+  if(nullptr == vertices || vertices->getNumberOfComponents() != 3)
+  {
+    return NullPointer();
+  }
+
+  Pointer index(new VertexSpatialIndex());
+  index->m_Vertices = vertices;
+  index->m_NumVertices = vertices->getNumberOfTuples();
+  const size_t numVertices = index->m_NumVertices;
+  const float* coords = vertices->getPointer(0);
+
+  // Bounding box of the finite vertices
+  float minCoords[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float maxCoords[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  size_t numFinite = 0;
+  {
+    std::mutex mutex;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, GetNumberOfBlocks(numVertices));
+    dataAlg.execute([&](const SIMPLRange& range) {
+      float localMin[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+      float localMax[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+      size_t localFinite = 0;
+      for(size_t i = range.min() * k_BlockSize; i < std::min(range.max() * k_BlockSize, numVertices); i++)
+      {
+        const float* vert = coords + 3 * i;
+        if(!IsFinite(vert))
+        {
+          continue;
+        }
+        for(size_t a = 0; a < 3; a++)
+        {
+          localMin[a] = std::min(localMin[a], vert[a]);
+          localMax[a] = std::max(localMax[a], vert[a]);
+        }
+        localFinite++;
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      for(size_t a = 0; a < 3; a++)
+      {
+        minCoords[a] = std::min(minCoords[a], localMin[a]);
+        maxCoords[a] = std::max(maxCoords[a], localMax[a]);
+      }
+      numFinite += localFinite;
+    });
+  }
+
+  if(numFinite == 0)
+  {
+    index->m_BinOffsets.assign(2, 0);
+    return index;
+  }
+
+  // Size the bins so that there are about numFinite / pointsPerBin of them, spread over the axes the vertices
+  // actually extend along. An axis that is thinner than a bin (e.g. float noise on a flat scan) gets a single bin
+  // and the bin size is recomputed over the remaining axes, otherwise its tiny extent would shrink the bins of the
+  // other axes by orders of magnitude.
+  double extents[3] = {0.0, 0.0, 0.0};
+  bool binned[3] = {false, false, false};
+  for(size_t a = 0; a < 3; a++)
+  {
+    index->m_Min[a] = minCoords[a];
+    index->m_Max[a] = maxCoords[a];
+    extents[a] = static_cast<double>(maxCoords[a]) - static_cast<double>(minCoords[a]);
+    binned[a] = extents[a] > 0.0;
+  }
+  const double targetBins = std::max(1.0, static_cast<double>(numFinite) / static_cast<double>(std::max<size_t>(1, pointsPerBin)));
+  double binSize = 0.0;
+  for(bool changed = true; changed;)
+  {
+    changed = false;
+    double volume = 1.0;
+    size_t numAxes = 0;
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(binned[a])
+      {
+        volume *= extents[a];
+        numAxes++;
+      }
+    }
+    binSize = (numAxes > 0) ? std::pow(volume / targetBins, 1.0 / static_cast<double>(numAxes)) : 0.0;
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(binned[a] && extents[a] < binSize)
+      {
+        binned[a] = false;
+        changed = true;
+      }
+    }
+  }
+
+  double binsPerAxis[3] = {1.0, 1.0, 1.0};
+  double totalBins = 1.0;
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(binned[a] && binSize > 0.0)
+    {
+      binsPerAxis[a] = std::min(std::max(std::ceil(extents[a] / binSize), 1.0), static_cast<double>(k_MaxBinsPerAxis));
+    }
+    totalBins *= binsPerAxis[a];
+  }
+  // Rounding up every axis can overshoot the target; never allocate more bins than there are vertices
+  const double maxBins = static_cast<double>(numFinite);
+  while(totalBins > maxBins)
+  {
+    size_t largest = 0;
+    for(size_t a = 1; a < 3; a++)
+    {
+      largest = (binsPerAxis[a] > binsPerAxis[largest]) ? a : largest;
+    }
+    const double reduced = std::max(1.0, std::floor(binsPerAxis[largest] * std::max(0.5, maxBins / totalBins)));
+    totalBins = totalBins / binsPerAxis[largest] * reduced;
+    binsPerAxis[largest] = reduced;
+  }
+  for(size_t a = 0; a < 3; a++)
+  {
+    index->m_Dims[a] = static_cast<size_t>(binsPerAxis[a]);
+    if(extents[a] > 0.0)
+    {
+      index->m_BinSize[a] = extents[a] / binsPerAxis[a];
+      index->m_InvBinSize[a] = binsPerAxis[a] / extents[a];
+    }
+  }
+  const size_t dimX = index->m_Dims[0];
+  const size_t dimY = index->m_Dims[1];
+  const size_t numBins = dimX * dimY * index->m_Dims[2];
+
+  const VertexSpatialIndex* self = index.get();
+  auto findBin = [self, coords, dimX, dimY](size_t vertId) {
+    const float* vert = coords + 3 * vertId;
+    return (self->findAxisBin(vert[2], 2) * dimY + self->findAxisBin(vert[1], 1)) * dimX + self->findAxisBin(vert[0], 0);
+  };
+
+  // Counting sort of the vertices by bin. Each chunk of vertices counts its own bins so that the chunks can then
+  // write their vertices without synchronizing, and vertices keep their relative order inside a bin. The chunk
+  // tables together stay no larger than the sorted vertex list.
+  const size_t numThreads = static_cast<size_t>(std::max<int32_t>(1, ParallelExecutionContext::CurrentConcurrency()));
+  const size_t numChunks = std::max<size_t>(1, std::min(numThreads, numFinite / numBins));
+  std::vector<size_t> chunkSlots(numChunks * numBins, 0);
+  auto chunkBegin = [numVertices, numChunks](size_t chunk) { return chunk * numVertices / numChunks; };
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        size_t* counts = chunkSlots.data() + chunk * numBins;
+        for(size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++)
+        {
+          if(IsFinite(coords + 3 * i))
+          {
+            counts[findBin(i)]++;
+          }
+        }
+      }
+    });
+  }
+
+  std::vector<size_t>& binOffsets = index->m_BinOffsets;
+  binOffsets.assign(numBins + 1, 0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBins);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t bin = range.min(); bin < range.max(); bin++)
+      {
+        size_t count = 0;
+        for(size_t chunk = 0; chunk < numChunks; chunk++)
+        {
+          count += chunkSlots[chunk * numBins + bin];
+        }
+        binOffsets[bin + 1] = count;
+      }
+    });
+  }
+  for(size_t bin = 0; bin < numBins; bin++)
+  {
+    binOffsets[bin + 1] += binOffsets[bin];
+  }
+  {
+    // Turn the counts into the first slot of every chunk inside every bin
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBins);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t bin = range.min(); bin < range.max(); bin++)
+      {
+        size_t next = binOffsets[bin];
+        for(size_t chunk = 0; chunk < numChunks; chunk++)
+        {
+          size_t count = chunkSlots[chunk * numBins + bin];
+          chunkSlots[chunk * numBins + bin] = next;
+          next += count;
+        }
+      }
+    });
+  }
+
+  std::vector<size_t>& sortedVertices = index->m_SortedVertices;
+  sortedVertices.resize(numFinite);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        size_t* slots = chunkSlots.data() + chunk * numBins;
+        for(size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++)
+        {
+          if(IsFinite(coords + 3 * i))
+          {
+            sortedVertices[slots[findBin(i)]++] = i;
+          }
+        }
+      }
+    });
+  }
+
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SharedVertexList::Pointer VertexSpatialIndex::getVertices() const
+{
+  return m_Vertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::getBounds(float min[3], float max[3]) const
+{
+  for(size_t a = 0; a < 3; a++)
+  {
+    min[a] = m_Min[a];
+    max[a] = m_Max[a];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::getBinDimensions(size_t dims[3]) const
+{
+  for(size_t a = 0; a < 3; a++)
+  {
+    dims[a] = m_Dims[a];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::findAxisBin(float value, size_t axis) const
+{
+  const double t = (static_cast<double>(value) - static_cast<double>(m_Min[axis])) * m_InvBinSize[axis];
+  if(!(t > 0.0))
+  {
+    return 0;
+  }
+  if(t >= static_cast<double>(m_Dims[axis]))
+  {
+    return m_Dims[axis] - 1;
+  }
+  return static_cast<size_t>(t);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Predicate>
+std::vector<size_t> VertexSpatialIndex::selectVertices(const float min[3], const float max[3], bool wholeInteriorBins, const Predicate& contains) const
+{
+  if(m_SortedVertices.empty())
+  {
+    return {};
+  }
+  size_t lo[3] = {0, 0, 0};
+  size_t hi[3] = {0, 0, 0};
+  for(size_t a = 0; a < 3; a++)
+  {
+    if(!(min[a] <= max[a]) || max[a] < m_Min[a] || min[a] > m_Max[a])
+    {
+      return {};
+    }
+    lo[a] = findAxisBin(min[a], a);
+    hi[a] = findAxisBin(max[a], a);
+  }
+
+  // Bins are laid out x fastest, so each row of bins along x is one contiguous run of the sorted vertices
+  const size_t rowsY = hi[1] - lo[1] + 1;
+  const size_t numRows = rowsY * (hi[2] - lo[2] + 1);
+  auto rowBin = [&](size_t row, size_t x) { return ((lo[2] + row / rowsY) * m_Dims[1] + lo[1] + row % rowsY) * m_Dims[0] + x; };
+
+  std::atomic<size_t> numCandidates(0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numRows);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      size_t count = 0;
+      for(size_t row = range.min(); row < range.max(); row++)
+      {
+        count += m_BinOffsets[rowBin(row, hi[0]) + 1] - m_BinOffsets[rowBin(row, lo[0])];
+      }
+      numCandidates += count;
+    });
+  }
+
+  const float* coords = m_Vertices->getPointer(0);
+  if(numCandidates.load() * k_ScanRatio > m_SortedVertices.size())
+  {
+    return CompactIndices(m_NumVertices, [coords, &contains](size_t vertId) {
+      const float* vert = coords + 3 * vertId;
+      return IsFinite(vert) && contains(vert);
+    });
+  }
+
+  std::vector<size_t> indices;
+  indices.reserve(numCandidates.load());
+  std::mutex mutex;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRows);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    std::vector<size_t> selected;
+    for(size_t row = range.min(); row < range.max(); row++)
+    {
+      const size_t y = lo[1] + row % rowsY;
+      const size_t z = lo[2] + row / rowsY;
+      const bool interiorRow = wholeInteriorBins && y > lo[1] && y < hi[1] && z > lo[2] && z < hi[2];
+      for(size_t x = lo[0]; x <= hi[0]; x++)
+      {
+        const size_t bin = rowBin(row, x);
+        const size_t* first = m_SortedVertices.data() + m_BinOffsets[bin];
+        const size_t* last = m_SortedVertices.data() + m_BinOffsets[bin + 1];
+        if(interiorRow && x > lo[0] && x < hi[0])
+        {
+          selected.insert(selected.end(), first, last);
+          continue;
+        }
+        for(const size_t* vertId = first; vertId != last; vertId++)
+        {
+          if(contains(coords + 3 * (*vertId)))
+          {
+            selected.push_back(*vertId);
+          }
+        }
+      }
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    indices.insert(indices.end(), selected.begin(), selected.end());
+  });
+
+  SortIndices(indices);
+  return indices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexSpatialIndex::FindInBox(const SharedVertexList::Pointer& vertices, const float min[3], const float max[3])
+{
+  if(nullptr == vertices || vertices->getNumberOfComponents() != 3)
+  {
+    return {};
+  }
+  const float boxMin[3] = {min[0], min[1], min[2]};
+  const float boxMax[3] = {max[0], max[1], max[2]};
+  const float* coords = vertices->getPointer(0);
+  return CompactIndices(vertices->getNumberOfTuples(), [coords, &boxMin, &boxMax](size_t vertId) {
+    const float* vert = coords + 3 * vertId;
+    return IsFinite(vert) && vert[0] >= boxMin[0] && vert[0] <= boxMax[0] && vert[1] >= boxMin[1] && vert[1] <= boxMax[1] && vert[2] >= boxMin[2] && vert[2] <= boxMax[2];
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexSpatialIndex::findInBox(const float min[3], const float max[3]) const
+{
+  const float boxMin[3] = {min[0], min[1], min[2]};
+  const float boxMax[3] = {max[0], max[1], max[2]};
+  return selectVertices(boxMin, boxMax, true, [&boxMin, &boxMax](const float* vert) {
+    return vert[0] >= boxMin[0] && vert[0] <= boxMax[0] && vert[1] >= boxMin[1] && vert[1] <= boxMax[1] && vert[2] >= boxMin[2] && vert[2] <= boxMax[2];
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexSpatialIndex::findInSphere(const float center[3], float radius) const
+{
+  if(!IsFinite(center) || !std::isfinite(radius) || radius < 0.0f)
+  {
+    return {};
+  }
+
+  // Widened by one float step so that rounding cannot leave a vertex of the sphere outside the box
+  float boxMin[3] = {0.0f, 0.0f, 0.0f};
+  float boxMax[3] = {0.0f, 0.0f, 0.0f};
+  for(size_t a = 0; a < 3; a++)
+  {
+    boxMin[a] = std::nextafter(center[a] - radius, std::numeric_limits<float>::lowest());
+    boxMax[a] = std::nextafter(center[a] + radius, std::numeric_limits<float>::max());
+  }
+  const double cx = center[0];
+  const double cy = center[1];
+  const double cz = center[2];
+  const double radius2 = static_cast<double>(radius) * static_cast<double>(radius);
+  return selectVertices(boxMin, boxMax, false, [cx, cy, cz, radius2](const float* vert) {
+    const double dx = vert[0] - cx;
+    const double dy = vert[1] - cy;
+    const double dz = vert[2] - cz;
+    return dx * dx + dy * dy + dz * dz <= radius2;
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t VertexSpatialIndex::findNearest(const float point[3]) const
+{
+  if(m_SortedVertices.empty() || !IsFinite(point))
+  {
+    return -1;
+  }
+
+  const float* coords = m_Vertices->getPointer(0);
+  size_t center[3] = {0, 0, 0};
+  size_t maxRing = 0;
+  for(size_t a = 0; a < 3; a++)
+  {
+    center[a] = findAxisBin(point[a], a);
+    maxRing = std::max({maxRing, center[a], m_Dims[a] - 1 - center[a]});
+  }
+
+  int64_t nearest = -1;
+  double nearestDist2 = std::numeric_limits<double>::max();
+  auto visitBin = [&](size_t x, size_t y, size_t z) {
+    const size_t bin = (z * m_Dims[1] + y) * m_Dims[0] + x;
+    for(size_t k = m_BinOffsets[bin]; k < m_BinOffsets[bin + 1]; k++)
+    {
+      const size_t vertId = m_SortedVertices[k];
+      const float* vert = coords + 3 * vertId;
+      const double dx = static_cast<double>(vert[0]) - point[0];
+      const double dy = static_cast<double>(vert[1]) - point[1];
+      const double dz = static_cast<double>(vert[2]) - point[2];
+      const double dist2 = dx * dx + dy * dy + dz * dz;
+      if(dist2 < nearestDist2 || (dist2 == nearestDist2 && static_cast<int64_t>(vertId) < nearest))
+      {
+        nearestDist2 = dist2;
+        nearest = static_cast<int64_t>(vertId);
+      }
+    }
+  };
+
+  // Visit the bins in shells of growing distance around the bin of the point
+  for(size_t ring = 0; ring <= maxRing; ring++)
+  {
+    size_t lo[3] = {0, 0, 0};
+    size_t hi[3] = {0, 0, 0};
+    for(size_t a = 0; a < 3; a++)
+    {
+      lo[a] = (center[a] > ring) ? center[a] - ring : 0;
+      hi[a] = std::min(center[a] + ring, m_Dims[a] - 1);
+    }
+    for(size_t z = lo[2]; z <= hi[2]; z++)
+    {
+      for(size_t y = lo[1]; y <= hi[1]; y++)
+      {
+        const bool onShell = (z + ring == center[2]) || (z == center[2] + ring) || (y + ring == center[1]) || (y == center[1] + ring);
+        if(onShell)
+        {
+          for(size_t x = lo[0]; x <= hi[0]; x++)
+          {
+            visitBin(x, y, z);
+          }
+          continue;
+        }
+        if(center[0] >= ring)
+        {
+          visitBin(center[0] - ring, y, z);
+        }
+        if(ring > 0 && center[0] + ring < m_Dims[0])
+        {
+          visitBin(center[0] + ring, y, z);
+        }
+      }
+    }
+
+    if(nearest < 0)
+    {
+      continue;
+    }
+    // Every vertex not visited yet lies beyond one of the faces of the block of bins visited so far
+    double clearance = std::numeric_limits<double>::max();
+    for(size_t a = 0; a < 3; a++)
+    {
+      const double tolerance = k_FaceTolerance * m_BinSize[a];
+      if(center[a] > ring)
+      {
+        clearance = std::min(clearance, point[a] - (m_Min[a] + static_cast<double>(center[a] - ring) * m_BinSize[a]) - tolerance);
+      }
+      if(center[a] + ring + 1 < m_Dims[a])
+      {
+        clearance = std::min(clearance, m_Min[a] + static_cast<double>(center[a] + ring + 1) * m_BinSize[a] - point[a] - tolerance);
+      }
+    }
+    if(clearance > 0.0 && nearestDist2 < clearance * clearance)
+    {
+      break;
+    }
+  }
+  return nearest;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int64_t> VertexSpatialIndex::findNearest(const float* points, size_t numPoints) const
+{
+  std::vector<int64_t> nearest(numPoints, -1);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      nearest[i] = findNearest(points + 3 * i);
+    }
+  });
+  return nearest;
+}
+
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexSpatialIndex::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
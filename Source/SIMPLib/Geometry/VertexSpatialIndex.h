@@ -0,0 +1,174 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+/**
+ * @brief The VertexSpatialIndex class bins the vertices of a point cloud into a uniform grid so that box, sphere and
+ * nearest vertex queries only visit the vertices near the query. The bins are sized from the bounding box of the
+ * vertices so that each one holds a few vertices on average. Vertices with a non-finite coordinate are not binned
+ * and are never returned by a query.
+ *
+ * The index keeps a reference to the vertex list it was built from and reads the coordinates from it at query time.
+ * It must be rebuilt after the vertices are moved or the list is resized.
+ */
+class SIMPLib_EXPORT VertexSpatialIndex
+{
+public:
+  using Self = VertexSpatialIndex;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Builds the index of the given vertices
+   * @param vertices
+   * @param pointsPerBin Average number of vertices the bins are sized for
+   * @return
+   */
+  static Pointer Create(const SharedVertexList::Pointer& vertices, size_t pointsPerBin = 8);
+
+  /**
+   * @brief Finds the vertices inside the box, bounds included, with one parallel pass over the vertex list and
+   * without building an index. Prefer this for a single query; build an index when the same vertices are queried
+   * repeatedly.
+   * @param vertices
+   * @param min
+   * @param max
+   * @return The vertex indices in ascending order
+   */
+  static std::vector<size_t> FindInBox(const SharedVertexList::Pointer& vertices, const float min[3], const float max[3]);
+
+  virtual ~VertexSpatialIndex();
+
+  /**
+   * @brief Returns the vertex list the index was built from
+   * @return
+   */
+  SharedVertexList::Pointer getVertices() const;
+
+  /**
+   * @brief Returns the bounding box of the indexed vertices
+   * @param min
+   * @param max
+   */
+  void getBounds(float min[3], float max[3]) const;
+
+  /**
+   * @brief Returns the number of bins along each axis
+   * @param dims
+   */
+  void getBinDimensions(size_t dims[3]) const;
+
+  /**
+   * @brief Finds the vertices inside the box, bounds included
+   * @param min
+   * @param max
+   * @return The vertex indices in ascending order
+   */
+  std::vector<size_t> findInBox(const float min[3], const float max[3]) const;
+
+  /**
+   * @brief Finds the vertices whose distance to the center is at most the radius
+   * @param center
+   * @param radius
+   * @return The vertex indices in ascending order
+   */
+  std::vector<size_t> findInSphere(const float center[3], float radius) const;
+
+  /**
+   * @brief Finds the vertex closest to the point. Ties go to the lowest vertex index.
+   * @param point
+   * @return The vertex index, or -1 if the index is empty or the point is not finite
+   */
+  int64_t findNearest(const float point[3]) const;
+
+  /**
+   * @brief Finds the closest vertex of every point in parallel
+   * @param points Interleaved x/y/z coordinates
+   * @param numPoints
+   * @return The vertex index of every point, or -1 where findNearest() would return -1
+   */
+  std::vector<int64_t> findNearest(const float* points, size_t numPoints) const;
+
+protected:
+  VertexSpatialIndex();
+
+  /**
+   * @brief Returns the bin of a coordinate along one axis. Coordinates outside the bounds are clamped to the first
+   * or last bin. The mapping never decreases as the coordinate grows, which lets the box query skip the test on
+   * bins that lie strictly between the bins of the box corners.
+   * @param value
+   * @param axis
+   * @return
+   */
+  size_t findAxisBin(float value, size_t axis) const;
+
+  /**
+   * @brief Returns the vertices of the bins overlapping the box that pass the test. Bins strictly inside the box
+   * are taken whole when wholeInteriorBins is set.
+   * @param min
+   * @param max
+   * @param wholeInteriorBins
+   * @param contains
+   * @return The vertex indices in ascending order
+   */
+  template <typename Predicate>
+  std::vector<size_t> selectVertices(const float min[3], const float max[3], bool wholeInteriorBins, const Predicate& contains) const;
+
+private:
+  SharedVertexList::Pointer m_Vertices;
+  size_t m_NumVertices = 0;
+  float m_Min[3] = {0.0f, 0.0f, 0.0f};
+  float m_Max[3] = {0.0f, 0.0f, 0.0f};
+  double m_BinSize[3] = {0.0, 0.0, 0.0};
+  double m_InvBinSize[3] = {0.0, 0.0, 0.0};
+  size_t m_Dims[3] = {1, 1, 1};
+  std::vector<size_t> m_BinOffsets;
+  std::vector<size_t> m_SortedVertices;
+
+public:
+  VertexSpatialIndex(const VertexSpatialIndex&) = delete;            // Copy Constructor Not Implemented
+  VertexSpatialIndex(VertexSpatialIndex&&) = delete;                 // Move Constructor Not Implemented
+  VertexSpatialIndex& operator=(const VertexSpatialIndex&) = delete; // Copy Assignment Not Implemented
+  VertexSpatialIndex& operator=(VertexSpatialIndex&&) = delete;      // Move Assignment Not Implemented
+};
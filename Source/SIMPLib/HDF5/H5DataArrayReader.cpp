@@ -43,10 +43,13 @@
 using namespace H5Support;
 
 #include <QtCore/QDebug>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/HDF5/H5DeferredDataSource.h"
 
 #define MIKESTEMP 1
 
@@ -60,8 +63,87 @@ H5DataArrayReader::H5DataArrayReader() = default;
 // -----------------------------------------------------------------------------
 H5DataArrayReader::~H5DataArrayReader() = default;
 
+namespace
+{
+thread_local bool s_ThreadLoadOnDemand = false;
+thread_local QString s_ThreadReadError;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DataArrayReader::GetThreadLoadOnDemand()
+{
+  return s_ThreadLoadOnDemand;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DataArrayReader::SetThreadLoadOnDemand(bool value)
+{
+  s_ThreadLoadOnDemand = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString H5DataArrayReader::GetThreadReadError()
+{
+  return s_ThreadReadError;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ScopedLoadOnDemand::H5ScopedLoadOnDemand(bool value)
+: m_Previous(H5DataArrayReader::GetThreadLoadOnDemand())
+{
+  H5DataArrayReader::SetThreadLoadOnDemand(value);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ScopedLoadOnDemand::~H5ScopedLoadOnDemand()
+{
+  H5DataArrayReader::SetThreadLoadOnDemand(m_Previous);
+}
+
 namespace Detail
 {
+// -----------------------------------------------------------------------------
+// Chunked datasets are decoded by HDF5 during the read. This is only called once a read
+// failed, to tell the user which of the filters the dataset was written with are not
+// available in this HDF5 library. Returns an empty string if they all are.
+// -----------------------------------------------------------------------------
+QString findMissingFilters(hid_t locId, const QString& datasetPath)
+{
+  QStringList missing;
+  hid_t datasetId = H5Dopen(locId, datasetPath.toLatin1().constData(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return QString();
+  }
+  hid_t dcpl = H5Dget_create_plist(datasetId);
+  int numFilters = H5Pget_nfilters(dcpl);
+  for(int i = 0; i < numFilters; i++)
+  {
+    unsigned int flags = 0;
+    size_t numValues = 0;
+    unsigned int filterConfig = 0;
+    char filterName[256] = {0};
+    H5Z_filter_t filterId = H5Pget_filter2(dcpl, static_cast<unsigned>(i), &flags, &numValues, nullptr, sizeof(filterName), filterName, &filterConfig);
+    if(filterId < 0 || H5Zfilter_avail(filterId) <= 0)
+    {
+      missing.push_back(QString("%1 (%2)").arg(filterId).arg(filterName));
+    }
+  }
+  H5Pclose(dcpl);
+  H5Dclose(datasetId);
+  return missing.join(", ");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -71,13 +153,40 @@ IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const
   herr_t err = -1;
   IDataArray::Pointer ptr;
 
-  ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath, true);
+  if(H5DataArrayReader::GetThreadLoadOnDemand())
+  {
+    // Only remember where the values are. They are read the first time the array is accessed.
+    H5DeferredDataSource::Pointer source = H5DeferredDataSource::New(locId, datasetPath);
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(tDims, cDims, datasetPath, false);
+    if(nullptr != source && nullptr != array && source->getElementSize() == sizeof(T) && source->getNumberOfElements() == array->getSize() && array->setDeferredSource(source))
+    {
+      ptr = array;
+      return ptr;
+    }
+  }
+
+  // The dataset overwrites every element so skip initializing the memory
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(tDims, cDims, datasetPath, false);
+  if(nullptr == array || array->allocateUninitialized() < 0)
+  {
+    s_ThreadReadError = QObject::tr("Unable to allocate the DataArray for the dataset '%1'").arg(datasetPath);
+    return ptr;
+  }
+  ptr = array;
 
-  T* data = (T*)(ptr->getVoidPointer(0));
+  T* data = array->data();
   err = QH5Lite::readPointerDataset(locId, datasetPath, data);
   if(err < 0)
   {
-    qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
+    const QString missingFilters = findMissingFilters(locId, datasetPath);
+    if(missingFilters.isEmpty())
+    {
+      s_ThreadReadError = QObject::tr("Unable to read the dataset '%1' (HDF5 error %2)").arg(datasetPath).arg(err);
+    }
+    else
+    {
+      s_ThreadReadError = QObject::tr("The dataset '%1' was written with the HDF5 filter(s) %2, which this HDF5 library does not provide").arg(datasetPath, missingFilters);
+    }
     ptr = IDataArray::NullPointer();
   }
   return ptr;
@@ -201,6 +310,7 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
 // -----------------------------------------------------------------------------
 IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly)
 {
+  s_ThreadReadError.clear();
 
   herr_t err = -1;
   // herr_t retErr = 1;
@@ -436,6 +546,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       if((H5Tequal(typeId, H5T_STD_U8BE) != 0) || (H5Tequal(typeId, H5T_STD_U8LE) != 0))
       {
         NeighborList<uint8_t>::Pointer ptr = NeighborList<uint8_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -445,6 +556,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_U16BE) != 0) || (H5Tequal(typeId, H5T_STD_U16LE) != 0))
       {
         NeighborList<uint16_t>::Pointer ptr = NeighborList<uint16_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -454,6 +566,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_U32BE) != 0) || (H5Tequal(typeId, H5T_STD_U32LE) != 0))
       {
         NeighborList<uint32_t>::Pointer ptr = NeighborList<uint32_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -463,6 +576,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_U64BE) != 0) || (H5Tequal(typeId, H5T_STD_U64LE) != 0))
       {
         NeighborList<uint64_t>::Pointer ptr = NeighborList<uint64_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -472,6 +586,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_I8BE) != 0) || (H5Tequal(typeId, H5T_STD_I8LE) != 0))
       {
         NeighborList<int8_t>::Pointer ptr = NeighborList<int8_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -481,6 +596,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_I16BE) != 0) || (H5Tequal(typeId, H5T_STD_I16LE) != 0))
       {
         NeighborList<int16_t>::Pointer ptr = NeighborList<int16_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -490,6 +606,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_I32BE) != 0) || (H5Tequal(typeId, H5T_STD_I32LE) != 0))
       {
         NeighborList<int32_t>::Pointer ptr = NeighborList<int32_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -499,6 +616,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if((H5Tequal(typeId, H5T_STD_I64BE) != 0) || (H5Tequal(typeId, H5T_STD_I64LE) != 0))
       {
         NeighborList<int64_t>::Pointer ptr = NeighborList<int64_t>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -515,6 +633,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       if(attr_size == 4)
       {
         NeighborList<float>::Pointer ptr = NeighborList<float>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -524,6 +643,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
       else if(attr_size == 8)
       {
         NeighborList<double>::Pointer ptr = NeighborList<double>::CreateArray(tDims, cDims, name, false);
+        ptr->setUseFlatStorage(true);
         if(!metaDataOnly)
         {
           ptr->readH5Data(gid);
@@ -78,7 +78,7 @@ public:
   static IDataArrayShPtrType ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
   /**
-   * @brief ReadNeighborListData
+   * @brief ReadNeighborListData Reads the lists into flat storage, which is the layout of the file
    * @param gid The HDF5 Group to read the data array from
    * @param name The name of the data set
    * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
@@ -95,6 +95,27 @@ public:
    */
   static IDataArrayShPtrType ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief Returns true if DataArray<T> objects read by the calling thread only record where their values
+   * are stored and read them from the file the first time they are accessed.
+   * @return
+   */
+  static bool GetThreadLoadOnDemand();
+
+  /**
+   * @brief Sets whether DataArray<T> objects read by the calling thread are loaded on demand. Prefer the
+   * H5ScopedLoadOnDemand class so the previous value is restored.
+   * @param value
+   */
+  static void SetThreadLoadOnDemand(bool value);
+
+  /**
+   * @brief Returns why the last DataArray<T> values read by the calling thread could not be read, such as an HDF5
+   * filter the dataset was compressed with that is not available, or an empty string if the read succeeded.
+   * @return
+   */
+  static QString GetThreadReadError();
+
 protected:
   H5DataArrayReader();
 
@@ -104,3 +125,22 @@ public:
   H5DataArrayReader& operator=(const H5DataArrayReader&) = delete; // Copy Assignment Not Implemented
   H5DataArrayReader& operator=(H5DataArrayReader&&) = delete;      // Move Assignment Not Implemented
 };
+
+/**
+ * @brief The H5ScopedLoadOnDemand class turns loading on demand on or off for the calling thread and
+ * restores the previous setting when it goes out of scope.
+ */
+class SIMPLib_EXPORT H5ScopedLoadOnDemand
+{
+public:
+  explicit H5ScopedLoadOnDemand(bool value);
+  ~H5ScopedLoadOnDemand();
+
+  H5ScopedLoadOnDemand(const H5ScopedLoadOnDemand&) = delete;            // Copy Constructor Not Implemented
+  H5ScopedLoadOnDemand(H5ScopedLoadOnDemand&&) = delete;                 // Move Constructor Not Implemented
+  H5ScopedLoadOnDemand& operator=(const H5ScopedLoadOnDemand&) = delete; // Copy Assignment Not Implemented
+  H5ScopedLoadOnDemand& operator=(H5ScopedLoadOnDemand&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  bool m_Previous = false;
+};
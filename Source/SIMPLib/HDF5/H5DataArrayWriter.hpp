@@ -35,6 +35,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 #include <hdf5.h>
 
 #include <QtCore/QString>
@@ -45,6 +49,7 @@ using namespace H5Support;
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/HDF5/H5StorageOptions.h"
 //#include "SIMPLib/DataArrays/DataArray.hpp"
 
 /**
@@ -123,6 +128,20 @@ public:
    */
   template <class T>
   static int writeDataArray(hid_t gid, const T* dataArray, const std::vector<size_t>& tDims)
+  {
+    return writeDataArray<T>(gid, dataArray, tDims, dataArray->getH5StorageOptions().resolve());
+  }
+
+  /**
+   * @brief writeDataArray
+   * @param gid
+   * @param dataArray
+   * @param tDims
+   * @param options The storage layout (contiguous or chunked + compressed) to use for the dataset
+   * @return
+   */
+  template <class T>
+  static int writeDataArray(hid_t gid, const T* dataArray, const std::vector<size_t>& tDims, const H5StorageOptions& options)
   {
     int err = 0;
 
@@ -169,7 +188,24 @@ public:
       h5Dims[i + tDims.size()] = cDims[i];
     }
 #endif
-    if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
+    if(options.isChunked() && dataArray->getSize() > 0)
+    {
+      // Every component of a tuple lives in the same chunk, the tuple dimensions of the chunk are
+      // reversed into HDF5 (ZYX) order exactly like the dataset dimensions above.
+      std::vector<size_t> chunkTupleDims = options.computeChunkTupleDims(tDims, dataArray->getTypeSize() * static_cast<size_t>(dataArray->getNumberOfComponents()));
+      QVector<hsize_t> h5ChunkDims(h5Dims);
+      count = tDims.size() - 1;
+      for(int i = count; i >= 0; i--)
+      {
+        h5ChunkDims[count - i] = chunkTupleDims[i];
+      }
+      err = writeChunkedDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), h5ChunkDims.data(), options, dataArray->getPointer(0));
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+    else if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
     {
       err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
       if(err < 0)
@@ -217,6 +253,180 @@ public:
     return err;
   }
 
+  /**
+   * @brief hasSameLayout Returns true if an existing dataset has the given type and dimensions and
+   * was created with the same chunk dimensions and filters as the creation property list, so that
+   * writing to it produces the same dataset as creating it again.
+   * @param datasetId The existing dataset
+   * @param dataType The HDF5 type of the data to write
+   * @param rank The rank of the data to write
+   * @param dims The dimensions of the data to write in HDF5 (slowest to fastest) order
+   * @param dcpl The creation property list a new dataset would be created with
+   * @return
+   */
+  static bool hasSameLayout(hid_t datasetId, hid_t dataType, hsize_t rank, const hsize_t* dims, hid_t dcpl)
+  {
+    hid_t typeId = H5Dget_type(datasetId);
+    bool same = typeId >= 0 && H5Tequal(typeId, dataType) > 0;
+    if(typeId >= 0)
+    {
+      H5Tclose(typeId);
+    }
+
+    hid_t dataspaceId = H5Dget_space(datasetId);
+    if(same && dataspaceId >= 0 && H5Sget_simple_extent_ndims(dataspaceId) == static_cast<int>(rank))
+    {
+      std::vector<hsize_t> existingDims(rank, 0);
+      H5Sget_simple_extent_dims(dataspaceId, existingDims.data(), nullptr);
+      same = std::equal(existingDims.begin(), existingDims.end(), dims);
+    }
+    else
+    {
+      same = false;
+    }
+    if(dataspaceId >= 0)
+    {
+      H5Sclose(dataspaceId);
+    }
+
+    hid_t existingDcpl = H5Dget_create_plist(datasetId);
+    if(same && existingDcpl >= 0 && H5Pget_layout(existingDcpl) == H5D_CHUNKED)
+    {
+      std::vector<hsize_t> existingChunks(rank, 0);
+      std::vector<hsize_t> chunks(rank, 0);
+      same = H5Pget_chunk(existingDcpl, static_cast<int>(rank), existingChunks.data()) == static_cast<int>(rank) && H5Pget_chunk(dcpl, static_cast<int>(rank), chunks.data()) == static_cast<int>(rank) &&
+             existingChunks == chunks;
+
+      const int numFilters = H5Pget_nfilters(dcpl);
+      same = same && numFilters == H5Pget_nfilters(existingDcpl);
+      for(int i = 0; same && i < numFilters; i++)
+      {
+        unsigned int flags[2] = {0, 0};
+        std::array<unsigned int, 16> values[2] = {};
+        size_t numValues[2] = {values[0].size(), values[1].size()};
+        H5Z_filter_t filterIds[2] = {H5Pget_filter2(dcpl, static_cast<unsigned>(i), &flags[0], &numValues[0], values[0].data(), 0, nullptr, nullptr),
+                                     H5Pget_filter2(existingDcpl, static_cast<unsigned>(i), &flags[1], &numValues[1], values[1].data(), 0, nullptr, nullptr)};
+        same = filterIds[0] >= 0 && filterIds[0] == filterIds[1] && numValues[0] == numValues[1] &&
+               std::equal(values[0].begin(), values[0].begin() + std::min(numValues[0], values[0].size()), values[1].begin());
+      }
+    }
+    else
+    {
+      same = false;
+    }
+    if(existingDcpl >= 0)
+    {
+      H5Pclose(existingDcpl);
+    }
+    return same;
+  }
+
+  /**
+   * @brief writeChunkedDataset Writes a chunked dataset applying the shuffle/deflate filters and any
+   * additional filters that are part of the storage options. An existing dataset with the same name,
+   * type, dimensions, chunk dimensions and filters is overwritten in place; any other existing dataset
+   * is replaced.
+   * @param gid The HDF5 group to write the dataset into
+   * @param name The name of the dataset
+   * @param rank The rank of the dataset
+   * @param dims The dimensions of the dataset in HDF5 (slowest to fastest) order
+   * @param chunkDims The dimensions of each chunk in HDF5 (slowest to fastest) order
+   * @param options The storage options
+   * @param data The data to write
+   * @return Negative value on error
+   */
+  template <typename T>
+  static int writeChunkedDataset(hid_t gid, const QString& name, hsize_t rank, const hsize_t* dims, const hsize_t* chunkDims, const H5StorageOptions& options, const T* data)
+  {
+    hid_t dataType = H5Lite::HDFTypeForPrimitive<T>();
+    if(dataType == -1)
+    {
+      return -612;
+    }
+
+    hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    if(dcpl < 0)
+    {
+      return -614;
+    }
+    herr_t err = H5Pset_chunk(dcpl, static_cast<int>(rank), chunkDims);
+    if(err >= 0 && options.getShuffle())
+    {
+      err = H5Pset_shuffle(dcpl);
+    }
+    if(err >= 0 && options.getDeflateLevel() > 0)
+    {
+      if(H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0)
+      {
+        H5Pclose(dcpl);
+        return -615;
+      }
+      err = H5Pset_deflate(dcpl, static_cast<unsigned>(options.getDeflateLevel()));
+    }
+    for(const auto& filter : options.getFilters())
+    {
+      if(err < 0)
+      {
+        break;
+      }
+      // Only filters that are registered with the HDF5 library that is writing the file can be used
+      if(H5Zfilter_avail(static_cast<H5Z_filter_t>(filter.FilterId)) <= 0)
+      {
+        H5Pclose(dcpl);
+        return -616;
+      }
+      err = H5Pset_filter(dcpl, static_cast<H5Z_filter_t>(filter.FilterId), filter.Flags, filter.Values.size(), filter.Values.data());
+    }
+    if(err < 0)
+    {
+      H5Pclose(dcpl);
+      return -617;
+    }
+
+    if(QH5Lite::datasetExists(gid, name))
+    {
+      // Unlinking a dataset does not give its space in the file back, so a dataset that is written
+      // again with the same layout keeps its storage
+      hid_t existingId = H5Dopen(gid, name.toLatin1().constData(), H5P_DEFAULT);
+      if(existingId >= 0 && hasSameLayout(existingId, dataType, rank, dims, dcpl))
+      {
+        err = H5Dwrite(existingId, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        H5Dclose(existingId);
+        H5Pclose(dcpl);
+        return (err < 0) ? -620 : 0;
+      }
+      if(existingId >= 0)
+      {
+        H5Dclose(existingId);
+      }
+      if(H5Ldelete(gid, name.toLatin1().constData(), H5P_DEFAULT) < 0)
+      {
+        H5Pclose(dcpl);
+        return -613;
+      }
+    }
+
+    hid_t dataspaceId = H5Screate_simple(static_cast<int>(rank), dims, nullptr);
+    if(dataspaceId < 0)
+    {
+      H5Pclose(dcpl);
+      return -618;
+    }
+    hid_t datasetId = H5Dcreate(gid, name.toLatin1().constData(), dataType, dataspaceId, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if(datasetId < 0)
+    {
+      H5Sclose(dataspaceId);
+      H5Pclose(dcpl);
+      return -619;
+    }
+    err = H5Dwrite(datasetId, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+
+    H5Dclose(datasetId);
+    H5Sclose(dataspaceId);
+    H5Pclose(dcpl);
+    return (err < 0) ? -620 : 0;
+  }
+
 protected:
   H5DataArrayWriter() = default;
 
@@ -0,0 +1,364 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5DeferredDataSource.h"
+
+#include <cstring>
+#include <mutex>
+#include <set>
+
+#include <QtCore/QDebug>
+#include <QtCore/QFileInfo>
+
+namespace
+{
+// The HDF5 library is usually built without its thread safe option so every read from a deferred source is serialized
+std::mutex s_H5Mutex;
+
+std::mutex s_RegistryMutex;
+std::set<H5DeferredDataSource*> s_Sources;
+
+// -----------------------------------------------------------------------------
+QString CanonicalFilePath(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  QString canonical = fi.canonicalFilePath();
+  return canonical.isEmpty() ? fi.absoluteFilePath() : canonical;
+}
+
+// -----------------------------------------------------------------------------
+// Selects the elements [begin, end) of the block below the coordinates in 'offset' (levels 0 to level - 1 already set).
+// A range is split into a partial leading row, a run of whole rows that is one hyperslab and a partial trailing row.
+// The partial rows are handled one level down so at most two hyperslabs are added per level.
+// -----------------------------------------------------------------------------
+bool SelectBlockRange(hid_t spaceId, const std::vector<hsize_t>& dims, const std::vector<hsize_t>& strides, size_t level, std::vector<hsize_t>& offset, hsize_t begin, hsize_t end, bool& first)
+{
+  if(begin >= end)
+  {
+    return true;
+  }
+  const size_t rank = dims.size();
+  const hsize_t stride = strides[level];
+  const hsize_t firstFull = (begin + stride - 1) / stride;
+  const hsize_t endFull = end / stride;
+
+  if(firstFull > endFull)
+  {
+    // The range lies inside a single row
+    const hsize_t row = begin / stride;
+    offset[level] = row;
+    return SelectBlockRange(spaceId, dims, strides, level + 1, offset, begin - row * stride, end - row * stride, first);
+  }
+
+  if(begin < firstFull * stride)
+  {
+    offset[level] = firstFull - 1;
+    if(!SelectBlockRange(spaceId, dims, strides, level + 1, offset, begin - (firstFull - 1) * stride, stride, first))
+    {
+      return false;
+    }
+  }
+
+  if(endFull > firstFull)
+  {
+    std::vector<hsize_t> start(offset.begin(), offset.end());
+    std::vector<hsize_t> count(rank, 1);
+    start[level] = firstFull;
+    count[level] = endFull - firstFull;
+    for(size_t i = level + 1; i < rank; i++)
+    {
+      start[i] = 0;
+      count[i] = dims[i];
+    }
+    herr_t err = H5Sselect_hyperslab(spaceId, first ? H5S_SELECT_SET : H5S_SELECT_OR, start.data(), nullptr, count.data(), nullptr);
+    first = false;
+    if(err < 0)
+    {
+      return false;
+    }
+  }
+
+  if(end > endFull * stride)
+  {
+    offset[level] = endFull;
+    return SelectBlockRange(spaceId, dims, strides, level + 1, offset, 0, end - endFull * stride, first);
+  }
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+H5DeferredDataSource::H5DeferredDataSource(const QString& filePath, const QString& datasetPath, const std::vector<hsize_t>& dims, size_t elementSize)
+: m_FilePath(filePath)
+, m_DatasetPath(datasetPath)
+, m_Dims(dims)
+, m_ElementSize(elementSize)
+{
+  m_NumElements = 1;
+  for(const auto& dim : m_Dims)
+  {
+    m_NumElements *= static_cast<size_t>(dim);
+  }
+
+  std::lock_guard<std::mutex> lock(s_RegistryMutex);
+  s_Sources.insert(this);
+}
+
+// -----------------------------------------------------------------------------
+H5DeferredDataSource::~H5DeferredDataSource()
+{
+  std::lock_guard<std::mutex> lock(s_RegistryMutex);
+  s_Sources.erase(this);
+}
+
+// -----------------------------------------------------------------------------
+H5DeferredDataSource::Pointer H5DeferredDataSource::New(hid_t locId, const QString& name)
+{
+  ssize_t fileNameLength = H5Fget_name(locId, nullptr, 0);
+  ssize_t locNameLength = H5Iget_name(locId, nullptr, 0);
+  if(fileNameLength <= 0 || locNameLength <= 0)
+  {
+    return nullptr;
+  }
+  std::vector<char> fileName(static_cast<size_t>(fileNameLength) + 1, 0);
+  std::vector<char> locName(static_cast<size_t>(locNameLength) + 1, 0);
+  H5Fget_name(locId, fileName.data(), fileName.size());
+  H5Iget_name(locId, locName.data(), locName.size());
+
+  QString datasetPath = QString::fromLatin1(locName.data());
+  if(!datasetPath.endsWith('/'))
+  {
+    datasetPath.append('/');
+  }
+  datasetPath.append(name);
+
+  hid_t datasetId = H5Dopen(locId, name.toLatin1().constData(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return nullptr;
+  }
+  hid_t spaceId = H5Dget_space(datasetId);
+  hid_t fileTypeId = H5Dget_type(datasetId);
+  hid_t memTypeId = (fileTypeId < 0) ? -1 : H5Tget_native_type(fileTypeId, H5T_DIR_ASCEND);
+
+  Pointer sharedPtr;
+  int rank = (spaceId < 0) ? -1 : H5Sget_simple_extent_ndims(spaceId);
+  if(rank >= 0 && memTypeId >= 0)
+  {
+    std::vector<hsize_t> dims(static_cast<size_t>(rank), 0);
+    H5Sget_simple_extent_dims(spaceId, dims.data(), nullptr);
+    if(dims.empty())
+    {
+      // A scalar dataspace holds a single value
+      dims.push_back(1);
+    }
+    sharedPtr = Pointer(new H5DeferredDataSource(CanonicalFilePath(QString::fromLocal8Bit(fileName.data())), datasetPath, dims, H5Tget_size(memTypeId)));
+  }
+
+  if(memTypeId >= 0)
+  {
+    H5Tclose(memTypeId);
+  }
+  if(fileTypeId >= 0)
+  {
+    H5Tclose(fileTypeId);
+  }
+  if(spaceId >= 0)
+  {
+    H5Sclose(spaceId);
+  }
+  H5Dclose(datasetId);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+bool H5DeferredDataSource::SelectElementRange(hid_t spaceId, const std::vector<hsize_t>& dims, hsize_t startElement, hsize_t numElements)
+{
+  if(numElements == 0)
+  {
+    return H5Sselect_none(spaceId) >= 0;
+  }
+  if(dims.empty())
+  {
+    return startElement == 0 && numElements == 1 && H5Sselect_all(spaceId) >= 0;
+  }
+
+  std::vector<hsize_t> strides(dims.size(), 1);
+  for(size_t i = dims.size() - 1; i > 0; i--)
+  {
+    strides[i - 1] = strides[i] * dims[i];
+  }
+  if(startElement + numElements > strides[0] * dims[0])
+  {
+    return false;
+  }
+
+  std::vector<hsize_t> offset(dims.size(), 0);
+  bool first = true;
+  return SelectBlockRange(spaceId, dims, strides, 0, offset, startElement, startElement + numElements, first);
+}
+
+// -----------------------------------------------------------------------------
+bool H5DeferredDataSource::readElements(void* buffer, size_t startElement, size_t numElements) const
+{
+  if(startElement + numElements > m_NumElements)
+  {
+    return false;
+  }
+  if(numElements == 0)
+  {
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lock(s_H5Mutex);
+  if(m_Detached)
+  {
+    ::memcpy(buffer, m_DetachedValues.data() + startElement * m_ElementSize, numElements * m_ElementSize);
+    return true;
+  }
+  return readFromFile(buffer, startElement, numElements);
+}
+
+// -----------------------------------------------------------------------------
+bool H5DeferredDataSource::readFromFile(void* buffer, size_t startElement, size_t numElements) const
+{
+  hid_t fileId = H5Fopen(m_FilePath.toLocal8Bit().constData(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if(fileId < 0)
+  {
+    qDebug() << "Unable to open " << m_FilePath << " to read " << m_DatasetPath;
+    return false;
+  }
+  hid_t datasetId = H5Dopen(fileId, m_DatasetPath.toLatin1().constData(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    H5Fclose(fileId);
+    qDebug() << "Unable to open dataset " << m_DatasetPath << " in " << m_FilePath;
+    return false;
+  }
+
+  herr_t err = -1;
+  hid_t fileTypeId = H5Dget_type(datasetId);
+  hid_t memTypeId = H5Tget_native_type(fileTypeId, H5T_DIR_ASCEND);
+  if(startElement == 0 && numElements == m_NumElements)
+  {
+    err = H5Dread(datasetId, memTypeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer);
+  }
+  else
+  {
+    hid_t fileSpaceId = H5Dget_space(datasetId);
+    hsize_t memDims = numElements;
+    hid_t memSpaceId = H5Screate_simple(1, &memDims, nullptr);
+    if(SelectElementRange(fileSpaceId, m_Dims, startElement, numElements))
+    {
+      err = H5Dread(datasetId, memTypeId, memSpaceId, fileSpaceId, H5P_DEFAULT, buffer);
+    }
+    H5Sclose(memSpaceId);
+    H5Sclose(fileSpaceId);
+  }
+  H5Tclose(memTypeId);
+  H5Tclose(fileTypeId);
+  H5Dclose(datasetId);
+  H5Fclose(fileId);
+  return err >= 0;
+}
+
+// -----------------------------------------------------------------------------
+bool H5DeferredDataSource::DetachFromFile(const QString& filePath)
+{
+  const QString canonicalPath = CanonicalFilePath(filePath);
+  bool success = true;
+
+  // The registry lock is held for the whole loop so no source can be destroyed while it is detached
+  std::lock_guard<std::mutex> registryLock(s_RegistryMutex);
+  for(H5DeferredDataSource* source : s_Sources)
+  {
+    if(source->m_FilePath != canonicalPath)
+    {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(s_H5Mutex);
+    if(source->m_Detached)
+    {
+      continue;
+    }
+    std::vector<uint8_t> values(source->m_NumElements * source->m_ElementSize);
+    if(source->readFromFile(values.data(), 0, source->m_NumElements))
+    {
+      source->m_DetachedValues.swap(values);
+      source->m_Detached = true;
+    }
+    else
+    {
+      success = false;
+    }
+  }
+  return success;
+}
+
+// -----------------------------------------------------------------------------
+QString H5DeferredDataSource::getDescription() const
+{
+  return QString("%1:%2").arg(m_FilePath, m_DatasetPath);
+}
+
+// -----------------------------------------------------------------------------
+QString H5DeferredDataSource::getFilePath() const
+{
+  return m_FilePath;
+}
+
+// -----------------------------------------------------------------------------
+QString H5DeferredDataSource::getDatasetPath() const
+{
+  return m_DatasetPath;
+}
+
+// -----------------------------------------------------------------------------
+size_t H5DeferredDataSource::getElementSize() const
+{
+  return m_ElementSize;
+}
+
+// -----------------------------------------------------------------------------
+size_t H5DeferredDataSource::getNumberOfElements() const
+{
+  return m_NumElements;
+}
+
+// -----------------------------------------------------------------------------
+bool H5DeferredDataSource::isDetached() const
+{
+  std::lock_guard<std::mutex> lock(s_H5Mutex);
+  return m_Detached;
+}
@@ -0,0 +1,166 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DeferredDataSource.h"
+
+/**
+ * @brief The H5DeferredDataSource class supplies the values of a DataArray from a dataset in an HDF5 file.
+ * Only the file path, the path of the dataset inside the file and its dimensions are recorded when the
+ * source is created. Each read opens the file read only, reads the requested elements (a hyperslab when
+ * only part of the dataset is needed) and closes the file again, so no HDF5 handles are held between reads.
+ *
+ * All reads go through one lock because the HDF5 library is usually built without thread safety.
+ *
+ * A pipeline may write to the file the values are coming from. DetachFromFile() must be called before a
+ * file is rewritten: every source that still points into that file reads its dataset into memory first.
+ */
+class SIMPLib_EXPORT H5DeferredDataSource : public DeferredDataSource
+{
+public:
+  using Self = H5DeferredDataSource;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+
+  /**
+   * @brief Creates a source for the dataset name below the HDF5 object locId
+   * @param locId An open HDF5 group or file
+   * @param name Name of the dataset
+   * @return The source or nullptr if the dataset could not be opened or needs an unavailable HDF5 filter
+   */
+  static Pointer New(hid_t locId, const QString& name);
+
+  ~H5DeferredDataSource() override;
+
+  H5DeferredDataSource(const H5DeferredDataSource&) = delete;            // Copy Constructor Not Implemented
+  H5DeferredDataSource(H5DeferredDataSource&&) = delete;                 // Move Constructor Not Implemented
+  H5DeferredDataSource& operator=(const H5DeferredDataSource&) = delete; // Copy Assignment Not Implemented
+  H5DeferredDataSource& operator=(H5DeferredDataSource&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Reads numElements values, starting at element startElement, into buffer
+   * @param buffer
+   * @param startElement
+   * @param numElements
+   * @return
+   */
+  bool readElements(void* buffer, size_t startElement, size_t numElements) const override;
+
+  /**
+   * @brief Returns the file and dataset path
+   * @return
+   */
+  QString getDescription() const override;
+
+  /**
+   * @brief Returns the absolute path of the HDF5 file
+   * @return
+   */
+  QString getFilePath() const;
+
+  /**
+   * @brief Returns the path of the dataset inside the HDF5 file
+   * @return
+   */
+  QString getDatasetPath() const;
+
+  /**
+   * @brief Returns the size in bytes of a single value of the dataset
+   * @return
+   */
+  size_t getElementSize() const;
+
+  /**
+   * @brief Returns the total number of values in the dataset
+   * @return
+   */
+  size_t getNumberOfElements() const;
+
+  /**
+   * @brief Returns true if the values have been copied into memory and the file is no longer read
+   * @return
+   */
+  bool isDetached() const;
+
+  /**
+   * @brief Makes every source that reads from filePath read its whole dataset into memory so the file can
+   * be overwritten or removed. Sources of other files are not touched.
+   * @param filePath
+   * @return False if a source could not read its dataset
+   */
+  static bool DetachFromFile(const QString& filePath);
+
+  /**
+   * @brief Adds the elements [startElement, startElement + numElements) of a dataset with the given
+   * dimensions to the selection of spaceId. The elements are counted in the row major order HDF5 stores
+   * them in, which is the element order of a DataArray. At most 2 * rank - 1 hyperslabs are needed.
+   * @param spaceId
+   * @param dims
+   * @param startElement
+   * @param numElements
+   * @return False if HDF5 rejected the selection
+   */
+  static bool SelectElementRange(hid_t spaceId, const std::vector<hsize_t>& dims, hsize_t startElement, hsize_t numElements);
+
+protected:
+  H5DeferredDataSource(const QString& filePath, const QString& datasetPath, const std::vector<hsize_t>& dims, size_t elementSize);
+
+private:
+  QString m_FilePath;
+  QString m_DatasetPath;
+  std::vector<hsize_t> m_Dims;
+  size_t m_ElementSize = 0;
+  size_t m_NumElements = 0;
+  bool m_Detached = false;
+  std::vector<uint8_t> m_DetachedValues;
+
+  /**
+   * @brief Reads the values from the file. The caller must hold the read lock.
+   * @param buffer
+   * @param startElement
+   * @param numElements
+   * @return
+   */
+  bool readFromFile(void* buffer, size_t startElement, size_t numElements) const;
+};
@@ -0,0 +1,216 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5StorageOptions.h"
+
+#include <algorithm>
+
+namespace
+{
+// Each thread that writes a .dream3d file gets its own default so that concurrent pipelines
+// (e.g. in the REST server) do not see each other's DataContainerWriter settings.
+thread_local H5StorageOptions s_ThreadDefault = H5StorageOptions::Contiguous();
+} // namespace
+
+// -----------------------------------------------------------------------------
+H5StorageOptions H5StorageOptions::Contiguous()
+{
+  H5StorageOptions options;
+  options.setLayout(Layout::Contiguous);
+  return options;
+}
+
+// -----------------------------------------------------------------------------
+H5StorageOptions H5StorageOptions::Chunked(int32_t deflateLevel, bool shuffle)
+{
+  H5StorageOptions options;
+  options.setLayout(Layout::Chunked);
+  options.setDeflateLevel(deflateLevel);
+  options.setShuffle(shuffle);
+  return options;
+}
+
+// -----------------------------------------------------------------------------
+H5StorageOptions H5StorageOptions::GetThreadDefault()
+{
+  return s_ThreadDefault;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::SetThreadDefault(const H5StorageOptions& options)
+{
+  s_ThreadDefault = options;
+  if(s_ThreadDefault.getLayout() == Layout::Default)
+  {
+    s_ThreadDefault.setLayout(Layout::Contiguous);
+  }
+}
+
+// -----------------------------------------------------------------------------
+H5StorageOptions H5StorageOptions::resolve() const
+{
+  if(m_Layout == Layout::Default)
+  {
+    return GetThreadDefault();
+  }
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+bool H5StorageOptions::isChunked() const
+{
+  return m_Layout == Layout::Chunked;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> H5StorageOptions::computeChunkTupleDims(const std::vector<size_t>& tDims, size_t bytesPerTuple) const
+{
+  std::vector<size_t> chunkDims(tDims.size(), 1);
+
+  // The user has asked for a specific chunk shape. Just clamp it to the array
+  if(m_ChunkTupleDims.size() == tDims.size())
+  {
+    for(size_t i = 0; i < tDims.size(); i++)
+    {
+      chunkDims[i] = std::max(static_cast<size_t>(1), std::min(m_ChunkTupleDims[i], tDims[i]));
+    }
+    return chunkDims;
+  }
+
+  // Pack whole rows, then whole slices (X is the fastest moving dimension) into a chunk until the
+  // target size is reached. The first dimension that does not fit completely is split so that
+  // the chunk is as close to the target size as possible.
+  size_t tuplesPerChunk = std::max(static_cast<size_t>(1), m_TargetChunkBytes / std::max(static_cast<size_t>(1), bytesPerTuple));
+  size_t chunkTuples = 1;
+  for(size_t i = 0; i < tDims.size(); i++)
+  {
+    size_t dim = std::max(static_cast<size_t>(1), tDims[i]);
+    if(chunkTuples * dim <= tuplesPerChunk)
+    {
+      chunkDims[i] = dim;
+      chunkTuples *= dim;
+    }
+    else
+    {
+      chunkDims[i] = std::max(static_cast<size_t>(1), tuplesPerChunk / chunkTuples);
+      break;
+    }
+  }
+  return chunkDims;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::setLayout(Layout value)
+{
+  m_Layout = value;
+}
+
+// -----------------------------------------------------------------------------
+H5StorageOptions::Layout H5StorageOptions::getLayout() const
+{
+  return m_Layout;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::setChunkTupleDims(const std::vector<size_t>& value)
+{
+  m_ChunkTupleDims = value;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<size_t> H5StorageOptions::getChunkTupleDims() const
+{
+  return m_ChunkTupleDims;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::setTargetChunkBytes(size_t value)
+{
+  m_TargetChunkBytes = value;
+}
+
+// -----------------------------------------------------------------------------
+size_t H5StorageOptions::getTargetChunkBytes() const
+{
+  return m_TargetChunkBytes;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::setDeflateLevel(int32_t value)
+{
+  m_DeflateLevel = std::clamp(value, 0, 9);
+}
+
+// -----------------------------------------------------------------------------
+int32_t H5StorageOptions::getDeflateLevel() const
+{
+  return m_DeflateLevel;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::setShuffle(bool value)
+{
+  m_Shuffle = value;
+}
+
+// -----------------------------------------------------------------------------
+bool H5StorageOptions::getShuffle() const
+{
+  return m_Shuffle;
+}
+
+// -----------------------------------------------------------------------------
+void H5StorageOptions::addFilter(const FilterSpec& filter)
+{
+  m_Filters.push_back(filter);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<H5StorageOptions::FilterSpec> H5StorageOptions::getFilters() const
+{
+  return m_Filters;
+}
+
+// -----------------------------------------------------------------------------
+H5ScopedStorageOptions::H5ScopedStorageOptions(const H5StorageOptions& options)
+: m_Previous(H5StorageOptions::GetThreadDefault())
+{
+  H5StorageOptions::SetThreadDefault(options);
+}
+
+// -----------------------------------------------------------------------------
+H5ScopedStorageOptions::~H5ScopedStorageOptions()
+{
+  H5StorageOptions::SetThreadDefault(m_Previous);
+}
@@ -0,0 +1,225 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The H5StorageOptions class describes how a DataArray is laid out when it is written
+ * into an HDF5 file. The default layout is a single contiguous, uncompressed dataset which
+ * is what DREAM.3D has always written. A chunked layout allows compression filters (deflate,
+ * shuffle or any other filter registered with the local HDF5 library) to be applied.
+ *
+ * The chunk shape is always aligned to tuple boundaries: every component of a tuple is kept
+ * in the same chunk and, unless the user asks for a specific chunk shape, whole rows/slices
+ * of the tuple dimensions are packed into each chunk until the target chunk size is reached.
+ *
+ * Reading a chunked dataset needs no special handling as HDF5 will apply the filters
+ * transparently as long as they are available in the library that reads the file.
+ */
+class SIMPLib_EXPORT H5StorageOptions
+{
+public:
+  enum class Layout : int32_t
+  {
+    Default = -1,   //!< Use whatever the enclosing writer has set as the default
+    Contiguous = 0, //!< Single contiguous, uncompressed dataset
+    Chunked = 1     //!< Chunked dataset with optional compression filters
+  };
+
+  /**
+   * @brief The FilterSpec struct describes an additional HDF5 filter (e.g. a registered
+   * third party compressor) that should be appended to the filter pipeline of a chunked dataset.
+   */
+  struct FilterSpec
+  {
+    int32_t FilterId = 0;
+    uint32_t Flags = 0;
+    std::vector<uint32_t> Values;
+  };
+
+  static constexpr size_t k_DefaultChunkBytes = 1024 * 1024;
+  static constexpr int32_t k_DefaultDeflateLevel = 5;
+
+  H5StorageOptions() = default;
+  ~H5StorageOptions() = default;
+
+  H5StorageOptions(const H5StorageOptions&) = default;
+  H5StorageOptions(H5StorageOptions&&) noexcept = default;
+  H5StorageOptions& operator=(const H5StorageOptions&) = default;
+  H5StorageOptions& operator=(H5StorageOptions&&) noexcept = default;
+
+  /**
+   * @brief Creates options that write a contiguous, uncompressed dataset
+   * @return
+   */
+  static H5StorageOptions Contiguous();
+
+  /**
+   * @brief Creates options that write a chunked dataset using the deflate (and optionally shuffle) filters
+   * @param deflateLevel The zlib compression level [0-9]. Zero disables the deflate filter.
+   * @param shuffle Should the byte shuffle filter be applied before compression
+   * @return
+   */
+  static H5StorageOptions Chunked(int32_t deflateLevel = k_DefaultDeflateLevel, bool shuffle = true);
+
+  /**
+   * @brief Returns the options that are in effect for the calling thread when an array does not
+   * carry its own storage options.
+   * @return
+   */
+  static H5StorageOptions GetThreadDefault();
+
+  /**
+   * @brief Sets the options that are used by the calling thread when an array does not carry its
+   * own storage options. Prefer the H5ScopedStorageOptions class so the previous value is restored.
+   * @param options
+   */
+  static void SetThreadDefault(const H5StorageOptions& options);
+
+  /**
+   * @brief Returns these options if they specify a layout, otherwise the thread default
+   * @return
+   */
+  H5StorageOptions resolve() const;
+
+  /**
+   * @brief isChunked
+   * @return
+   */
+  bool isChunked() const;
+
+  /**
+   * @brief Computes the chunk dimensions, in DREAM.3D (XYZ) tuple order, for an array with the given
+   * tuple dimensions and number of bytes per tuple.
+   * @param tDims The tuple dimensions of the array
+   * @param bytesPerTuple The number of bytes for each tuple (type size * number of components)
+   * @return
+   */
+  std::vector<size_t> computeChunkTupleDims(const std::vector<size_t>& tDims, size_t bytesPerTuple) const;
+
+  /**
+   * @brief Setter property for Layout
+   */
+  void setLayout(Layout value);
+  /**
+   * @brief Getter property for Layout
+   * @return Value of Layout
+   */
+  Layout getLayout() const;
+
+  /**
+   * @brief Setter property for ChunkTupleDims. The dimensions are given in XYZ order, matching the
+   * tuple dimensions of the AttributeMatrix. An empty vector lets the writer pick the chunk shape.
+   */
+  void setChunkTupleDims(const std::vector<size_t>& value);
+  /**
+   * @brief Getter property for ChunkTupleDims
+   * @return Value of ChunkTupleDims
+   */
+  std::vector<size_t> getChunkTupleDims() const;
+
+  /**
+   * @brief Setter property for TargetChunkBytes
+   */
+  void setTargetChunkBytes(size_t value);
+  /**
+   * @brief Getter property for TargetChunkBytes
+   * @return Value of TargetChunkBytes
+   */
+  size_t getTargetChunkBytes() const;
+
+  /**
+   * @brief Setter property for DeflateLevel
+   */
+  void setDeflateLevel(int32_t value);
+  /**
+   * @brief Getter property for DeflateLevel
+   * @return Value of DeflateLevel
+   */
+  int32_t getDeflateLevel() const;
+
+  /**
+   * @brief Setter property for Shuffle
+   */
+  void setShuffle(bool value);
+  /**
+   * @brief Getter property for Shuffle
+   * @return Value of Shuffle
+   */
+  bool getShuffle() const;
+
+  /**
+   * @brief Appends an additional HDF5 filter to the filter pipeline
+   * @param filter
+   */
+  void addFilter(const FilterSpec& filter);
+  /**
+   * @brief Getter property for Filters
+   * @return Value of Filters
+   */
+  std::vector<FilterSpec> getFilters() const;
+
+private:
+  Layout m_Layout = Layout::Default;
+  std::vector<size_t> m_ChunkTupleDims = {};
+  size_t m_TargetChunkBytes = k_DefaultChunkBytes;
+  int32_t m_DeflateLevel = 0;
+  bool m_Shuffle = false;
+  std::vector<FilterSpec> m_Filters = {};
+};
+
+/**
+ * @brief The H5ScopedStorageOptions class installs a set of storage options as the default for the
+ * calling thread and restores the previous default when it goes out of scope.
+ */
+class SIMPLib_EXPORT H5ScopedStorageOptions
+{
+public:
+  explicit H5ScopedStorageOptions(const H5StorageOptions& options);
+  ~H5ScopedStorageOptions();
+
+  H5ScopedStorageOptions(const H5ScopedStorageOptions&) = delete;            // Copy Constructor Not Implemented
+  H5ScopedStorageOptions(H5ScopedStorageOptions&&) = delete;                 // Move Constructor Not Implemented
+  H5ScopedStorageOptions& operator=(const H5ScopedStorageOptions&) = delete; // Copy Assignment Not Implemented
+  H5ScopedStorageOptions& operator=(H5ScopedStorageOptions&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  H5StorageOptions m_Previous;
+};
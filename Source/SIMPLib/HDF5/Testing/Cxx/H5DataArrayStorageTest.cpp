@@ -0,0 +1,329 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+using namespace H5Support;
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/HDF5/H5StorageOptions.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class H5DataArrayStorageTest
+{
+public:
+  H5DataArrayStorageTest() = default;
+  virtual ~H5DataArrayStorageTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir tempDir(UnitTest::H5DataArrayStorageTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createVolume(const std::vector<size_t>& tDims, size_t numComps)
+  {
+    size_t numTuples = tDims[0] * tDims[1] * tDims[2];
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, numComps), "Volume", true);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get());
+
+    // A smooth field with some texture so that the compression ratio is representative of real data
+    size_t index = 0;
+    for(size_t z = 0; z < tDims[2]; z++)
+    {
+      for(size_t y = 0; y < tDims[1]; y++)
+      {
+        for(size_t x = 0; x < tDims[0]; x++)
+        {
+          for(size_t c = 0; c < numComps; c++)
+          {
+            (*data)[index++] = static_cast<float>(std::sin(0.05 * x) * std::cos(0.03 * y) + 0.001 * z + c);
+          }
+        }
+      }
+    }
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int writeArray(const QString& filePath, const FloatArrayType::Pointer& data, const std::vector<size_t>& tDims, const H5StorageOptions& options)
+  {
+    hid_t fileId = QH5Utilities::createFile(filePath);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+    return H5DataArrayWriter::writeDataArray<FloatArrayType>(fileId, data.get(), tDims, options);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer readArray(const QString& filePath, H5D_layout_t& layout, int& numFilters)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+
+    hid_t datasetId = H5Dopen(fileId, "Volume", H5P_DEFAULT);
+    DREAM3D_REQUIRED(datasetId, >, 0);
+    hid_t dcpl = H5Dget_create_plist(datasetId);
+    layout = H5Pget_layout(dcpl);
+    numFilters = H5Pget_nfilters(dcpl);
+    H5Pclose(dcpl);
+    H5Dclose(datasetId);
+
+    IDataArray::Pointer ptr = H5DataArrayReader::ReadIDataArray(fileId, "Volume");
+    return std::dynamic_pointer_cast<FloatArrayType>(ptr);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChunkDimensions()
+  {
+    H5StorageOptions options = H5StorageOptions::Chunked();
+
+    // 1 MB chunks of 4 byte scalars hold 262144 tuples: 4 complete 256x256 slices
+    std::vector<size_t> chunkDims = options.computeChunkTupleDims({256, 256, 256}, 4);
+    DREAM3D_REQUIRE_EQUAL(chunkDims.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[0], 256)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[1], 256)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[2], 4)
+
+    // A single slice is larger than the target so the chunk holds complete rows
+    chunkDims = options.computeChunkTupleDims({4096, 4096, 10}, 12);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[0], 4096)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[1], 21)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[2], 1)
+
+    // The whole array is smaller than a chunk
+    chunkDims = options.computeChunkTupleDims({10, 10, 10}, 4);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[0], 10)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[1], 10)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[2], 10)
+
+    // User supplied chunk dimensions are clamped to the array
+    options.setChunkTupleDims({64, 0, 1000});
+    chunkDims = options.computeChunkTupleDims({32, 32, 32}, 4);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[0], 32)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[1], 1)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[2], 32)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRoundTrip()
+  {
+    std::vector<size_t> tDims = {37, 23, 11};
+    FloatArrayType::Pointer data = createVolume(tDims, 3);
+
+    H5StorageOptions options = H5StorageOptions::Chunked(6, true);
+    options.setChunkTupleDims({16, 8, 3});
+    int err = writeArray(UnitTest::H5DataArrayStorageTest::RoundTripFile, data, tDims, options);
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    H5D_layout_t layout = H5D_LAYOUT_ERROR;
+    int numFilters = 0;
+    FloatArrayType::Pointer readData = readArray(UnitTest::H5DataArrayStorageTest::RoundTripFile, layout, numFilters);
+    DREAM3D_REQUIRE_VALID_POINTER(readData.get());
+    DREAM3D_REQUIRE_EQUAL(layout, H5D_CHUNKED)
+    DREAM3D_REQUIRE_EQUAL(numFilters, 2)
+    DREAM3D_REQUIRE_EQUAL(readData->getNumberOfTuples(), data->getNumberOfTuples())
+    DREAM3D_REQUIRE_EQUAL(readData->getNumberOfComponents(), 3)
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL((*readData)[i], (*data)[i])
+    }
+
+    // The per array options take precedence over the thread default and the thread default is restored
+    {
+      H5ScopedStorageOptions scopedOptions(H5StorageOptions::Chunked(1, false));
+      DREAM3D_REQUIRE(H5StorageOptions::GetThreadDefault().isChunked())
+      data->setH5StorageOptions(H5StorageOptions::Contiguous());
+      DREAM3D_REQUIRE(!data->getH5StorageOptions().resolve().isChunked())
+      data->setH5StorageOptions(H5StorageOptions());
+      DREAM3D_REQUIRE(data->getH5StorageOptions().resolve().isChunked())
+    }
+    DREAM3D_REQUIRE(!H5StorageOptions::GetThreadDefault().isChunked())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int overwriteArray(const QString& filePath, const FloatArrayType::Pointer& data, const std::vector<size_t>& tDims, const H5StorageOptions& options)
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, false);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+    return H5DataArrayWriter::writeDataArray<FloatArrayType>(fileId, data.get(), tDims, options);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestOverwrite()
+  {
+    const QString& filePath = UnitTest::H5DataArrayStorageTest::OverwriteFile;
+    std::vector<size_t> tDims = {40, 30, 20};
+    FloatArrayType::Pointer data = createVolume(tDims, 1);
+    H5StorageOptions options = H5StorageOptions::Chunked(0, false);
+    int err = writeArray(filePath, data, tDims, options);
+    DREAM3D_REQUIRED(err, >=, 0)
+    qint64 fileSize = QFileInfo(filePath).size();
+
+    // Writing the same layout again reuses the storage of the existing dataset
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      (*data)[i] = -(*data)[i];
+    }
+    err = overwriteArray(filePath, data, tDims, options);
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(QFileInfo(filePath).size(), fileSize)
+
+    H5D_layout_t layout = H5D_LAYOUT_ERROR;
+    int numFilters = 0;
+    FloatArrayType::Pointer readData = readArray(filePath, layout, numFilters);
+    DREAM3D_REQUIRE_VALID_POINTER(readData.get());
+    DREAM3D_REQUIRE_EQUAL(numFilters, 0)
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL((*readData)[i], (*data)[i])
+    }
+
+    // Different filters cannot be written in place so the dataset is replaced
+    err = overwriteArray(filePath, data, tDims, H5StorageOptions::Chunked(1, true));
+    DREAM3D_REQUIRED(err, >=, 0)
+    readData = readArray(filePath, layout, numFilters);
+    DREAM3D_REQUIRE_VALID_POINTER(readData.get());
+    DREAM3D_REQUIRE_EQUAL(layout, H5D_CHUNKED)
+    DREAM3D_REQUIRE_EQUAL(numFilters, 2)
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL((*readData)[i], (*data)[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkStorage(const QString& label, const QString& filePath, const FloatArrayType::Pointer& data, const std::vector<size_t>& tDims, const H5StorageOptions& options)
+  {
+    auto start = std::chrono::steady_clock::now();
+    int err = writeArray(filePath, data, tDims, options);
+    auto end = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRED(err, >=, 0)
+    auto writeTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    H5D_layout_t layout = H5D_LAYOUT_ERROR;
+    int numFilters = 0;
+    start = std::chrono::steady_clock::now();
+    FloatArrayType::Pointer readData = readArray(filePath, layout, numFilters);
+    end = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRE_VALID_POINTER(readData.get());
+    DREAM3D_REQUIRE_EQUAL(readData->getSize(), data->getSize())
+    auto readTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    double megaBytes = static_cast<double>(data->getSize() * sizeof(float)) / (1024.0 * 1024.0);
+    double fileMegaBytes = static_cast<double>(QFileInfo(filePath).size()) / (1024.0 * 1024.0);
+    std::cout << "\t" << label.toStdString() << ": Write " << writeTime << " ms (" << megaBytes / std::max(1.0, static_cast<double>(writeTime)) * 1000.0 << " MB/s)"
+              << "  Read " << readTime << " ms (" << megaBytes / std::max(1.0, static_cast<double>(readTime)) * 1000.0 << " MB/s)"
+              << "  File Size " << fileMegaBytes << " MB" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStorageBenchmark()
+  {
+    std::vector<size_t> tDims = {256, 256, 128};
+    FloatArrayType::Pointer data = createVolume(tDims, 1);
+
+    std::cout << "\tImageGeom Volume " << tDims[0] << "x" << tDims[1] << "x" << tDims[2] << " float" << std::endl;
+    BenchmarkStorage("Contiguous       ", UnitTest::H5DataArrayStorageTest::ContiguousFile, data, tDims, H5StorageOptions::Contiguous());
+    BenchmarkStorage("Chunked          ", UnitTest::H5DataArrayStorageTest::ChunkedFile, data, tDims, H5StorageOptions::Chunked(0, false));
+    BenchmarkStorage("Shuffle+Deflate 1", UnitTest::H5DataArrayStorageTest::Deflate1File, data, tDims, H5StorageOptions::Chunked(1, true));
+    BenchmarkStorage("Shuffle+Deflate 5", UnitTest::H5DataArrayStorageTest::Deflate5File, data, tDims, H5StorageOptions::Chunked(5, true));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    QDir dir(UnitTest::H5DataArrayStorageTest::TestDir);
+    dir.mkpath(".");
+    std::cout << "#### H5DataArrayStorageTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestChunkDimensions())
+    DREAM3D_REGISTER_TEST(TestRoundTrip())
+    DREAM3D_REGISTER_TEST(TestOverwrite())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestStorageBenchmark())
+#endif
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  H5DataArrayStorageTest(const H5DataArrayStorageTest&) = delete;            // Copy Constructor Not Implemented
+  H5DataArrayStorageTest(H5DataArrayStorageTest&&) = delete;                 // Move Constructor Not Implemented
+  H5DataArrayStorageTest& operator=(const H5DataArrayStorageTest&) = delete; // Copy Assignment Not Implemented
+  H5DataArrayStorageTest& operator=(H5DataArrayStorageTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,328 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QDir>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+using namespace H5Support;
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/EmptyFilter.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/HDF5/H5DeferredDataSource.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+namespace
+{
+/**
+ * @brief Stands in for a file that can no longer be read
+ */
+class FailingDataSource : public DeferredDataSource
+{
+public:
+  bool readElements(void* buffer, size_t startElement, size_t numElements) const override
+  {
+    Q_UNUSED(buffer)
+    Q_UNUSED(startElement)
+    Q_UNUSED(numElements)
+    return false;
+  }
+
+  QString getDescription() const override
+  {
+    return "FailingDataSource";
+  }
+};
+} // namespace
+
+class H5DeferredDataSourceTest
+{
+public:
+  H5DeferredDataSourceTest() = default;
+  virtual ~H5DeferredDataSourceTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir tempDir(UnitTest::H5DeferredDataSourceTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer createArray(const std::vector<size_t>& tDims, size_t numComps, int32_t offset)
+  {
+    size_t numTuples = tDims[0] * tDims[1] * tDims[2];
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(numTuples, std::vector<size_t>(1, numComps), "Values", true);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get());
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      (*data)[i] = static_cast<int32_t>(i) + offset;
+    }
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void writeArray(const Int32ArrayType::Pointer& data, const std::vector<size_t>& tDims)
+  {
+    hid_t fileId = QH5Utilities::createFile(UnitTest::H5DeferredDataSourceTest::TestFile);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+    int err = H5DataArrayWriter::writeDataArray<Int32ArrayType>(fileId, data.get(), tDims);
+    DREAM3D_REQUIRED(err, >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer readArray(bool loadOnDemand)
+  {
+    hid_t fileId = QH5Utilities::openFile(UnitTest::H5DeferredDataSourceTest::TestFile, true);
+    DREAM3D_REQUIRED(fileId, >, 0);
+    H5ScopedFileSentinel sentinel(fileId, false);
+
+    H5ScopedLoadOnDemand scopedLoadOnDemand(loadOnDemand);
+    IDataArray::Pointer ptr = H5DataArrayReader::ReadIDataArray(fileId, "Values");
+    return std::dynamic_pointer_cast<Int32ArrayType>(ptr);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSelectElementRange()
+  {
+    // Every range of a 3 x 4 x 5 dataset must select exactly the elements of that range
+    std::vector<hsize_t> dims = {3, 4, 5};
+    hid_t spaceId = H5Screate_simple(static_cast<int>(dims.size()), dims.data(), nullptr);
+    DREAM3D_REQUIRED(spaceId, >, 0);
+    const hsize_t numElements = 60;
+    for(hsize_t start = 0; start <= numElements; start++)
+    {
+      for(hsize_t count = 0; start + count <= numElements; count++)
+      {
+        DREAM3D_REQUIRE(H5DeferredDataSource::SelectElementRange(spaceId, dims, start, count))
+        DREAM3D_REQUIRE_EQUAL(static_cast<hsize_t>(H5Sget_select_npoints(spaceId)), count)
+        if(count > 0)
+        {
+          hsize_t lower[3] = {0, 0, 0};
+          hsize_t upper[3] = {0, 0, 0};
+          H5Sget_select_bounds(spaceId, lower, upper);
+          DREAM3D_REQUIRE_EQUAL(lower[0], start / 20)
+          DREAM3D_REQUIRE_EQUAL(upper[0], (start + count - 1) / 20)
+        }
+      }
+    }
+    DREAM3D_REQUIRE(!H5DeferredDataSource::SelectElementRange(spaceId, dims, 50, 11))
+    H5Sclose(spaceId);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLoadOnDemand()
+  {
+    std::vector<size_t> tDims = {7, 5, 3};
+    Int32ArrayType::Pointer data = createArray(tDims, 2, 0);
+    writeArray(data, tDims);
+
+    // The default read loads the values immediately
+    Int32ArrayType::Pointer eager = readArray(false);
+    DREAM3D_REQUIRE_VALID_POINTER(eager.get());
+    DREAM3D_REQUIRE(!eager->isDeferred())
+    DREAM3D_REQUIRE(!H5DataArrayReader::GetThreadLoadOnDemand())
+
+    Int32ArrayType::Pointer deferred = readArray(true);
+    DREAM3D_REQUIRE_VALID_POINTER(deferred.get());
+    DREAM3D_REQUIRE(deferred->isDeferred())
+    DREAM3D_REQUIRE(deferred->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(deferred->getNumberOfTuples(), data->getNumberOfTuples())
+    DREAM3D_REQUIRE_EQUAL(deferred->getNumberOfComponents(), 2)
+
+    // A range of tuples that crosses rows and slices is read without loading the array
+    std::vector<int32_t> tuples(2 * 40, -1);
+    DREAM3D_REQUIRE(deferred->readTuples(31, 40, tuples.data()))
+    for(size_t i = 0; i < tuples.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(tuples[i], (*data)[62 + i])
+    }
+    DREAM3D_REQUIRE(!deferred->readTuples(100, 6, tuples.data()))
+    DREAM3D_REQUIRE(deferred->isDeferred())
+
+    // A copy shares the source and stays deferred
+    IDataArray::Pointer copy = deferred->deepCopy();
+    DREAM3D_REQUIRE(copy->isDeferred())
+
+    // Accessing the values loads the whole array
+    int32_t* ptr = deferred->getPointer(0);
+    DREAM3D_REQUIRE_VALID_POINTER(ptr);
+    DREAM3D_REQUIRE(!deferred->isDeferred())
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ptr[i], (*data)[i])
+    }
+
+    // Overwriting the file detaches the copy, which keeps the values of the original file
+    DREAM3D_REQUIRE(H5DeferredDataSource::DetachFromFile(UnitTest::H5DeferredDataSourceTest::TestFile))
+    Int32ArrayType::Pointer changed = createArray(tDims, 2, 1000);
+    writeArray(changed, tDims);
+    Int32ArrayType::Pointer copyArray = std::dynamic_pointer_cast<Int32ArrayType>(copy);
+    DREAM3D_REQUIRE_VALID_POINTER(copyArray.get());
+    DREAM3D_REQUIRE(copyArray->isDeferred())
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copyArray->getValue(i), (*data)[i])
+    }
+
+    // Arrays that are completely overwritten never read the file
+    Int32ArrayType::Pointer zeroed = readArray(true);
+    DREAM3D_REQUIRE_VALID_POINTER(zeroed.get());
+    zeroed->initializeWithZeros();
+    DREAM3D_REQUIRE(!zeroed->isDeferred())
+    DREAM3D_REQUIRE_EQUAL(zeroed->getValue(zeroed->getSize() - 1), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentLoad()
+  {
+    std::vector<size_t> tDims = {40, 30, 20};
+    Int32ArrayType::Pointer data = createArray(tDims, 3, 0);
+    writeArray(data, tDims);
+
+    // Every thread touches the unloaded array at once. Only one of them reads the file and all see the values.
+    Int32ArrayType::Pointer deferred = readArray(true);
+    DREAM3D_REQUIRE(deferred->isDeferred())
+    const Int32ArrayType& constDeferred = *deferred;
+    std::vector<int32_t*> pointers(8, nullptr);
+    std::vector<int32_t> lastValues(8, -1);
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < pointers.size(); t++)
+    {
+      threads.emplace_back([&, t]() {
+        pointers[t] = constDeferred.getPointer(0);
+        lastValues[t] = constDeferred[constDeferred.getSize() - 1];
+      });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    DREAM3D_REQUIRE(!deferred->isDeferred())
+    for(size_t t = 0; t < pointers.size(); t++)
+    {
+      DREAM3D_REQUIRE(pointers[t] == pointers[0])
+      DREAM3D_REQUIRE_EQUAL(lastValues[t], (*data)[data->getSize() - 1])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFailedLoad()
+  {
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(100, std::vector<size_t>(1, 1), "Unreadable", false);
+    array->setDeferredSource(std::make_shared<FailingDataSource>());
+    DREAM3D_REQUIRE(array->isDeferred())
+
+    // The values are neither zero filled nor marked as allocated, and the file is not read again
+    DREAM3D_REQUIRE(!array->loadDeferredData())
+    DREAM3D_REQUIRE(!array->isDeferred())
+    DREAM3D_REQUIRE(!array->isAllocated())
+    DREAM3D_REQUIRE(nullptr == array->data())
+    DREAM3D_REQUIRE(!array->loadDeferredData())
+
+    // A filter that asks for the array during execute gets an error instead of the array
+    array->setDeferredSource(std::make_shared<FailingDataSource>());
+    AttributeMatrix::Pointer am = AttributeMatrix::New({100}, "CellData", AttributeMatrix::Type::Cell);
+    am->addOrReplaceAttributeArray(array);
+    EmptyFilter::Pointer filter = EmptyFilter::New();
+    filter->setInPreflight(true);
+    DREAM3D_REQUIRE_VALID_POINTER(am->getPrereqArray<Int32ArrayType>(filter.get(), "Unreadable", -5000).get());
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    filter->setInPreflight(false);
+    DREAM3D_REQUIRE(nullptr == am->getPrereqArray<Int32ArrayType>(filter.get(), "Unreadable", -5000))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -5000)
+    filter->clearErrorCode();
+    DREAM3D_REQUIRE(nullptr == am->getPrereqIDataArray(filter.get(), "Unreadable", -5001))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -5001)
+
+    // Allocating the array again clears the failure
+    DREAM3D_REQUIRED(array->allocate(), >, 0)
+    DREAM3D_REQUIRE(array->loadDeferredData())
+    DREAM3D_REQUIRE_EQUAL(array->getValue(99), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    QDir dir(UnitTest::H5DeferredDataSourceTest::TestDir);
+    dir.mkpath(".");
+    std::cout << "#### H5DeferredDataSourceTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestSelectElementRange())
+    DREAM3D_REGISTER_TEST(TestLoadOnDemand())
+    DREAM3D_REGISTER_TEST(TestConcurrentLoad())
+    DREAM3D_REGISTER_TEST(TestFailedLoad())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  H5DeferredDataSourceTest(const H5DeferredDataSourceTest&) = delete;            // Copy Constructor Not Implemented
+  H5DeferredDataSourceTest(H5DeferredDataSourceTest&&) = delete;                 // Move Constructor Not Implemented
+  H5DeferredDataSourceTest& operator=(const H5DeferredDataSourceTest&) = delete; // Copy Assignment Not Implemented
+  H5DeferredDataSourceTest& operator=(H5DeferredDataSourceTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -24,6 +24,36 @@ const QString Code("Code");
 const QString FilterHumanLabel("FilterHumanLabel");
 const QString FilterIndex("FilterIndex");
 
+const QString JobId("JobId");
+const QString JobState("JobState");
+const QString Progress("Progress");
+const QString Messages("Messages");
+const QString MessageType("MessageType");
+const QString MessageIndex("MessageIndex");
+const QString NextMessageIndex("NextMessageIndex");
+const QString WaitTime("WaitTime");
+const QString QueuedTime("QueuedTime");
+const QString ExecutionTime("ExecutionTime");
+const QString EstimatedMemory("EstimatedMemory");
+
+const QString Jobs("Jobs");
+const QString Scheduler("Scheduler");
+const QString QueueDepth("QueueDepth");
+const QString MaxConcurrentJobs("MaxConcurrentJobs");
+const QString CoresPerJob("CoresPerJob");
+const QString MemoryBudget("MemoryBudget");
+const QString MemoryInUse("MemoryInUse");
+const QString CoreBudget("CoreBudget");
+const QString CoresInUse("CoresInUse");
+const QString WaitingForResources("WaitingForResources");
+const QString AdmittedJobs("AdmittedJobs");
+const QString RejectedJobs("RejectedJobs");
+const QString AverageAdmissionWaitTime("AverageAdmissionWaitTime");
+const QString MaxAdmissionWaitTime("MaxAdmissionWaitTime");
+const QString AverageQueuedTime("AverageQueuedTime");
+const QString MaxQueuedTime("MaxQueuedTime");
+const QString OldestQueuedTime("OldestQueuedTime");
+
 const QString ReleaseDate("ReleaseDate");
 const QString ReleaseType("ReleaseType");
 const QString MajorVersion("MajorVersion");
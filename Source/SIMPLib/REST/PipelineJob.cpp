@@ -0,0 +1,625 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineJob.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractMessageHandler.h"
+#include "SIMPLib/Messages/FilterErrorMessage.h"
+#include "SIMPLib/Messages/FilterProgressMessage.h"
+#include "SIMPLib/Messages/FilterStatusMessage.h"
+#include "SIMPLib/Messages/FilterWarningMessage.h"
+#include "SIMPLib/Messages/GenericErrorMessage.h"
+#include "SIMPLib/Messages/GenericProgressMessage.h"
+#include "SIMPLib/Messages/GenericStatusMessage.h"
+#include "SIMPLib/Messages/GenericWarningMessage.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Messages/PipelineProgressMessage.h"
+#include "SIMPLib/Messages/PipelineStatusMessage.h"
+#include "SIMPLib/Messages/PipelineWarningMessage.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/REST/PipelineJobScheduler.h"
+#include "SIMPLib/REST/V1Controllers/ExecutePipelineMessageHandler.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+namespace
+{
+const QString k_ErrorType("Error");
+const QString k_WarningType("Warning");
+const QString k_StatusType("Status");
+const QString k_ProgressType("Progress");
+
+/**
+ * @brief Converts a pipeline message into the json object that is stored in the job's message log. Progress
+ * messages without any text only update the overall progress of the job and are not logged.
+ */
+class PipelineJobMessageHandler : public AbstractMessageHandler
+{
+public:
+  PipelineJobMessageHandler(QJsonObject* obj, int* progress, bool* isError)
+  : m_Obj(obj)
+  , m_Progress(progress)
+  , m_IsError(isError)
+  {
+  }
+
+  void processMessage(const FilterErrorMessage* msg) const override
+  {
+    write(k_ErrorType, msg->getMessageText(), msg->getPipelineIndex(), msg->getHumanLabel());
+    m_Obj->insert(SIMPL::JSON::Code, msg->getCode());
+    *m_IsError = true;
+  }
+
+  void processMessage(const FilterWarningMessage* msg) const override
+  {
+    write(k_WarningType, msg->getMessageText(), msg->getPipelineIndex(), msg->getHumanLabel());
+    m_Obj->insert(SIMPL::JSON::Code, msg->getCode());
+  }
+
+  void processMessage(const FilterStatusMessage* msg) const override
+  {
+    write(k_StatusType, msg->getMessageText(), msg->getPipelineIndex(), msg->getHumanLabel());
+  }
+
+  void processMessage(const FilterProgressMessage* msg) const override
+  {
+    // The pipeline converts filter progress into its own progress messages, so only the text is of interest here
+    if(!msg->getMessageText().isEmpty())
+    {
+      write(k_ProgressType, msg->getMessageText(), msg->getPipelineIndex(), msg->getHumanLabel());
+      m_Obj->insert(SIMPL::JSON::Progress, msg->getProgressValue());
+    }
+  }
+
+  void processMessage(const PipelineErrorMessage* msg) const override
+  {
+    write(k_ErrorType, msg->getMessageText());
+    m_Obj->insert(SIMPL::JSON::Code, msg->getCode());
+    *m_IsError = true;
+  }
+
+  void processMessage(const PipelineWarningMessage* msg) const override
+  {
+    write(k_WarningType, msg->getMessageText());
+    m_Obj->insert(SIMPL::JSON::Code, msg->getCode());
+  }
+
+  void processMessage(const PipelineStatusMessage* msg) const override
+  {
+    write(k_StatusType, msg->getMessageText());
+  }
+
+  void processMessage(const PipelineProgressMessage* msg) const override
+  {
+    *m_Progress = msg->getProgressValue();
+    if(!msg->getMessageText().isEmpty())
+    {
+      write(k_ProgressType, msg->getMessageText());
+      m_Obj->insert(SIMPL::JSON::Progress, msg->getProgressValue());
+    }
+  }
+
+  void processMessage(const GenericErrorMessage* msg) const override
+  {
+    write(k_ErrorType, msg->getMessageText());
+    m_Obj->insert(SIMPL::JSON::Code, msg->getCode());
+    *m_IsError = true;
+  }
+
+  void processMessage(const GenericWarningMessage* msg) const override
+  {
+    write(k_WarningType, msg->getMessageText());
+    m_Obj->insert(SIMPL::JSON::Code, msg->getCode());
+  }
+
+  void processMessage(const GenericStatusMessage* msg) const override
+  {
+    write(k_StatusType, msg->getMessageText());
+  }
+
+  void processMessage(const GenericProgressMessage* msg) const override
+  {
+    if(!msg->getMessageText().isEmpty())
+    {
+      write(k_ProgressType, msg->getMessageText());
+      m_Obj->insert(SIMPL::JSON::Progress, msg->getProgressValue());
+    }
+  }
+
+private:
+  QJsonObject* m_Obj = nullptr;
+  int* m_Progress = nullptr;
+  bool* m_IsError = nullptr;
+
+  void write(const QString& type, const QString& text) const
+  {
+    m_Obj->insert(SIMPL::JSON::MessageType, type);
+    m_Obj->insert(SIMPL::JSON::Message, text);
+  }
+
+  void write(const QString& type, const QString& text, int filterIndex, const QString& humanLabel) const
+  {
+    write(type, text);
+    m_Obj->insert(SIMPL::JSON::FilterIndex, filterIndex);
+    m_Obj->insert(SIMPL::JSON::FilterHumanLabel, humanLabel);
+  }
+};
+
+/**
+ * @brief Forwards the messages of the pipeline and its filters to the job. The observer is created on the
+ * worker thread together with the pipeline, so the connections between them are direct.
+ */
+class PipelineJobObserver : public Observer
+{
+public:
+  explicit PipelineJobObserver(PipelineJob* job)
+  : m_Job(job)
+  {
+  }
+
+  void processPipelineMessage(const AbstractMessage::Pointer& pm) override
+  {
+    m_Job->processPipelineMessage(pm);
+  }
+
+private:
+  PipelineJob* m_Job = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+PipelineJob::PipelineJob(const QString& jobId, const QJsonObject& pipelineJson)
+: m_JobId(jobId)
+, m_PipelineJson(pipelineJson)
+{
+  m_QueuedTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+PipelineJob::~PipelineJob() = default;
+
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJob::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJob::New(const QString& jobId, const QJsonObject& pipelineJson)
+{
+  Pointer sharedPtr(new PipelineJob(jobId, pipelineJson));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineJob::StateToString(State state)
+{
+  switch(state)
+  {
+  case State::Queued:
+    return QString("Queued");
+  case State::Running:
+    return QString("Running");
+  case State::Completed:
+    return QString("Completed");
+  case State::Failed:
+    return QString("Failed");
+  case State::Canceled:
+    return QString("Canceled");
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+QString PipelineJob::getJobId() const
+{
+  return m_JobId;
+}
+
+// -----------------------------------------------------------------------------
+PipelineJob::State PipelineJob::getState() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_State;
+}
+
+// -----------------------------------------------------------------------------
+int PipelineJob::getProgress() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Progress;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineJob::isFinished() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_State != State::Queued && m_State != State::Running;
+}
+
+// -----------------------------------------------------------------------------
+int PipelineJob::getMessageCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Messages.size();
+}
+
+// -----------------------------------------------------------------------------
+qint64 PipelineJob::getQueuedTime() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return (m_QueuedTime < 0) ? m_QueuedTimer.elapsed() : m_QueuedTime;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PipelineJob::getEstimatedMemory() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_EstimatedMemory;
+}
+
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::getStatus(int firstMessageIndex, int waitTime) const
+{
+  QMutexLocker locker(&m_Mutex);
+  firstMessageIndex = std::max(firstMessageIndex, 0);
+
+  // Long-poll: wait until there is something new to report, i.e. a message, a state change or new progress
+  const State state = m_State;
+  const int progress = m_Progress;
+  QElapsedTimer timer;
+  timer.start();
+  while(firstMessageIndex >= m_Messages.size() && m_State == state && m_Progress == progress && (m_State == State::Queued || m_State == State::Running))
+  {
+    qint64 remaining = waitTime - timer.elapsed();
+    if(remaining <= 0)
+    {
+      break;
+    }
+    m_Changed.wait(&m_Mutex, static_cast<unsigned long>(remaining));
+  }
+
+  QJsonArray messages;
+  for(int i = firstMessageIndex; i < m_Messages.size(); i++)
+  {
+    messages.append(m_Messages[i]);
+  }
+
+  QJsonObject obj;
+  obj[SIMPL::JSON::JobId] = m_JobId;
+  obj[SIMPL::JSON::JobState] = StateToString(m_State);
+  obj[SIMPL::JSON::Progress] = m_Progress;
+  obj[SIMPL::JSON::QueuedTime] = (m_QueuedTime < 0) ? m_QueuedTimer.elapsed() : m_QueuedTime;
+  obj[SIMPL::JSON::ExecutionTime] = (m_State == State::Running) ? m_ExecutionTimer.elapsed() : m_ExecutionTime;
+  obj[SIMPL::JSON::EstimatedMemory] = static_cast<qint64>(m_EstimatedMemory);
+  obj[SIMPL::JSON::Messages] = messages;
+  obj[SIMPL::JSON::NextMessageIndex] = std::max(firstMessageIndex, m_Messages.size());
+  return obj;
+}
+
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::getResult() const
+{
+  QMutexLocker locker(&m_Mutex);
+  if(m_State == State::Queued || m_State == State::Running)
+  {
+    return QJsonObject();
+  }
+
+  QJsonArray errors;
+  QJsonArray warnings;
+  ExecutePipelineMessageHandler msgHandler(&errors, &warnings);
+  for(const AbstractMessage::Pointer& msg : m_ErrorAndWarningMessages)
+  {
+    msg->visit(&msgHandler);
+  }
+
+  QJsonObject obj;
+  obj[SIMPL::JSON::JobId] = m_JobId;
+  obj[SIMPL::JSON::JobState] = StateToString(m_State);
+  obj[SIMPL::JSON::Completed] = (m_State == State::Completed);
+  obj[SIMPL::JSON::PipelineErrors] = errors;
+  obj[SIMPL::JSON::PipelineWarnings] = warnings;
+  return obj;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineJob::waitForFinished(int waitTime) const
+{
+  QMutexLocker locker(&m_Mutex);
+  QElapsedTimer timer;
+  timer.start();
+  while(m_State == State::Queued || m_State == State::Running)
+  {
+    if(waitTime < 0)
+    {
+      m_Changed.wait(&m_Mutex);
+      continue;
+    }
+    qint64 remaining = waitTime - timer.elapsed();
+    if(remaining <= 0)
+    {
+      return false;
+    }
+    m_Changed.wait(&m_Mutex, static_cast<unsigned long>(remaining));
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineJob::cancel()
+{
+  PipelineJobScheduler* scheduler = nullptr;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_State == State::Queued)
+    {
+      m_QueuedTime = m_QueuedTimer.elapsed();
+      m_State = State::Canceled;
+      m_Changed.wakeAll();
+      scheduler = m_Scheduler;
+    }
+    else if(m_State == State::Running)
+    {
+      m_CancelRequested = true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  if(nullptr != scheduler)
+  {
+    // The job may be waiting in the scheduler's queue, which drops it now
+    scheduler->processRequests();
+  }
+  forwardCancel();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJob::forwardCancel()
+{
+  // FilterPipeline::cancel() reports an error if the pipeline is not executing, so the request is only passed
+  // on once the pipeline executes. Until then the worker thread checks the request itself.
+  FilterPipeline::Pointer pipeline;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(!m_CancelRequested || m_CancelForwarded || nullptr == m_Pipeline || !m_Pipeline->isExecuting())
+    {
+      return;
+    }
+    m_CancelForwarded = true;
+    pipeline = m_Pipeline;
+  }
+  pipeline->cancel();
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineJob::preflight(PipelineJobScheduler* scheduler)
+{
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_State != State::Queued)
+    {
+      // The job was canceled while it was waiting for a worker thread
+      return false;
+    }
+    m_Scheduler = scheduler;
+  }
+
+  FilterPipeline::Pointer pipeline = FilterPipeline::FromJson(m_PipelineJson);
+  if(nullptr == pipeline)
+  {
+    processPipelineMessage(PipelineErrorMessage::New(QString(), QObject::tr("Pipeline object could not be created from the provided JSON pipeline data."), -50));
+    finish(State::Failed);
+    return false;
+  }
+
+  // The preflight leaves every filter with a snapshot of the data structure it produces, which is all the
+  // scheduler needs to estimate the pipeline's memory requirements before any data is allocated. The pipeline may
+  // execute on another worker thread, so each phase has its own observer on the thread that runs it and every
+  // message reaches it directly.
+  {
+    PipelineJobObserver observer(this);
+    pipeline->addMessageReceiver(&observer);
+    pipeline->preflightPipeline();
+    pipeline->removeMessageReceiver(&observer);
+  }
+  const uint64_t estimatedMemory = PipelineJobScheduler::EstimatePeakMemory(*pipeline);
+
+  bool hasErrors = false;
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_EstimatedMemory = estimatedMemory;
+    m_Changed.wakeAll();
+    if(m_State != State::Queued)
+    {
+      // The job was canceled during the preflight, which already finished it
+      return false;
+    }
+    hasErrors = m_HasErrors;
+    if(!hasErrors)
+    {
+      m_Pipeline = pipeline;
+    }
+  }
+
+  if(hasErrors)
+  {
+    finish(State::Failed);
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJob::execute(PipelineJobScheduler* scheduler, const PipelineJobScheduler::Grant& grant)
+{
+  FilterPipeline::Pointer pipeline;
+  bool canExecute = false;
+  {
+    QMutexLocker locker(&m_Mutex);
+    pipeline = m_Pipeline;
+    // The job may have been canceled while it waited for its resources
+    canExecute = (m_State == State::Queued && nullptr != pipeline);
+    if(canExecute)
+    {
+      m_State = State::Running;
+      m_QueuedTime = m_QueuedTimer.elapsed();
+      m_ExecutionTimer.start();
+      m_Changed.wakeAll();
+    }
+  }
+
+  if(canExecute)
+  {
+    PipelineJobObserver observer(this);
+    pipeline->addMessageReceiver(&observer);
+    if(grant.Cores > 0)
+    {
+      pipeline->setExecutionContext(ParallelExecutionContext::New(grant.Cores));
+    }
+    pipeline->execute();
+    pipeline->removeMessageReceiver(&observer);
+  }
+
+  // The resources go back before the job is finished, so anyone waiting for the job sees them available again
+  if(nullptr != scheduler)
+  {
+    scheduler->release(grant);
+  }
+
+  State state = State::Completed;
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_Pipeline.reset();
+    if(!canExecute)
+    {
+      // The job was canceled before it started executing, which already finished it
+      return;
+    }
+    if(m_CancelRequested || pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Canceled)
+    {
+      state = State::Canceled;
+    }
+    else if(m_HasErrors)
+    {
+      state = State::Failed;
+    }
+  }
+  finish(state);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJob::reject(uint64_t memoryBudget)
+{
+  uint64_t estimatedMemory = 0;
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_Pipeline.reset();
+    if(m_State != State::Queued)
+    {
+      return;
+    }
+    estimatedMemory = m_EstimatedMemory;
+  }
+
+  QString msg = QObject::tr("The pipeline is estimated to need %1 MB of memory, which exceeds the memory budget of %2 MB.").arg(estimatedMemory / (1024 * 1024)).arg(memoryBudget / (1024 * 1024));
+  processPipelineMessage(PipelineErrorMessage::New(QString(), msg, -300));
+  finish(State::Failed);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJob::run(int32_t cores)
+{
+  if(preflight())
+  {
+    PipelineJobScheduler::Grant grant;
+    grant.Cores = cores;
+    execute(nullptr, grant);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJob::finish(State state)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(m_QueuedTime < 0)
+  {
+    m_QueuedTime = m_QueuedTimer.elapsed();
+  }
+  m_State = state;
+  if(m_ExecutionTimer.isValid())
+  {
+    m_ExecutionTime = m_ExecutionTimer.elapsed();
+  }
+  if(state == State::Completed)
+  {
+    m_Progress = 100;
+  }
+  m_Changed.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJob::processPipelineMessage(const AbstractMessage::Pointer& msg)
+{
+  {
+    QMutexLocker locker(&m_Mutex);
+
+    QJsonObject obj;
+    bool isError = false;
+    PipelineJobMessageHandler msgHandler(&obj, &m_Progress, &isError);
+    msg->visit(&msgHandler);
+
+    if(!obj.isEmpty())
+    {
+      obj[SIMPL::JSON::MessageIndex] = m_Messages.size();
+      m_Messages.append(obj);
+      if(isError || obj[SIMPL::JSON::MessageType].toString() == k_WarningType)
+      {
+        m_ErrorAndWarningMessages.push_back(msg);
+      }
+    }
+    m_HasErrors = m_HasErrors || isError;
+    m_Changed.wakeAll();
+  }
+
+  // The pipeline may have started executing since the cancel request came in
+  forwardCancel();
+}
@@ -0,0 +1,242 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+#include "SIMPLib/REST/PipelineJobScheduler.h"
+
+class FilterPipeline;
+
+/**
+ * @brief The PipelineJob class holds one pipeline submitted to the REST server for asynchronous execution.
+ * The job is created by the PipelineJobManager and executed on one of its worker threads. Every message the
+ * pipeline generates is stored in the job's message log together with a running index so that clients can
+ * poll for the messages that arrived since their last request. All methods are thread safe.
+ */
+class SIMPLib_EXPORT PipelineJob
+{
+public:
+  using Self = PipelineJob;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Creates a queued job for the given JSON pipeline
+   * @param jobId
+   * @param pipelineJson
+   * @return
+   */
+  static Pointer New(const QString& jobId, const QJsonObject& pipelineJson);
+
+  virtual ~PipelineJob();
+
+  enum class State : unsigned int
+  {
+    Queued,
+    Running,
+    Completed,
+    Failed,
+    Canceled
+  };
+
+  /**
+   * @brief Returns the string the REST API uses for the given state
+   * @param state
+   * @return
+   */
+  static QString StateToString(State state);
+
+  /**
+   * @brief Getter property for JobId
+   * @return Value of JobId
+   */
+  QString getJobId() const;
+
+  /**
+   * @brief Getter property for State
+   * @return Value of State
+   */
+  State getState() const;
+
+  /**
+   * @brief Returns the overall progress of the pipeline in percent
+   * @return
+   */
+  int getProgress() const;
+
+  /**
+   * @brief Returns true once the job completed, failed or was canceled
+   * @return
+   */
+  bool isFinished() const;
+
+  /**
+   * @brief Returns the number of messages in the message log
+   * @return
+   */
+  int getMessageCount() const;
+
+  /**
+   * @brief Returns the number of milliseconds the job waited between its submission and the start of its execution.
+   * While the job is still queued this is the time it waited so far.
+   * @return
+   */
+  qint64 getQueuedTime() const;
+
+  /**
+   * @brief Returns the peak memory in bytes that the preflight estimated for the job's pipeline or 0 before the
+   * preflight finished
+   * @return
+   */
+  uint64_t getEstimatedMemory() const;
+
+  /**
+   * @brief Returns the job state, progress, timings and every message with an index of at least firstMessageIndex.
+   * If there are no such messages and the job is not finished this waits up to waitTime milliseconds for one to
+   * arrive, which lets clients long-poll the job instead of repeatedly asking for its status.
+   * @param firstMessageIndex
+   * @param waitTime
+   * @return
+   */
+  QJsonObject getStatus(int firstMessageIndex, int waitTime) const;
+
+  /**
+   * @brief Returns the same Completed, PipelineErrors and PipelineWarnings values as the ExecutePipeline end point
+   * once the job is finished or an empty object while it is still queued or running.
+   * @return
+   */
+  QJsonObject getResult() const;
+
+  /**
+   * @brief Blocks until the job is finished or waitTime milliseconds passed. A negative time waits forever.
+   * @param waitTime
+   * @return True if the job is finished
+   */
+  bool waitForFinished(int waitTime = -1) const;
+
+  /**
+   * @brief Cancels the job. A queued job is canceled right away, even while it waits for the scheduler to admit it,
+   * a running job as soon as its current filter checks for cancellation.
+   * @return False if the job is already finished
+   */
+  bool cancel();
+
+  /**
+   * @brief Builds and preflights the pipeline on the calling thread and estimates its peak memory. This is called by
+   * the PipelineJobManager's worker threads before the job asks the scheduler for its resources.
+   * @param scheduler Scheduler the job is going to wait in. Canceling the job tells it to drop the job's request.
+   * @return True if the job can go on to execute. Otherwise the job is finished.
+   */
+  bool preflight(PipelineJobScheduler* scheduler = nullptr);
+
+  /**
+   * @brief Executes the preflighted pipeline on the calling thread unless the job was canceled in the meantime
+   * @param scheduler Scheduler that admitted the job. The granted resources are released once the pipeline is done.
+   * @param grant Resources the scheduler granted. The pipeline's filters use grant.Cores cores, 0 uses the default
+   * execution context.
+   */
+  void execute(PipelineJobScheduler* scheduler = nullptr, const PipelineJobScheduler::Grant& grant = PipelineJobScheduler::Grant());
+
+  /**
+   * @brief Fails a preflighted job whose estimated memory exceeds the given memory budget
+   * @param memoryBudget
+   */
+  void reject(uint64_t memoryBudget);
+
+  /**
+   * @brief Preflights and executes the pipeline on the calling thread without waiting for a scheduler
+   * @param cores Number of cores the pipeline's filters may use. 0 uses the default execution context.
+   */
+  void run(int32_t cores = 0);
+
+  /**
+   * @brief Appends a message that the job's pipeline generated to the message log
+   * @param msg
+   */
+  void processPipelineMessage(const AbstractMessage::Pointer& msg);
+
+protected:
+  PipelineJob(const QString& jobId, const QJsonObject& pipelineJson);
+
+private:
+  QString m_JobId;
+  QJsonObject m_PipelineJson;
+
+  mutable QMutex m_Mutex;
+  mutable QWaitCondition m_Changed;
+  State m_State = State::Queued;
+  int m_Progress = 0;
+  bool m_CancelRequested = false;
+  bool m_CancelForwarded = false;
+  std::shared_ptr<FilterPipeline> m_Pipeline;
+  PipelineJobScheduler* m_Scheduler = nullptr;
+  uint64_t m_EstimatedMemory = 0;
+
+  QJsonArray m_Messages;
+  std::vector<AbstractMessage::Pointer> m_ErrorAndWarningMessages;
+  bool m_HasErrors = false;
+
+  QElapsedTimer m_QueuedTimer;
+  qint64 m_QueuedTime = -1;
+  QElapsedTimer m_ExecutionTimer;
+  qint64 m_ExecutionTime = -1;
+
+  /**
+   * @brief Passes a pending cancel request on to the pipeline once it is executing
+   */
+  void forwardCancel();
+
+  void finish(State state);
+
+public:
+  PipelineJob(const PipelineJob&) = delete;            // Copy Constructor Not Implemented
+  PipelineJob(PipelineJob&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJob& operator=(const PipelineJob&) = delete; // Copy Assignment Not Implemented
+  PipelineJob& operator=(PipelineJob&&) = delete;      // Move Assignment Not Implemented
+};
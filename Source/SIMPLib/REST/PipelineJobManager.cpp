@@ -0,0 +1,278 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineJobManager.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+namespace
+{
+/**
+ * @brief Runs one step of a job, its preflight or its execution, on a worker thread of the job manager's thread pool
+ */
+class PipelineJobRunnable : public QRunnable
+{
+public:
+  explicit PipelineJobRunnable(std::function<void()> step)
+  : m_Step(std::move(step))
+  {
+  }
+
+  void run() override
+  {
+    m_Step();
+  }
+
+private:
+  std::function<void()> m_Step;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+PipelineJobManager::PipelineJobManager()
+: m_Scheduler(PipelineJobScheduler::New())
+{
+  // Each pipeline already runs its filters in parallel, so only a fraction of the cores get their own pipeline
+  m_ThreadPool.setMaxThreadCount(std::max(1, QThread::idealThreadCount() / 4));
+}
+
+// -----------------------------------------------------------------------------
+PipelineJobManager::~PipelineJobManager()
+{
+  QMutexLocker locker(&m_Mutex);
+  for(const PipelineJob::Pointer& job : m_Jobs)
+  {
+    job->cancel();
+  }
+  locker.unlock();
+  m_ThreadPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+PipelineJobManager* PipelineJobManager::Instance()
+{
+  // The HTTP connection threads can all ask for the manager at once, so rely on the thread safe static initialization
+  static PipelineJobManager* s_Self = new PipelineJobManager();
+  return s_Self;
+}
+
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobManager::submit(const QJsonObject& pipelineJson)
+{
+  QString jobId = QUuid::createUuid().toString();
+  jobId.remove('{');
+  jobId.remove('}');
+  PipelineJob::Pointer job = PipelineJob::New(jobId, pipelineJson);
+
+  {
+    QMutexLocker locker(&m_Mutex);
+    removeExpiredJobs();
+    m_Jobs.insert(jobId, job);
+    m_JobOrder.push_back(jobId);
+  }
+
+  const int32_t cores = getCoresPerJob();
+  m_ThreadPool.start(new PipelineJobRunnable([this, job, cores]() { preflightJob(job, cores); }));
+  return job;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobManager::preflightJob(const PipelineJob::Pointer& job, int32_t cores)
+{
+  if(!job->preflight(m_Scheduler.get()))
+  {
+    return;
+  }
+
+  // The worker thread is free again while the job waits for its resources. The scheduler hands the job back once
+  // it was admitted, from whichever thread released the resources it needs.
+  m_Scheduler->request(
+      job->getEstimatedMemory(), cores, [job]() { return job->getState() != PipelineJob::State::Queued; },
+      [this, job](PipelineJobScheduler::Admission admission, const PipelineJobScheduler::Grant& grant) {
+        if(admission == PipelineJobScheduler::Admission::Admitted)
+        {
+          m_ThreadPool.start(new PipelineJobRunnable([this, job, grant]() { job->execute(m_Scheduler.get(), grant); }));
+        }
+        else if(admission == PipelineJobScheduler::Admission::Rejected)
+        {
+          job->reject(m_Scheduler->getMemoryBudget());
+        }
+      });
+}
+
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobManager::getJob(const QString& jobId) const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Jobs.value(jobId, PipelineJob::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+int PipelineJobManager::getJobCount(PipelineJob::State state) const
+{
+  QMutexLocker locker(&m_Mutex);
+  return static_cast<int>(std::count_if(m_Jobs.begin(), m_Jobs.end(), [state](const PipelineJob::Pointer& job) { return job->getState() == state; }));
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobManager::setMaxConcurrentJobs(int value)
+{
+  m_ThreadPool.setMaxThreadCount(std::max(value, 1));
+}
+
+// -----------------------------------------------------------------------------
+int PipelineJobManager::getMaxConcurrentJobs() const
+{
+  return m_ThreadPool.maxThreadCount();
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobManager::setMaxRetainedJobs(int value)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_MaxRetainedJobs = std::max(value, 0);
+  removeExpiredJobs();
+}
+
+// -----------------------------------------------------------------------------
+int PipelineJobManager::getMaxRetainedJobs() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MaxRetainedJobs;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobManager::setCoresPerJob(int32_t value)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_CoresPerJob = std::max(value, 0);
+}
+
+// -----------------------------------------------------------------------------
+int32_t PipelineJobManager::getCoresPerJob() const
+{
+  QMutexLocker locker(&m_Mutex);
+  if(m_CoresPerJob > 0)
+  {
+    return m_CoresPerJob;
+  }
+  return std::max(1, m_Scheduler->getCoreBudget() / getMaxConcurrentJobs());
+}
+
+// -----------------------------------------------------------------------------
+PipelineJobScheduler::Pointer PipelineJobManager::getScheduler() const
+{
+  return m_Scheduler;
+}
+
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJobManager::getMetrics() const
+{
+  QJsonObject jobs;
+  QJsonObject obj;
+  {
+    QMutexLocker locker(&m_Mutex);
+    int numStarted = 0;
+    qint64 totalQueuedTime = 0;
+    qint64 maxQueuedTime = 0;
+    qint64 oldestQueuedTime = 0;
+    std::map<PipelineJob::State, int> counts;
+    for(const PipelineJob::Pointer& job : m_Jobs)
+    {
+      PipelineJob::State state = job->getState();
+      qint64 queuedTime = job->getQueuedTime();
+      counts[state]++;
+      if(state == PipelineJob::State::Queued)
+      {
+        oldestQueuedTime = std::max(oldestQueuedTime, queuedTime);
+      }
+      else if(state != PipelineJob::State::Canceled)
+      {
+        // Jobs that never left the queue would skew the statistics of the jobs that were admitted
+        numStarted++;
+        totalQueuedTime += queuedTime;
+        maxQueuedTime = std::max(maxQueuedTime, queuedTime);
+      }
+    }
+
+    for(PipelineJob::State state : {PipelineJob::State::Queued, PipelineJob::State::Running, PipelineJob::State::Completed, PipelineJob::State::Failed, PipelineJob::State::Canceled})
+    {
+      jobs[PipelineJob::StateToString(state)] = counts[state];
+    }
+
+    obj[SIMPL::JSON::QueueDepth] = counts[PipelineJob::State::Queued];
+    obj[SIMPL::JSON::AverageQueuedTime] = (numStarted == 0) ? 0.0 : static_cast<double>(totalQueuedTime) / static_cast<double>(numStarted);
+    obj[SIMPL::JSON::MaxQueuedTime] = maxQueuedTime;
+    obj[SIMPL::JSON::OldestQueuedTime] = oldestQueuedTime;
+  }
+
+  obj[SIMPL::JSON::Jobs] = jobs;
+  obj[SIMPL::JSON::MaxConcurrentJobs] = getMaxConcurrentJobs();
+  obj[SIMPL::JSON::CoresPerJob] = getCoresPerJob();
+  obj[SIMPL::JSON::Scheduler] = m_Scheduler->getMetrics();
+  return obj;
+}
+
+// -----------------------------------------------------------------------------
+bool PipelineJobManager::waitForDone(int waitTime)
+{
+  return m_ThreadPool.waitForDone(waitTime);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobManager::removeExpiredJobs()
+{
+  int numFinished = static_cast<int>(std::count_if(m_Jobs.begin(), m_Jobs.end(), [](const PipelineJob::Pointer& job) { return job->isFinished(); }));
+  for(auto iter = m_JobOrder.begin(); iter != m_JobOrder.end() && numFinished > m_MaxRetainedJobs;)
+  {
+    if(m_Jobs.value(*iter)->isFinished())
+    {
+      m_Jobs.remove(*iter);
+      iter = m_JobOrder.erase(iter);
+      numFinished--;
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
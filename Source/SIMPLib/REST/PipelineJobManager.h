@@ -0,0 +1,177 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <deque>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QThreadPool>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/REST/PipelineJob.h"
+#include "SIMPLib/REST/PipelineJobScheduler.h"
+
+/**
+ * @brief The PipelineJobManager class runs the pipelines submitted to the REST server's asynchronous job end points.
+ * Submitting a pipeline returns a PipelineJob right away. The jobs wait in a queue until one of a bounded number
+ * of worker threads is free, so a burst of submissions neither ties up the HTTP connection threads nor starts more
+ * pipelines than the machine can execute at once. Once preflighted, a job gives its worker thread back and waits in
+ * the PipelineJobScheduler's queue until its estimated peak memory and its share of the cores are admitted. Only then
+ * is it queued again to execute, so waiting jobs never hold on to a worker thread. Finished jobs are kept around for
+ * their results until more than getMaxRetainedJobs() of them pile up, after which the oldest are removed.
+ */
+class SIMPLib_EXPORT PipelineJobManager
+{
+public:
+  /**
+   * @brief Returns the process wide job manager
+   * @return
+   */
+  static PipelineJobManager* Instance();
+
+  virtual ~PipelineJobManager();
+
+  /**
+   * @brief Queues the given JSON pipeline for execution
+   * @param pipelineJson
+   * @return The queued job
+   */
+  PipelineJob::Pointer submit(const QJsonObject& pipelineJson);
+
+  /**
+   * @brief Returns the job with the given id or a null pointer if there is no such job or it was removed
+   * @param jobId
+   * @return
+   */
+  PipelineJob::Pointer getJob(const QString& jobId) const;
+
+  /**
+   * @brief Returns the number of known jobs that are in the given state
+   * @param state
+   * @return
+   */
+  int getJobCount(PipelineJob::State state) const;
+
+  /**
+   * @brief Sets the number of pipelines that may execute at the same time. Values smaller than 1 are clamped to 1.
+   * @param value
+   */
+  void setMaxConcurrentJobs(int value);
+
+  /**
+   * @brief Returns the number of pipelines that may execute at the same time
+   * @return
+   */
+  int getMaxConcurrentJobs() const;
+
+  /**
+   * @brief Sets the number of finished jobs whose results are kept
+   * @param value
+   */
+  void setMaxRetainedJobs(int value);
+
+  /**
+   * @brief Returns the number of finished jobs whose results are kept
+   * @return
+   */
+  int getMaxRetainedJobs() const;
+
+  /**
+   * @brief Sets the number of cores each executing pipeline may use. 0 divides the scheduler's core budget evenly
+   * between the concurrent jobs.
+   * @param value
+   */
+  void setCoresPerJob(int32_t value);
+
+  /**
+   * @brief Returns the number of cores each executing pipeline may use
+   * @return
+   */
+  int32_t getCoresPerJob() const;
+
+  /**
+   * @brief Returns the scheduler that admits the preflighted jobs for execution
+   * @return
+   */
+  PipelineJobScheduler::Pointer getScheduler() const;
+
+  /**
+   * @brief Returns the number of jobs in each state, the queue depth, the time the jobs spent in the queue and the
+   * scheduler's metrics as json
+   * @return
+   */
+  QJsonObject getMetrics() const;
+
+  /**
+   * @brief Waits until every queued and running job is finished or waitTime milliseconds passed. A negative time
+   * waits forever.
+   * @param waitTime
+   * @return True if all jobs are finished
+   */
+  bool waitForDone(int waitTime = -1);
+
+protected:
+  PipelineJobManager();
+
+private:
+  mutable QMutex m_Mutex;
+  QThreadPool m_ThreadPool;
+  QHash<QString, PipelineJob::Pointer> m_Jobs;
+  std::deque<QString> m_JobOrder;
+  int m_MaxRetainedJobs = 1000;
+  int32_t m_CoresPerJob = 0;
+  PipelineJobScheduler::Pointer m_Scheduler;
+
+  /**
+   * @brief Removes the oldest finished jobs until no more than m_MaxRetainedJobs of them are left. m_Mutex must be locked.
+   */
+  void removeExpiredJobs();
+
+  /**
+   * @brief Preflights the job on the calling worker thread and asks the scheduler for its resources. The job's
+   * execution is started on the thread pool once the scheduler admitted it.
+   * @param job
+   * @param cores
+   */
+  void preflightJob(const PipelineJob::Pointer& job, int32_t cores);
+
+public:
+  PipelineJobManager(const PipelineJobManager&) = delete;            // Copy Constructor Not Implemented
+  PipelineJobManager(PipelineJobManager&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJobManager& operator=(const PipelineJobManager&) = delete; // Copy Assignment Not Implemented
+  PipelineJobManager& operator=(PipelineJobManager&&) = delete;      // Move Assignment Not Implemented
+};
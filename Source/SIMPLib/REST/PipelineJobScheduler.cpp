@@ -0,0 +1,384 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineJobScheduler.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include <QtCore/QThread>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#elif defined(Q_OS_MAC)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+uint64_t GetArraySize(const IDataArray::Pointer& array)
+{
+  if(nullptr == array)
+  {
+    return 0;
+  }
+  return static_cast<uint64_t>(array->getNumberOfTuples()) * static_cast<uint64_t>(array->getNumberOfComponents()) * static_cast<uint64_t>(array->getTypeSize());
+}
+
+// -----------------------------------------------------------------------------
+uint64_t GetGeometrySize(const IGeometry::Pointer& geom)
+{
+  std::vector<IDataArray::Pointer> arrays = {geom->getElementSizes(), geom->getElementCentroids()};
+  if(VertexGeom::Pointer vertexGeom = std::dynamic_pointer_cast<VertexGeom>(geom))
+  {
+    arrays.push_back(vertexGeom->getVertices());
+  }
+  else if(EdgeGeom::Pointer edgeGeom = std::dynamic_pointer_cast<EdgeGeom>(geom))
+  {
+    arrays.push_back(edgeGeom->getVertices());
+    arrays.push_back(edgeGeom->getEdges());
+  }
+  else if(IGeometry2D::Pointer geom2D = std::dynamic_pointer_cast<IGeometry2D>(geom))
+  {
+    arrays.push_back(geom2D->getVertices());
+    arrays.push_back(geom2D->getEdges());
+    arrays.push_back(geom2D->getUnsharedEdges());
+    if(TriangleGeom::Pointer triangleGeom = std::dynamic_pointer_cast<TriangleGeom>(geom))
+    {
+      arrays.push_back(triangleGeom->getTriangles());
+    }
+    else if(QuadGeom::Pointer quadGeom = std::dynamic_pointer_cast<QuadGeom>(geom))
+    {
+      arrays.push_back(quadGeom->getQuads());
+    }
+  }
+  else if(IGeometry3D::Pointer geom3D = std::dynamic_pointer_cast<IGeometry3D>(geom))
+  {
+    arrays.push_back(geom3D->getVertices());
+    arrays.push_back(geom3D->getEdges());
+    arrays.push_back(geom3D->getUnsharedEdges());
+    arrays.push_back(geom3D->getUnsharedFaces());
+    if(TetrahedralGeom::Pointer tetGeom = std::dynamic_pointer_cast<TetrahedralGeom>(geom))
+    {
+      arrays.push_back(tetGeom->getTriangles());
+      arrays.push_back(tetGeom->getTetrahedra());
+    }
+    else if(HexahedralGeom::Pointer hexGeom = std::dynamic_pointer_cast<HexahedralGeom>(geom))
+    {
+      arrays.push_back(hexGeom->getQuads());
+      arrays.push_back(hexGeom->getHexahedra());
+    }
+  }
+  else if(RectGridGeom::Pointer rectGridGeom = std::dynamic_pointer_cast<RectGridGeom>(geom))
+  {
+    arrays.push_back(rectGridGeom->getXBounds());
+    arrays.push_back(rectGridGeom->getYBounds());
+    arrays.push_back(rectGridGeom->getZBounds());
+  }
+
+  uint64_t numBytes = 0;
+  for(const IDataArray::Pointer& array : arrays)
+  {
+    numBytes += GetArraySize(array);
+  }
+  return numBytes;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+PipelineJobScheduler::PipelineJobScheduler()
+{
+  // Leave a quarter of the memory to the operating system, the server itself and temporary filter allocations
+  m_MemoryBudget = GetPhysicalMemorySize() / 4 * 3;
+  m_CoreBudget = std::max(1, QThread::idealThreadCount());
+}
+
+// -----------------------------------------------------------------------------
+PipelineJobScheduler::~PipelineJobScheduler() = default;
+
+// -----------------------------------------------------------------------------
+PipelineJobScheduler::Pointer PipelineJobScheduler::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+PipelineJobScheduler::Pointer PipelineJobScheduler::New()
+{
+  Pointer sharedPtr(new PipelineJobScheduler());
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PipelineJobScheduler::EstimateDataSize(const DataContainerArray& dca)
+{
+  uint64_t numBytes = 0;
+  for(const DataContainer::Pointer& dc : dca.getDataContainers())
+  {
+    IGeometry::Pointer geom = dc->getGeometry();
+    if(nullptr != geom)
+    {
+      numBytes += GetGeometrySize(geom);
+    }
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      for(const IDataArray::Pointer& array : *am)
+      {
+        numBytes += GetArraySize(array);
+      }
+    }
+  }
+  return numBytes;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PipelineJobScheduler::EstimatePeakMemory(FilterPipeline& pipeline)
+{
+  uint64_t peak = 0;
+  for(const AbstractFilter::Pointer& filter : pipeline.getFilterContainer())
+  {
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    if(filter->getEnabled() && nullptr != dca)
+    {
+      peak = std::max(peak, EstimateDataSize(*dca));
+    }
+  }
+  return peak;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PipelineJobScheduler::GetPhysicalMemorySize()
+{
+#if defined(Q_OS_WIN)
+  MEMORYSTATUSEX status;
+  status.dwLength = sizeof(status);
+  if(GlobalMemoryStatusEx(&status) == 0)
+  {
+    return 0;
+  }
+  return static_cast<uint64_t>(status.ullTotalPhys);
+#elif defined(Q_OS_MAC)
+  int mib[2] = {CTL_HW, HW_MEMSIZE};
+  uint64_t memSize = 0;
+  size_t length = sizeof(memSize);
+  if(sysctl(mib, 2, &memSize, &length, nullptr, 0) != 0)
+  {
+    return 0;
+  }
+  return memSize;
+#else
+  long numPages = sysconf(_SC_PHYS_PAGES);
+  long pageSize = sysconf(_SC_PAGE_SIZE);
+  if(numPages <= 0 || pageSize <= 0)
+  {
+    return 0;
+  }
+  return static_cast<uint64_t>(numPages) * static_cast<uint64_t>(pageSize);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::setMemoryBudget(uint64_t value)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_MemoryBudget = value;
+  processRequests(locker);
+}
+
+// -----------------------------------------------------------------------------
+uint64_t PipelineJobScheduler::getMemoryBudget() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::setCoreBudget(int32_t value)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_CoreBudget = std::max(value, 1);
+  processRequests(locker);
+}
+
+// -----------------------------------------------------------------------------
+int32_t PipelineJobScheduler::getCoreBudget() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_CoreBudget;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::setMaxPassOvers(int32_t value)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_MaxPassOvers = std::max(value, 0);
+}
+
+// -----------------------------------------------------------------------------
+int32_t PipelineJobScheduler::getMaxPassOvers() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MaxPassOvers;
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::request(uint64_t memory, int32_t cores, const std::function<bool()>& isCanceled, const AdmissionCallback& callback)
+{
+  Request request;
+  request.Memory = memory;
+  request.Cores = cores;
+  request.IsCanceled = isCanceled;
+  request.Callback = callback;
+  request.WaitTimer.start();
+
+  QMutexLocker locker(&m_Mutex);
+  m_Requests.push_back(std::move(request));
+  processRequests(locker);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::release(const Grant& grant)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_MemoryInUse -= std::min(grant.Memory, m_MemoryInUse);
+  m_CoresInUse = std::max(m_CoresInUse - grant.Cores, 0);
+  processRequests(locker);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::processRequests()
+{
+  QMutexLocker locker(&m_Mutex);
+  processRequests(locker);
+}
+
+// -----------------------------------------------------------------------------
+void PipelineJobScheduler::processRequests(QMutexLocker& locker)
+{
+  std::vector<std::tuple<AdmissionCallback, Admission, Grant>> decisions;
+  for(auto iter = m_Requests.begin(); iter != m_Requests.end();)
+  {
+    Request& request = *iter;
+    Admission admission = Admission::Admitted;
+    Grant grant;
+    if(request.IsCanceled && request.IsCanceled())
+    {
+      admission = Admission::Canceled;
+    }
+    // The budget may have shrunk while the job was waiting
+    else if(m_MemoryBudget > 0 && request.Memory > m_MemoryBudget)
+    {
+      admission = Admission::Rejected;
+      m_NumRejected++;
+    }
+    else
+    {
+      const int32_t requestedCores = (request.Cores <= 0) ? m_CoreBudget : std::min(request.Cores, m_CoreBudget);
+      const bool memoryFits = (m_MemoryBudget == 0 || m_MemoryInUse + request.Memory <= m_MemoryBudget);
+      const bool coresFit = (m_CoresInUse + requestedCores <= m_CoreBudget);
+      if(!memoryFits || !coresFit)
+      {
+        if(iter == m_Requests.begin() && request.PassOvers >= m_MaxPassOvers)
+        {
+          // The oldest request was passed over often enough, the ones behind it have to wait for it
+          break;
+        }
+        ++iter;
+        continue;
+      }
+
+      grant.Memory = request.Memory;
+      grant.Cores = requestedCores;
+      m_MemoryInUse += grant.Memory;
+      m_CoresInUse += grant.Cores;
+      const qint64 waitTime = request.WaitTimer.elapsed();
+      m_NumAdmitted++;
+      m_TotalAdmissionWaitTime += waitTime;
+      m_MaxAdmissionWaitTime = std::max(m_MaxAdmissionWaitTime, waitTime);
+      if(iter != m_Requests.begin())
+      {
+        m_Requests.front().PassOvers++;
+      }
+    }
+
+    decisions.emplace_back(std::move(request.Callback), admission, grant);
+    iter = m_Requests.erase(iter);
+  }
+
+  // The callbacks may start jobs or request resources again
+  locker.unlock();
+  for(const auto& decision : decisions)
+  {
+    if(std::get<0>(decision))
+    {
+      std::get<0>(decision)(std::get<1>(decision), std::get<2>(decision));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJobScheduler::getMetrics() const
+{
+  QMutexLocker locker(&m_Mutex);
+  QJsonObject obj;
+  obj[SIMPL::JSON::MemoryBudget] = static_cast<qint64>(m_MemoryBudget);
+  obj[SIMPL::JSON::MemoryInUse] = static_cast<qint64>(m_MemoryInUse);
+  obj[SIMPL::JSON::CoreBudget] = m_CoreBudget;
+  obj[SIMPL::JSON::CoresInUse] = m_CoresInUse;
+  obj[SIMPL::JSON::WaitingForResources] = static_cast<int>(m_Requests.size());
+  obj[SIMPL::JSON::AdmittedJobs] = static_cast<qint64>(m_NumAdmitted);
+  obj[SIMPL::JSON::RejectedJobs] = static_cast<qint64>(m_NumRejected);
+  obj[SIMPL::JSON::AverageAdmissionWaitTime] = (m_NumAdmitted == 0) ? 0.0 : static_cast<double>(m_TotalAdmissionWaitTime) / static_cast<double>(m_NumAdmitted);
+  obj[SIMPL::JSON::MaxAdmissionWaitTime] = m_MaxAdmissionWaitTime;
+  return obj;
+}
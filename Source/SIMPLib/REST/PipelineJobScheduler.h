@@ -0,0 +1,232 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+#include "SIMPLib/SIMPLib.h"
+
+class DataContainerArray;
+class FilterPipeline;
+
+/**
+ * @brief The PipelineJobScheduler class decides when a preflighted pipeline job of the REST server may start executing.
+ * Each job requests the peak memory its pipeline is estimated to need and the number of cores its pipeline will use.
+ * Requests never block: they wait in a queue and the caller is told through a callback once the request was admitted,
+ * rejected or canceled. The queue is worked through whenever a request arrives, resources are released or a budget
+ * changes. A job whose estimate is larger than the whole memory budget is rejected instead of waiting forever.
+ *
+ * Requests are looked at in the order they arrived. A request that does not fit yet does not hold up the requests
+ * behind it, so a large job does not leave the machine idle while small jobs wait. To keep a stream of small jobs
+ * from starving it, the oldest waiting request may only be passed over getMaxPassOvers() times. After that no later
+ * request is admitted until the oldest one was.
+ *
+ * The memory estimate comes from the DataContainerArray snapshots that a preflight leaves with each filter: every
+ * snapshot describes the data structure after its filter, so the largest of them approximates the peak amount of
+ * attribute and geometry array data the pipeline holds while it executes. Memory that filters allocate temporarily is
+ * not part of the estimate.
+ */
+class SIMPLib_EXPORT PipelineJobScheduler
+{
+public:
+  using Self = PipelineJobScheduler;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Creates a scheduler with a memory budget of three quarters of the physical memory and a core budget of all cores
+   * @return
+   */
+  static Pointer New();
+
+  virtual ~PipelineJobScheduler();
+
+  enum class Admission : unsigned int
+  {
+    Admitted,
+    Rejected,
+    Canceled
+  };
+
+  /**
+   * @brief The resources reserved for an admitted request. They are handed back to release() exactly as they were
+   * granted, so budget changes while the job executes do not change what is returned.
+   */
+  struct Grant
+  {
+    uint64_t Memory = 0;
+    int32_t Cores = 0;
+  };
+
+  using AdmissionCallback = std::function<void(Admission, const Grant&)>;
+
+  /**
+   * @brief Returns the number of bytes the attribute arrays and the geometry arrays of the given data structure need
+   * @param dca
+   * @return
+   */
+  static uint64_t EstimateDataSize(const DataContainerArray& dca);
+
+  /**
+   * @brief Returns the peak number of bytes the arrays of the given preflighted pipeline are estimated to need
+   * @param pipeline
+   * @return
+   */
+  static uint64_t EstimatePeakMemory(FilterPipeline& pipeline);
+
+  /**
+   * @brief Returns the physical memory of the machine in bytes or 0 if it can not be determined
+   * @return
+   */
+  static uint64_t GetPhysicalMemorySize();
+
+  /**
+   * @brief Sets the number of bytes all executing jobs may use together. 0 removes the limit.
+   * @param value
+   */
+  void setMemoryBudget(uint64_t value);
+
+  /**
+   * @brief Returns the number of bytes all executing jobs may use together. 0 means there is no limit.
+   * @return
+   */
+  uint64_t getMemoryBudget() const;
+
+  /**
+   * @brief Sets the number of cores all executing jobs may use together. Values smaller than 1 are clamped to 1.
+   * @param value
+   */
+  void setCoreBudget(int32_t value);
+
+  /**
+   * @brief Returns the number of cores all executing jobs may use together
+   * @return
+   */
+  int32_t getCoreBudget() const;
+
+  /**
+   * @brief Sets how often the oldest waiting request may be passed over by requests that arrived after it. 0 admits
+   * the requests strictly in the order they arrived.
+   * @param value
+   */
+  void setMaxPassOvers(int32_t value);
+
+  /**
+   * @brief Returns how often the oldest waiting request may be passed over by requests that arrived after it
+   * @return
+   */
+  int32_t getMaxPassOvers() const;
+
+  /**
+   * @brief Queues a request for the given memory and cores and returns right away. Requests for more cores than the
+   * core budget are reduced to the core budget. The callback is called exactly once, without the scheduler's lock
+   * held and on the thread that happens to work through the queue: with Admitted and the reserved resources once they
+   * were reserved, with Rejected if the memory request exceeds the memory budget and with Canceled if isCanceled
+   * returned true first. The grant is empty unless the request was admitted.
+   * @param memory Estimated peak memory of the job in bytes
+   * @param cores Number of cores the job will use. 0 asks for the whole core budget.
+   * @param isCanceled Checked whenever the queue is worked through. May be empty.
+   * @param callback
+   */
+  void request(uint64_t memory, int32_t cores, const std::function<bool()>& isCanceled, const AdmissionCallback& callback);
+
+  /**
+   * @brief Returns the resources that were granted to an admitted request and admits the waiting requests that fit now
+   * @param grant The grant the request's callback received
+   */
+  void release(const Grant& grant);
+
+  /**
+   * @brief Works through the waiting requests again, e.g. after one of them was canceled
+   */
+  void processRequests();
+
+  /**
+   * @brief Returns the budgets, the resources in use, the number of waiting jobs and admission statistics as json
+   * @return
+   */
+  QJsonObject getMetrics() const;
+
+protected:
+  PipelineJobScheduler();
+
+private:
+  struct Request
+  {
+    uint64_t Memory = 0;
+    int32_t Cores = 0;
+    std::function<bool()> IsCanceled;
+    AdmissionCallback Callback;
+    QElapsedTimer WaitTimer;
+    int32_t PassOvers = 0;
+  };
+
+  mutable QMutex m_Mutex;
+
+  uint64_t m_MemoryBudget = 0;
+  int32_t m_CoreBudget = 1;
+  uint64_t m_MemoryInUse = 0;
+  int32_t m_CoresInUse = 0;
+  int32_t m_MaxPassOvers = 4;
+
+  std::deque<Request> m_Requests;
+
+  uint64_t m_NumAdmitted = 0;
+  uint64_t m_NumRejected = 0;
+  qint64 m_TotalAdmissionWaitTime = 0;
+  qint64 m_MaxAdmissionWaitTime = 0;
+
+  /**
+   * @brief Admits, rejects and drops the waiting requests and calls their callbacks once m_Mutex was unlocked
+   * @param locker Holds m_Mutex
+   */
+  void processRequests(QMutexLocker& locker);
+
+public:
+  PipelineJobScheduler(const PipelineJobScheduler&) = delete;            // Copy Constructor Not Implemented
+  PipelineJobScheduler(PipelineJobScheduler&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJobScheduler& operator=(const PipelineJobScheduler&) = delete; // Copy Assignment Not Implemented
+  PipelineJobScheduler& operator=(PipelineJobScheduler&&) = delete;      // Move Assignment Not Implemented
+};
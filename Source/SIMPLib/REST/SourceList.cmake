@@ -20,6 +20,11 @@ set(SIMPLib_${SUBDIR_NAME}_Moc_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ApiNotFoundController.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLStaticFileController.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLibVersionController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SubmitPipelineController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobStatusController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/CancelPipelineJobController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobResultController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobMetricsController.h
 )
 
 # --------------------------------------------------------------------
@@ -30,6 +35,9 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListenerMessageHandler.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJob.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJobManager.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJobScheduler.h
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ExecutePipelineMessageHandler.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PreflightPipelineMessageHandler.h
@@ -41,6 +49,9 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListener.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListenerMessageHandler.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDirectoryListing.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJob.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJobManager.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJobScheduler.cpp
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/NumFiltersController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/V1RequestMapper.cpp
@@ -56,6 +67,11 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ApiNotFoundController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLStaticFileController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLibVersionController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SubmitPipelineController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobStatusController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/CancelPipelineJobController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobResultController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobMetricsController.cpp
 
 )
 
@@ -33,7 +33,14 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <numeric>
+
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonParseError>
@@ -72,6 +79,9 @@
 #include "SIMPLib/Plugin/PluginManager.h"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/REST/PipelineJob.h"
+#include "SIMPLib/REST/PipelineJobManager.h"
+#include "SIMPLib/REST/PipelineJobScheduler.h"
 #include "SIMPLib/REST/PipelineListener.h"
 #include "SIMPLib/REST/SIMPLRequestMapper.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
@@ -345,6 +355,454 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray readRESTPipeline()
+  {
+    QFile file(UnitTest::RestUnitTest::RESTPipelineFilePath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true);
+    return file.readAll();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject sendJobRequest(const QString& endPoint, const QString& jobId, QNetworkReply::NetworkError expectedError, int waitTime = 0)
+  {
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/" + endPoint);
+
+    QJsonObject rootObj;
+    rootObj[SIMPL::JSON::JobId] = jobId;
+    if(waitTime > 0)
+    {
+      rootObj[SIMPL::JSON::WaitTime] = waitTime;
+    }
+
+    QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QJsonDocument(rootObj).toJson());
+    DREAM3D_REQUIRE_EQUAL(reply->error(), expectedError);
+
+    QJsonParseError jsonParseError;
+    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll(), &jsonParseError);
+    DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
+    return doc.object();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString submitRESTPipeline()
+  {
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/SubmitPipeline");
+
+    QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", readRESTPipeline());
+    DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+    DREAM3D_REQUIRE_EQUAL(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), 202);
+
+    QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobId].isString(), true);
+    DREAM3D_REQUIRE_EQUAL(responseObject.contains(SIMPL::JSON::JobState), true);
+    return responseObject[SIMPL::JSON::JobId].toString();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSubmitPipeline()
+  {
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/SubmitPipeline");
+
+    // Test 'Incorrect Content Type'
+    {
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "text/plain", QByteArray());
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ProtocolInvalidOperationError);
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -20);
+    }
+
+    // Test 'JSON Parse Error'
+    {
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QByteArray::fromStdString("{ CreateAttributeMatrix"));
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ProtocolInvalidOperationError);
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -40);
+    }
+
+    // Test 'Pipeline Could Not Be Created'
+    {
+      QJsonObject rootObj;
+      rootObj["Foo"] = "{ }";
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QJsonDocument(rootObj).toJson());
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ProtocolInvalidOperationError);
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -50);
+    }
+
+    // Test 'Unknown Job'
+    {
+      QJsonObject responseObject = sendJobRequest("PipelineJobStatus", "NotAJobId", QNetworkReply::ContentNotFoundError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -70);
+      responseObject = sendJobRequest("PipelineJobResult", "NotAJobId", QNetworkReply::ContentNotFoundError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -70);
+      responseObject = sendJobRequest("CancelPipelineJob", "NotAJobId", QNetworkReply::ContentNotFoundError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -70);
+    }
+
+    // Test submitting, long polling and picking up the result of a job
+    {
+      QString jobId = submitRESTPipeline();
+
+      int nextMessageIndex = 0;
+      QString jobState;
+      for(int i = 0; i < 100; i++)
+      {
+        QUrl statusUrl = getConnectionURL();
+        statusUrl.setPath("/api/v1/PipelineJobStatus");
+        QJsonObject rootObj;
+        rootObj[SIMPL::JSON::JobId] = jobId;
+        rootObj[SIMPL::JSON::MessageIndex] = nextMessageIndex;
+        rootObj[SIMPL::JSON::WaitTime] = 5000;
+        QSharedPointer<QNetworkReply> reply = sendRequest(statusUrl, "application/json", QJsonDocument(rootObj).toJson());
+        DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+
+        QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+        DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobId].toString(), jobId);
+        DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Messages].isArray(), true);
+
+        // Only the messages since the last request come back and they are numbered consecutively
+        QJsonArray messages = responseObject[SIMPL::JSON::Messages].toArray();
+        for(const QJsonValue& message : messages)
+        {
+          DREAM3D_REQUIRE_EQUAL(message.toObject()[SIMPL::JSON::MessageIndex].toInt(), nextMessageIndex);
+          nextMessageIndex++;
+        }
+        DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::NextMessageIndex].toInt(), nextMessageIndex);
+
+        jobState = responseObject[SIMPL::JSON::JobState].toString();
+        if(jobState != "Queued" && jobState != "Running")
+        {
+          DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Progress].toInt(), 100);
+          break;
+        }
+      }
+      DREAM3D_REQUIRE_EQUAL(jobState, QString("Completed"));
+      DREAM3D_REQUIRE(nextMessageIndex > 0);
+
+      QJsonObject responseObject = sendJobRequest("PipelineJobResult", jobId, QNetworkReply::NoError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), true);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::PipelineErrors].toArray().size(), 0);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::PipelineWarnings].toArray().size(), 0);
+
+      // A finished job can not be canceled anymore
+      responseObject = sendJobRequest("CancelPipelineJob", jobId, QNetworkReply::ContentConflictError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -80);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCancelPipelineJob()
+  {
+    // A job that is canceled before a worker thread picks it up never runs
+    {
+      PipelineJob::Pointer job = PipelineJob::New("QueuedJob", QJsonDocument::fromJson(readRESTPipeline()).object());
+      DREAM3D_REQUIRE_EQUAL(job->getResult().isEmpty(), true);
+      DREAM3D_REQUIRE_EQUAL(job->cancel(), true);
+      DREAM3D_REQUIRE(job->getState() == PipelineJob::State::Canceled);
+      job->run();
+      DREAM3D_REQUIRE(job->getState() == PipelineJob::State::Canceled);
+      DREAM3D_REQUIRE_EQUAL(job->getMessageCount(), 0);
+      DREAM3D_REQUIRE_EQUAL(job->cancel(), false);
+      DREAM3D_REQUIRE_EQUAL(job->getResult()[SIMPL::JSON::Completed].toBool(), false);
+    }
+
+    // Through the REST API the job may already be finished by the time the cancel request arrives
+    {
+      QString jobId = submitRESTPipeline();
+
+      QUrl url = getConnectionURL();
+      url.setPath("/api/v1/CancelPipelineJob");
+      QJsonObject rootObj;
+      rootObj[SIMPL::JSON::JobId] = jobId;
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QJsonDocument(rootObj).toJson());
+      bool canceled = (reply->error() == QNetworkReply::NoError);
+      if(!canceled)
+      {
+        DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ContentConflictError);
+      }
+
+      PipelineJob::Pointer job = PipelineJobManager::Instance()->getJob(jobId);
+      DREAM3D_REQUIRE_VALID_POINTER(job.get());
+      DREAM3D_REQUIRE_EQUAL(job->waitForFinished(30000), true);
+
+      QJsonObject responseObject = sendJobRequest("PipelineJobResult", jobId, QNetworkReply::NoError);
+      QString jobState = responseObject[SIMPL::JSON::JobState].toString();
+      DREAM3D_REQUIRE(jobState == "Canceled" || jobState == "Completed");
+      if(!canceled)
+      {
+        DREAM3D_REQUIRE_EQUAL(jobState, QString("Completed"));
+      }
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), jobState == "Completed");
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineJobLoad()
+  {
+    const int numJobs = 64;
+    QByteArray pipelineData = readRESTPipeline();
+
+    // Baseline: one synchronous ExecutePipeline request ties up the connection until the pipeline is done
+    QUrl executeUrl = getConnectionURL();
+    executeUrl.setPath("/api/v1/ExecutePipeline");
+    QElapsedTimer timer;
+    timer.start();
+    {
+      QSharedPointer<QNetworkReply> reply = sendRequest(executeUrl, "application/json", pipelineData);
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+    }
+    qint64 executeLatency = timer.elapsed();
+
+    // Submit all jobs at once and record how long each submission takes to come back
+    QUrl submitUrl = getConnectionURL();
+    submitUrl.setPath("/api/v1/SubmitPipeline");
+    QNetworkRequest netRequest(submitUrl);
+    netRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    std::vector<QSharedPointer<QNetworkReply>> replies(numJobs);
+    std::vector<qint64> submitLatencies(numJobs, 0);
+    int numPending = numJobs;
+    QEventLoop waitLoop;
+    timer.restart();
+    for(int i = 0; i < numJobs; i++)
+    {
+      qint64 startTime = timer.elapsed();
+      replies[i] = QSharedPointer<QNetworkReply>(m_Connection->post(netRequest, pipelineData));
+      QObject::connect(replies[i].data(), &QNetworkReply::finished, [&, i, startTime]() {
+        submitLatencies[i] = timer.elapsed() - startTime;
+        if(--numPending == 0)
+        {
+          waitLoop.quit();
+        }
+      });
+    }
+    waitLoop.exec();
+    qint64 submitTime = timer.elapsed();
+
+    std::vector<PipelineJob::Pointer> jobs;
+    for(const auto& reply : replies)
+    {
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      PipelineJob::Pointer job = PipelineJobManager::Instance()->getJob(responseObject[SIMPL::JSON::JobId].toString());
+      DREAM3D_REQUIRE_VALID_POINTER(job.get());
+      jobs.push_back(job);
+    }
+
+    for(const auto& job : jobs)
+    {
+      DREAM3D_REQUIRE_EQUAL(job->waitForFinished(60000), true);
+      DREAM3D_REQUIRE(job->getState() == PipelineJob::State::Completed);
+    }
+    qint64 totalTime = timer.elapsed();
+
+    std::sort(submitLatencies.begin(), submitLatencies.end());
+    double meanLatency = std::accumulate(submitLatencies.begin(), submitLatencies.end(), 0.0) / numJobs;
+    std::cout << "ExecutePipeline latency: " << executeLatency << " ms" << std::endl;
+    std::cout << "SubmitPipeline latency for " << numJobs << " concurrent jobs (" << PipelineJobManager::Instance()->getMaxConcurrentJobs() << " workers): mean " << meanLatency << " ms, median "
+              << submitLatencies[numJobs / 2] << " ms, max " << submitLatencies.back() << " ms" << std::endl;
+    std::cout << "All jobs submitted after " << submitTime << " ms and finished after " << totalTime << " ms (" << (numJobs * 1000.0 / std::max<qint64>(totalTime, 1)) << " jobs/s)" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineJobScheduler()
+  {
+    // The preflight snapshots are enough to estimate the memory of the pipeline
+    uint64_t estimatedMemory = 0;
+    {
+      FilterPipeline::Pointer pipeline = FilterPipeline::FromJson(QJsonDocument::fromJson(readRESTPipeline()).object());
+      DREAM3D_REQUIRE_VALID_POINTER(pipeline.get());
+      pipeline->preflightPipeline();
+      estimatedMemory = PipelineJobScheduler::EstimatePeakMemory(*pipeline);
+      DREAM3D_REQUIRE(estimatedMemory > 0);
+    }
+
+    PipelineJobScheduler::Pointer scheduler = PipelineJobScheduler::New();
+    DREAM3D_REQUIRE(scheduler->getCoreBudget() >= 1);
+    scheduler->setMemoryBudget(1000);
+    scheduler->setCoreBudget(4);
+
+    // Requests never block, the decisions arrive through the callbacks
+    using Admission = PipelineJobScheduler::Admission;
+    std::map<int, Admission> decisions;
+    std::map<int, PipelineJobScheduler::Grant> grants;
+    auto request = [&](int id, uint64_t memory, int32_t cores, const std::function<bool()>& isCanceled) {
+      scheduler->request(memory, cores, isCanceled, [&decisions, &grants, id](Admission admission, const PipelineJobScheduler::Grant& grant) {
+        decisions[id] = admission;
+        grants[id] = grant;
+      });
+    };
+
+    // Requests larger than the whole budget are rejected instead of waiting forever
+    request(0, 2000, 1, nullptr);
+    DREAM3D_REQUIRE(decisions.at(0) == Admission::Rejected);
+    request(1, 600, 2, nullptr);
+    DREAM3D_REQUIRE(decisions.at(1) == Admission::Admitted);
+
+    // The memory of the next job does not fit next to the first one, so it waits
+    request(2, 600, 2, nullptr);
+    DREAM3D_REQUIRE_EQUAL(decisions.count(2), 0);
+    // A smaller job behind it fits and does not have to wait for it
+    request(3, 300, 1, nullptr);
+    DREAM3D_REQUIRE(decisions.at(3) == Admission::Admitted);
+
+    // A canceled job leaves the queue the next time the scheduler works through it
+    bool canceled = false;
+    request(4, 600, 1, [&canceled]() { return canceled; });
+    DREAM3D_REQUIRE_EQUAL(decisions.count(4), 0);
+    QJsonObject metrics = scheduler->getMetrics();
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::WaitingForResources].toInt(), 2);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::MemoryInUse].toInt(), 900);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::CoresInUse].toInt(), 3);
+    canceled = true;
+    scheduler->processRequests();
+    DREAM3D_REQUIRE(decisions.at(4) == Admission::Canceled);
+    DREAM3D_REQUIRE_EQUAL(grants.at(4).Cores, 0);
+    DREAM3D_REQUIRE_EQUAL(grants.at(1).Memory, 600);
+    DREAM3D_REQUIRE_EQUAL(grants.at(1).Cores, 2);
+
+    // Releasing the first job's resources admits the waiting one
+    scheduler->release(grants.at(1));
+    DREAM3D_REQUIRE(decisions.at(2) == Admission::Admitted);
+    metrics = scheduler->getMetrics();
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::WaitingForResources].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::MemoryInUse].toInt(), 900);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::CoresInUse].toInt(), 3);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::AdmittedJobs].toInt(), 3);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::RejectedJobs].toInt(), 1);
+    scheduler->release(grants.at(2));
+    scheduler->release(grants.at(3));
+
+    // The oldest waiting job is only passed over a limited number of times
+    decisions.clear();
+    scheduler->setMaxPassOvers(2);
+    request(10, 600, 1, nullptr);
+    request(11, 600, 1, nullptr);
+    for(int i = 0; i < 3; i++)
+    {
+      request(12 + i, 100, 1, nullptr);
+    }
+    DREAM3D_REQUIRE(decisions.at(10) == Admission::Admitted);
+    DREAM3D_REQUIRE_EQUAL(decisions.count(11), 0);
+    DREAM3D_REQUIRE(decisions.at(12) == Admission::Admitted);
+    DREAM3D_REQUIRE(decisions.at(13) == Admission::Admitted);
+    DREAM3D_REQUIRE_EQUAL(decisions.count(14), 0);
+    scheduler->release(grants.at(10));
+    DREAM3D_REQUIRE(decisions.at(11) == Admission::Admitted);
+    DREAM3D_REQUIRE(decisions.at(14) == Admission::Admitted);
+    scheduler->release(grants.at(11));
+    for(int i = 0; i < 3; i++)
+    {
+      scheduler->release(grants.at(12 + i));
+    }
+    metrics = scheduler->getMetrics();
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::MemoryInUse].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::CoresInUse].toInt(), 0);
+
+    // A job that asked for the whole core budget gives back the cores it was granted, even if the budget changed since
+    scheduler->setMaxPassOvers(4);
+    request(20, 100, 0, nullptr);
+    DREAM3D_REQUIRE(decisions.at(20) == Admission::Admitted);
+    DREAM3D_REQUIRE_EQUAL(grants.at(20).Cores, 4);
+    scheduler->setCoreBudget(2);
+    scheduler->release(grants.at(20));
+    metrics = scheduler->getMetrics();
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::MemoryInUse].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::CoresInUse].toInt(), 0);
+    scheduler->setCoreBudget(8);
+    request(21, 100, 0, nullptr);
+    DREAM3D_REQUIRE_EQUAL(grants.at(21).Cores, 8);
+    scheduler->release(grants.at(21));
+    metrics = scheduler->getMetrics();
+    DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::CoresInUse].toInt(), 0);
+
+    // A job that can never fit fails after its preflight without executing
+    PipelineJobManager* jobManager = PipelineJobManager::Instance();
+    PipelineJobScheduler::Pointer jobScheduler = jobManager->getScheduler();
+    const uint64_t memoryBudget = jobScheduler->getMemoryBudget();
+    {
+      jobScheduler->setMemoryBudget(estimatedMemory - 1);
+      PipelineJob::Pointer job = jobManager->submit(QJsonDocument::fromJson(readRESTPipeline()).object());
+      DREAM3D_REQUIRE_EQUAL(job->waitForFinished(60000), true);
+      DREAM3D_REQUIRE(job->getState() == PipelineJob::State::Failed);
+      DREAM3D_REQUIRE_EQUAL(job->getEstimatedMemory(), estimatedMemory);
+      QJsonArray errors = job->getResult()[SIMPL::JSON::PipelineErrors].toArray();
+      DREAM3D_REQUIRE_EQUAL(errors.size(), 1);
+      DREAM3D_REQUIRE_EQUAL(errors[0].toObject()[SIMPL::JSON::Code].toInt(), -300);
+    }
+
+    // A job that fits is admitted and gives its resources back once it is done
+    {
+      jobScheduler->setMemoryBudget(estimatedMemory);
+      PipelineJob::Pointer job = jobManager->submit(QJsonDocument::fromJson(readRESTPipeline()).object());
+      DREAM3D_REQUIRE_EQUAL(job->waitForFinished(60000), true);
+      DREAM3D_REQUIRE(job->getState() == PipelineJob::State::Completed);
+      metrics = jobScheduler->getMetrics();
+      DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::MemoryInUse].toInt(), 0);
+      DREAM3D_REQUIRE_EQUAL(metrics[SIMPL::JSON::CoresInUse].toInt(), 0);
+    }
+    jobScheduler->setMemoryBudget(memoryBudget);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineJobMetrics()
+  {
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/PipelineJobMetrics");
+
+    // Test 'Incorrect Content Type'
+    {
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "text/plain", QByteArray());
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ProtocolInvalidOperationError);
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -20);
+    }
+
+    // The jobs of the previous tests are finished, so nothing waits and the budgets are unused
+    {
+      DREAM3D_REQUIRE_EQUAL(PipelineJobManager::Instance()->waitForDone(60000), true);
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QByteArray());
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+
+      QJsonObject jobs = responseObject[SIMPL::JSON::Jobs].toObject();
+      DREAM3D_REQUIRE_EQUAL(jobs["Queued"].toInt(), 0);
+      DREAM3D_REQUIRE_EQUAL(jobs["Running"].toInt(), 0);
+      DREAM3D_REQUIRE(jobs["Completed"].toInt() > 0);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::QueueDepth].toInt(), 0);
+      DREAM3D_REQUIRE(responseObject[SIMPL::JSON::MaxQueuedTime].toDouble() >= responseObject[SIMPL::JSON::AverageQueuedTime].toDouble());
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::MaxConcurrentJobs].toInt(), PipelineJobManager::Instance()->getMaxConcurrentJobs());
+      DREAM3D_REQUIRE(responseObject[SIMPL::JSON::CoresPerJob].toInt() >= 1);
+
+      QJsonObject scheduler = responseObject[SIMPL::JSON::Scheduler].toObject();
+      DREAM3D_REQUIRE_EQUAL(scheduler[SIMPL::JSON::WaitingForResources].toInt(), 0);
+      DREAM3D_REQUIRE_EQUAL(scheduler[SIMPL::JSON::MemoryInUse].toInt(), 0);
+      DREAM3D_REQUIRE_EQUAL(scheduler[SIMPL::JSON::CoresInUse].toInt(), 0);
+      DREAM3D_REQUIRE(scheduler[SIMPL::JSON::AdmittedJobs].toInt() > 0);
+      DREAM3D_REQUIRE_EQUAL(scheduler[SIMPL::JSON::CoreBudget].toInt(), PipelineJobManager::Instance()->getScheduler()->getCoreBudget());
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1742,6 +2200,11 @@ public:
 
     DREAM3D_REGISTER_TEST(TestExecutePipelineWithFiles());
     DREAM3D_REGISTER_TEST(TestExecutePipeline());
+    DREAM3D_REGISTER_TEST(TestSubmitPipeline());
+    DREAM3D_REGISTER_TEST(TestCancelPipelineJob());
+    DREAM3D_REGISTER_TEST(TestPipelineJobLoad());
+    DREAM3D_REGISTER_TEST(TestPipelineJobScheduler());
+    DREAM3D_REGISTER_TEST(TestPipelineJobMetrics());
 
     DREAM3D_REGISTER_TEST(TestListFilterParameters());
     DREAM3D_REGISTER_TEST(TestLoadedPlugins());
@@ -0,0 +1,131 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CancelPipelineJobController.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/REST/PipelineJobManager.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CancelPipelineJobController::CancelPipelineJobController(const QHostAddress& hostAddress, const int hostPort)
+{
+  setListenHost(hostAddress, hostPort);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CancelPipelineJobController::service(HttpRequest& request, HttpResponse& response)
+{
+  QString content_type = request.getHeader(QByteArray("content-type"));
+  if(content_type.compare("application/json") != 0)
+  {
+    QString errMsg = EndPoint() + ": Content Type is not application/json";
+    sendErrorResponse(response, HttpResponse::HttpStatusCode::BadRequest, errMsg, -20);
+    return;
+  }
+
+  QJsonParseError jsonParseError;
+  QJsonDocument requestDoc = QJsonDocument::fromJson(request.getBody(), &jsonParseError);
+  if(jsonParseError.error != QJsonParseError::ParseError::NoError)
+  {
+    QString errMsg = tr("%1: Error Parsing JSON Request Body - %2").arg(EndPoint()).arg(jsonParseError.errorString());
+    sendErrorResponse(response, HttpResponse::HttpStatusCode::BadRequest, errMsg, -40);
+    return;
+  }
+
+  QJsonObject requestObj = requestDoc.object();
+
+  if(!requestObj[SIMPL::JSON::JobId].isString())
+  {
+    QString errMsg = tr("%1: No JobId string found in the JSON request body.").arg(EndPoint());
+    sendErrorResponse(response, HttpResponse::HttpStatusCode::BadRequest, errMsg, -60);
+    return;
+  }
+
+  PipelineJob::Pointer job = PipelineJobManager::Instance()->getJob(requestObj[SIMPL::JSON::JobId].toString());
+  if(nullptr == job)
+  {
+    QString errMsg = tr("%1: There is no job with the id '%2'.").arg(EndPoint()).arg(requestObj[SIMPL::JSON::JobId].toString());
+    sendErrorResponse(response, HttpResponse::HttpStatusCode::NotFound, errMsg, -70);
+    return;
+  }
+
+  if(!job->cancel())
+  {
+    QString errMsg = tr("%1: The job with the id '%2' is already %3.").arg(EndPoint()).arg(job->getJobId()).arg(PipelineJob::StateToString(job->getState()));
+    sendErrorResponse(response, HttpResponse::HttpStatusCode::Conflict, errMsg, -80);
+    return;
+  }
+
+  QJsonObject responseObj;
+  responseObj[SIMPL::JSON::JobId] = job->getJobId();
+  responseObj[SIMPL::JSON::JobState] = PipelineJob::StateToString(job->getState());
+  sendResponse(response, HttpResponse::HttpStatusCode::OK, responseObj);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CancelPipelineJobController::sendResponse(HttpResponse& response, HttpResponse::HttpStatusCode statusCode, const QJsonObject& responseObj)
+{
+  response.setStatusCode(statusCode);
+  response.setHeader("Content-Type", "application/json");
+
+  QJsonDocument jdoc(responseObj);
+  response.write(jdoc.toJson(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CancelPipelineJobController::sendErrorResponse(HttpResponse& response, HttpResponse::HttpStatusCode statusCode, const QString& errorMsg, int errCode)
+{
+  QJsonObject responseObj;
+  responseObj[SIMPL::JSON::ErrorMessage] = errorMsg;
+  responseObj[SIMPL::JSON::ErrorCode] = errCode;
+  sendResponse(response, statusCode, responseObj);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString CancelPipelineJobController::EndPoint()
+{
+  return QString("CancelPipelineJob");
+}
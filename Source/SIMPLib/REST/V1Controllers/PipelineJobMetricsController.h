@@ -0,0 +1,93 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QJsonObject>
+
+#include "QtWebApp/httpserver/httprequest.h"
+#include "QtWebApp/httpserver/httprequesthandler.h"
+#include "QtWebApp/httpserver/httpresponse.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+/**
+  @brief This class responds to REST API endpoint PipelineJobMetrics. It reports how many asynchronous jobs are in
+  each state, how long they waited in the queue and how much of the scheduler's memory and core budgets is in use.
+
+  The returned JSON is the following on success
+
+  {
+    "Jobs": { "Queued": 3, "Running": 2, "Completed": 10, "Failed": 0, "Canceled": 1 },
+    "QueueDepth": 3,
+    "AverageQueuedTime": 120.5,
+    "MaxQueuedTime": 950,
+    "OldestQueuedTime": 410,
+    "MaxConcurrentJobs": 4,
+    "CoresPerJob": 4,
+    "Scheduler": {
+      "MemoryBudget": 25769803776,
+      "MemoryInUse": 1073741824,
+      "CoreBudget": 16,
+      "CoresInUse": 8,
+      "WaitingForResources": 1,
+      "AdmittedJobs": 12,
+      "RejectedJobs": 0,
+      "AverageAdmissionWaitTime": 35.2,
+      "MaxAdmissionWaitTime": 400
+    }
+  }
+*/
+class SIMPLib_EXPORT PipelineJobMetricsController : public HttpRequestHandler
+{
+  Q_OBJECT
+  Q_DISABLE_COPY(PipelineJobMetricsController)
+public:
+  /** Constructor */
+  PipelineJobMetricsController(const QHostAddress& hostAddress, const int hostPort);
+
+  /** Generates the response */
+  void service(HttpRequest& request, HttpResponse& response) override;
+
+  /**
+   * @brief Returns the name of the end point that is controller uses
+   * @return
+   */
+  static QString EndPoint();
+
+private:
+  void sendResponse(HttpResponse& response, HttpResponse::HttpStatusCode statusCode, const QJsonObject& responseObj);
+  void sendErrorResponse(HttpResponse& response, HttpResponse::HttpStatusCode statusCode, const QString& errorMsg, int errCode);
+};
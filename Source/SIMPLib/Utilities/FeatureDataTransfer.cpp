@@ -0,0 +1,422 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Utilities/FeatureDataTransfer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+namespace
+{
+// Number of cells (or Features) handed to a task at a time. Every array is processed for a block before the next
+// block starts, so the Feature Ids of the block are only read from memory once.
+constexpr size_t k_BlockSize = 16384;
+
+constexpr size_t k_NoCell = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Type erased view of an Element array and the matching Feature array so that arrays of different types
+ * share the same pass over the cells
+ */
+class ITransferPair
+{
+public:
+  ITransferPair() = default;
+  virtual ~ITransferPair() = default;
+
+  virtual void gather(const int32_t* featureIds, size_t begin, size_t end) const = 0;
+  virtual void scatter(const size_t* lastCells, size_t begin, size_t end) const = 0;
+  virtual size_t findFirstMismatch(const int32_t* featureIds, const size_t* firstCells, size_t numFeatures, size_t begin, size_t end) const = 0;
+
+public:
+  ITransferPair(const ITransferPair&) = delete;            // Copy Constructor Not Implemented
+  ITransferPair(ITransferPair&&) = delete;                 // Move Constructor Not Implemented
+  ITransferPair& operator=(const ITransferPair&) = delete; // Copy Assignment Not Implemented
+  ITransferPair& operator=(ITransferPair&&) = delete;      // Move Assignment Not Implemented
+};
+
+template <typename T>
+class TransferPair : public ITransferPair
+{
+public:
+  TransferPair(DataArray<T>& elementArray, DataArray<T>& featureArray)
+  : m_Elements(elementArray.getPointer(0))
+  , m_Features(featureArray.getPointer(0))
+  , m_NumComps(static_cast<size_t>(elementArray.getNumberOfComponents()))
+  {
+  }
+
+  ~TransferPair() override = default;
+
+  void gather(const int32_t* featureIds, size_t begin, size_t end) const override
+  {
+    if(m_NumComps == 1)
+    {
+      // A plain indexed load that the compiler can turn into vector gathers
+      for(size_t i = begin; i < end; i++)
+      {
+        const int32_t featureId = featureIds[i];
+        if(featureId >= 0)
+        {
+          m_Elements[i] = m_Features[featureId];
+        }
+      }
+      return;
+    }
+
+    for(size_t i = begin; i < end; i++)
+    {
+      const int32_t featureId = featureIds[i];
+      if(featureId >= 0)
+      {
+        std::copy_n(m_Features + static_cast<size_t>(featureId) * m_NumComps, m_NumComps, m_Elements + i * m_NumComps);
+      }
+    }
+  }
+
+  void scatter(const size_t* lastCells, size_t begin, size_t end) const override
+  {
+    for(size_t featureId = begin; featureId < end; featureId++)
+    {
+      if(lastCells[featureId] != k_NoCell)
+      {
+        std::copy_n(m_Elements + lastCells[featureId] * m_NumComps, m_NumComps, m_Features + featureId * m_NumComps);
+      }
+    }
+  }
+
+  size_t findFirstMismatch(const int32_t* featureIds, const size_t* firstCells, size_t numFeatures, size_t begin, size_t end) const override
+  {
+    for(size_t i = begin; i < end; i++)
+    {
+      const int32_t featureId = featureIds[i];
+      if(featureId < 0 || static_cast<size_t>(featureId) >= numFeatures)
+      {
+        continue;
+      }
+      const T* firstValue = m_Elements + firstCells[featureId] * m_NumComps;
+      if(!std::equal(firstValue, firstValue + m_NumComps, m_Elements + i * m_NumComps))
+      {
+        return i;
+      }
+    }
+    return k_NoCell;
+  }
+
+private:
+  T* m_Elements = nullptr;
+  T* m_Features = nullptr;
+  size_t m_NumComps = 1;
+};
+
+using TransferPairs = std::vector<std::unique_ptr<ITransferPair>>;
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool AddTransferPairIfType(const IDataArray::Pointer& elementArray, const IDataArray::Pointer& featureArray, TransferPairs& pairs)
+{
+  typename DataArray<T>::Pointer elements = std::dynamic_pointer_cast<DataArray<T>>(elementArray);
+  typename DataArray<T>::Pointer features = std::dynamic_pointer_cast<DataArray<T>>(featureArray);
+  if(nullptr == elements || nullptr == features)
+  {
+    return false;
+  }
+  pairs.push_back(std::make_unique<TransferPair<T>>(*elements, *features));
+  return true;
+}
+
+/**
+ * @brief Checks that the arrays pair up and builds the typed view of every pair
+ * @return false if any pair is mismatched or of an unsupported type
+ */
+bool CreateTransferPairs(size_t numCells, const std::vector<IDataArray::Pointer>& elementArrays, const std::vector<IDataArray::Pointer>& featureArrays, TransferPairs& pairs)
+{
+  if(elementArrays.size() != featureArrays.size())
+  {
+    return false;
+  }
+
+  for(size_t a = 0; a < elementArrays.size(); a++)
+  {
+    const IDataArray::Pointer& elements = elementArrays[a];
+    const IDataArray::Pointer& features = featureArrays[a];
+    if(nullptr == elements || nullptr == features || elements->getNumberOfTuples() != numCells || elements->getNumberOfComponents() != features->getNumberOfComponents())
+    {
+      return false;
+    }
+
+    bool added = AddTransferPairIfType<int8_t>(elements, features, pairs) || AddTransferPairIfType<uint8_t>(elements, features, pairs) ||
+                 AddTransferPairIfType<int16_t>(elements, features, pairs) || AddTransferPairIfType<uint16_t>(elements, features, pairs) ||
+                 AddTransferPairIfType<int32_t>(elements, features, pairs) || AddTransferPairIfType<uint32_t>(elements, features, pairs) ||
+                 AddTransferPairIfType<int64_t>(elements, features, pairs) || AddTransferPairIfType<uint64_t>(elements, features, pairs) ||
+                 AddTransferPairIfType<float>(elements, features, pairs) || AddTransferPairIfType<double>(elements, features, pairs) ||
+                 AddTransferPairIfType<bool>(elements, features, pairs);
+    if(!added)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Each chunk of cells records the first and last cell of every Feature in its own table. More chunks than
+ * threads buy nothing, and a chunk must cover several cells per Feature for the tables to pay off. The cap keeps all
+ * the tables together no larger than the Feature Ids array itself.
+ * @param numCells
+ * @param numFeatures
+ * @return
+ */
+size_t ComputeNumberOfChunks(size_t numCells, size_t numFeatures)
+{
+  const size_t numThreads = static_cast<size_t>(std::max<int32_t>(1, ParallelExecutionContext::CurrentConcurrency()));
+  const size_t maxChunks = numCells / std::max<size_t>(1, numFeatures * 4);
+  return std::max<size_t>(1, std::min(numThreads, maxChunks));
+}
+
+// -----------------------------------------------------------------------------
+SIMPLRange GetBlockRange(size_t block, size_t numElements)
+{
+  return {block * k_BlockSize, std::min((block + 1) * k_BlockSize, numElements)};
+}
+
+// -----------------------------------------------------------------------------
+size_t GetNumberOfBlocks(size_t numElements)
+{
+  return (numElements + k_BlockSize - 1) / k_BlockSize;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t FeatureDataTransfer::FindMaxFeatureId(const Int32ArrayType& featureIds)
+{
+  const size_t numCells = featureIds.getSize();
+  const int32_t* ids = featureIds.getPointer(0);
+  int32_t maxFeatureId = -1;
+  std::mutex mutex;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, GetNumberOfBlocks(numCells));
+  dataAlg.execute([&](const SIMPLRange& range) {
+    int32_t localMax = -1;
+    for(size_t i = range.min() * k_BlockSize; i < std::min(range.max() * k_BlockSize, numCells); i++)
+    {
+      localMax = std::max(localMax, ids[i]);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    maxFeatureId = std::max(maxFeatureId, localMax);
+  });
+  return maxFeatureId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FeatureDataTransfer::CopyFeatureToElement(const Int32ArrayType& featureIds, const std::vector<IDataArray::Pointer>& featureArrays, const std::vector<IDataArray::Pointer>& elementArrays)
+{
+  const size_t numCells = featureIds.getSize();
+  TransferPairs pairs;
+  if(!CreateTransferPairs(numCells, elementArrays, featureArrays, pairs))
+  {
+    return false;
+  }
+
+  const int32_t* ids = featureIds.getPointer(0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, GetNumberOfBlocks(numCells));
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      const SIMPLRange cells = GetBlockRange(block, numCells);
+      for(const auto& pair : pairs)
+      {
+        pair->gather(ids, cells.min(), cells.max());
+      }
+    }
+  });
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FeatureDataTransfer::CopyElementToFeature(const Int32ArrayType& featureIds, const std::vector<IDataArray::Pointer>& elementArrays, const std::vector<IDataArray::Pointer>& featureArrays,
+                                               std::vector<int32_t>& inconsistentFeatureIds)
+{
+  inconsistentFeatureIds.assign(elementArrays.size(), -1);
+
+  const size_t numCells = featureIds.getSize();
+  TransferPairs pairs;
+  if(!CreateTransferPairs(numCells, elementArrays, featureArrays, pairs))
+  {
+    return false;
+  }
+  if(pairs.empty())
+  {
+    return true;
+  }
+
+  size_t numFeatures = featureArrays.front()->getNumberOfTuples();
+  for(const auto& featureArray : featureArrays)
+  {
+    numFeatures = std::min(numFeatures, featureArray->getNumberOfTuples());
+  }
+  const int32_t* ids = featureIds.getPointer(0);
+
+  // Locate the first and last cell of every Feature. Each chunk of cells fills its own tables and the tables are
+  // merged in chunk order, so no two tasks ever write the same entry.
+  const size_t numChunks = ComputeNumberOfChunks(numCells, numFeatures);
+  std::vector<size_t> chunkFirstCells(numChunks * numFeatures, k_NoCell);
+  std::vector<size_t> chunkLastCells(numChunks * numFeatures, k_NoCell);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        size_t* firstCells = chunkFirstCells.data() + chunk * numFeatures;
+        size_t* lastCells = chunkLastCells.data() + chunk * numFeatures;
+        for(size_t i = chunk * numCells / numChunks; i < (chunk + 1) * numCells / numChunks; i++)
+        {
+          const int32_t featureId = ids[i];
+          if(featureId < 0 || static_cast<size_t>(featureId) >= numFeatures)
+          {
+            continue;
+          }
+          if(firstCells[featureId] == k_NoCell)
+          {
+            firstCells[featureId] = i;
+          }
+          lastCells[featureId] = i;
+        }
+      }
+    });
+  }
+
+  std::vector<size_t> firstCells;
+  std::vector<size_t> lastCells;
+  if(numChunks == 1)
+  {
+    firstCells.swap(chunkFirstCells);
+    lastCells.swap(chunkLastCells);
+  }
+  else
+  {
+    firstCells.assign(numFeatures, k_NoCell);
+    lastCells.assign(numFeatures, k_NoCell);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numFeatures);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t featureId = range.min(); featureId < range.max(); featureId++)
+      {
+        for(size_t chunk = 0; chunk < numChunks; chunk++)
+        {
+          const size_t index = chunk * numFeatures + featureId;
+          if(firstCells[featureId] == k_NoCell)
+          {
+            firstCells[featureId] = chunkFirstCells[index];
+          }
+          if(chunkLastCells[index] != k_NoCell)
+          {
+            lastCells[featureId] = chunkLastCells[index];
+          }
+        }
+      }
+    });
+  }
+
+  // Compare every cell with the first cell of its Feature. Only the earliest mismatch of each array is kept, so a
+  // block that starts after a mismatch that has already been found is skipped.
+  std::unique_ptr<std::atomic<size_t>[]> firstMismatches(new std::atomic<size_t>[pairs.size()]);
+  for(size_t a = 0; a < pairs.size(); a++)
+  {
+    firstMismatches[a] = k_NoCell;
+  }
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, GetNumberOfBlocks(numCells));
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t block = range.min(); block < range.max(); block++)
+      {
+        const SIMPLRange cells = GetBlockRange(block, numCells);
+        for(size_t a = 0; a < pairs.size(); a++)
+        {
+          if(firstMismatches[a].load() < cells.min())
+          {
+            continue;
+          }
+          size_t mismatch = pairs[a]->findFirstMismatch(ids, firstCells.data(), numFeatures, cells.min(), cells.max());
+          size_t current = firstMismatches[a].load();
+          while(mismatch < current && !firstMismatches[a].compare_exchange_weak(current, mismatch))
+          {
+          }
+        }
+      }
+    });
+  }
+
+  // Every Feature is owned by exactly one task, which copies the value of the last cell of that Feature
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, GetNumberOfBlocks(numFeatures));
+    dataAlg.execute([&](const SIMPLRange& range) {
+      for(size_t block = range.min(); block < range.max(); block++)
+      {
+        const SIMPLRange features = GetBlockRange(block, numFeatures);
+        for(const auto& pair : pairs)
+        {
+          pair->scatter(lastCells.data(), features.min(), features.max());
+        }
+      }
+    });
+  }
+
+  for(size_t a = 0; a < pairs.size(); a++)
+  {
+    const size_t mismatch = firstMismatches[a].load();
+    if(mismatch != k_NoCell)
+    {
+      inconsistentFeatureIds[a] = ids[mismatch];
+    }
+  }
+  return true;
+}
@@ -0,0 +1,92 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @brief The FeatureDataTransfer class copies values between Element arrays and Feature arrays through a Feature Ids
+ * array. Each call handles any number of arrays in a single pass over the Feature Ids. The cells are split into blocks
+ * that are processed in parallel, and every array is handled for a block while the Feature Ids of that block are still
+ * in cache. The supported types are the primitive DataArray types; both arrays of a pair must have the same type and
+ * number of components.
+ */
+class SIMPLib_EXPORT FeatureDataTransfer
+{
+public:
+  /**
+   * @brief Returns the largest Feature Id, or -1 if the array is empty
+   * @param featureIds
+   * @return
+   */
+  static int32_t FindMaxFeatureId(const Int32ArrayType& featureIds);
+
+  /**
+   * @brief Gathers Feature values into Element arrays: elementArrays[a][i] = featureArrays[a][featureIds[i]].
+   * Each Element array must have as many tuples as there are Feature Ids and every Feature Id must be smaller than the
+   * number of tuples of the Feature arrays. Cells with a negative Feature Id are left unchanged.
+   * @param featureIds
+   * @param featureArrays
+   * @param elementArrays
+   * @return false if the arrays do not pair up or one of them has an unsupported type. Nothing is copied in that case.
+   */
+  static bool CopyFeatureToElement(const Int32ArrayType& featureIds, const std::vector<IDataArray::Pointer>& featureArrays, const std::vector<IDataArray::Pointer>& elementArrays);
+
+  /**
+   * @brief Scatters Element values into Feature arrays. Each Feature takes the value of its last cell, which is the
+   * result a serial loop over the cells produces. The first and last cell of every Feature are located first so that
+   * each Feature is then written by exactly one task, without atomics or locks.
+   * @param featureIds
+   * @param elementArrays
+   * @param featureArrays
+   * @param inconsistentFeatureIds Receives, for each pair of arrays, the Feature Id of the first cell whose value
+   * differs from the first cell of the same Feature, or -1 if every Feature holds a single value
+   * @return false if the arrays do not pair up or one of them has an unsupported type. Nothing is copied in that case.
+   */
+  static bool CopyElementToFeature(const Int32ArrayType& featureIds, const std::vector<IDataArray::Pointer>& elementArrays, const std::vector<IDataArray::Pointer>& featureArrays,
+                                   std::vector<int32_t>& inconsistentFeatureIds);
+
+public:
+  FeatureDataTransfer() = delete;
+  FeatureDataTransfer(const FeatureDataTransfer&) = delete;            // Copy Constructor Not Implemented
+  FeatureDataTransfer(FeatureDataTransfer&&) = delete;                 // Move Constructor Not Implemented
+  FeatureDataTransfer& operator=(const FeatureDataTransfer&) = delete; // Copy Assignment Not Implemented
+  FeatureDataTransfer& operator=(FeatureDataTransfer&&) = delete;      // Move Assignment Not Implemented
+};
@@ -38,6 +38,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -112,7 +113,8 @@ public:
     if(m_RunParallel)
     {
       tbb::blocked_range<size_t> tbbRange(m_Range[0], m_Range[1]);
-      tbb::parallel_for(tbbRange, body, m_Partitioner);
+      // Run inside the arena of the active execution context so its thread limit and NUMA pinning apply
+      ParallelExecutionContext::Run([&]() { tbb::parallel_for(tbbRange, body, m_Partitioner); });
     }
     // Run non-parallel operation
     else
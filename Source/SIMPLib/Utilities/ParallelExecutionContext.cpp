@@ -0,0 +1,221 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParallelExecutionContext.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QDebug>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/global_control.h>
+#if TBB_VERSION_MAJOR >= 2021
+#include <tbb/info.h>
+#define SIMPL_TBB_HAS_NUMA_CONSTRAINTS 1
+#endif
+#endif
+
+namespace
+{
+thread_local ParallelExecutionContext::Pointer s_CurrentContext;
+
+std::mutex s_SettingsMutex;
+int32_t s_ProcessMaxConcurrency = 0;
+int32_t s_DefaultPipelineConcurrency = 0;
+int32_t s_DefaultNumaNode = -1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+std::unique_ptr<tbb::global_control> s_GlobalControl;
+#endif
+
+// -----------------------------------------------------------------------------
+int32_t HardwareConcurrency()
+{
+  return std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::ParallelExecutionContext(int32_t maxConcurrency, int32_t numaNode)
+: m_MaxConcurrency(std::max(0, maxConcurrency))
+, m_NumaNode(numaNode)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  int concurrency = (m_MaxConcurrency > 0) ? m_MaxConcurrency : static_cast<int>(tbb::task_arena::automatic);
+#ifdef SIMPL_TBB_HAS_NUMA_CONSTRAINTS
+  if(m_NumaNode >= 0)
+  {
+    std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+    if(std::find(nodes.begin(), nodes.end(), m_NumaNode) != nodes.end())
+    {
+      m_Arena = std::make_unique<tbb::task_arena>(tbb::task_arena::constraints(m_NumaNode, concurrency));
+      return;
+    }
+    qDebug() << "NUMA node " << m_NumaNode << " is not available. The execution context is not pinned.";
+  }
+#endif
+  if(m_NumaNode >= 0 && GetNumaNodeCount() == 0)
+  {
+    m_NumaNode = -1;
+  }
+  m_Arena = std::make_unique<tbb::task_arena>(concurrency);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::~ParallelExecutionContext() = default;
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::Pointer ParallelExecutionContext::New(int32_t maxConcurrency, int32_t numaNode)
+{
+  return Pointer(new ParallelExecutionContext(maxConcurrency, numaNode));
+}
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::Pointer ParallelExecutionContext::CreateDefault()
+{
+  int32_t maxConcurrency = 0;
+  int32_t numaNode = -1;
+  {
+    std::lock_guard<std::mutex> lock(s_SettingsMutex);
+    maxConcurrency = s_DefaultPipelineConcurrency;
+    numaNode = s_DefaultNumaNode;
+  }
+  return New(maxConcurrency, numaNode);
+}
+
+// -----------------------------------------------------------------------------
+int32_t ParallelExecutionContext::getMaxConcurrency() const
+{
+  return m_MaxConcurrency;
+}
+
+// -----------------------------------------------------------------------------
+int32_t ParallelExecutionContext::getNumaNode() const
+{
+  return m_NumaNode;
+}
+
+// -----------------------------------------------------------------------------
+int32_t ParallelExecutionContext::getEffectiveConcurrency() const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  int32_t concurrency = m_Arena ? static_cast<int32_t>(m_Arena->max_concurrency()) : HardwareConcurrency();
+#else
+  int32_t concurrency = (m_MaxConcurrency > 0) ? m_MaxConcurrency : HardwareConcurrency();
+#endif
+  int32_t processMax = GetProcessMaxConcurrency();
+  if(processMax > 0)
+  {
+    concurrency = std::min(concurrency, processMax);
+  }
+  return std::max(1, concurrency);
+}
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::Pointer ParallelExecutionContext::Current()
+{
+  return s_CurrentContext;
+}
+
+// -----------------------------------------------------------------------------
+int32_t ParallelExecutionContext::CurrentConcurrency()
+{
+  if(nullptr != s_CurrentContext)
+  {
+    return s_CurrentContext->getEffectiveConcurrency();
+  }
+  int32_t processMax = GetProcessMaxConcurrency();
+  return (processMax > 0) ? std::min(processMax, HardwareConcurrency()) : HardwareConcurrency();
+}
+
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::SetProcessMaxConcurrency(int32_t maxConcurrency)
+{
+  std::lock_guard<std::mutex> lock(s_SettingsMutex);
+  s_ProcessMaxConcurrency = std::max(0, maxConcurrency);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  s_GlobalControl.reset();
+  if(s_ProcessMaxConcurrency > 0)
+  {
+    s_GlobalControl = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, static_cast<size_t>(s_ProcessMaxConcurrency));
+  }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+int32_t ParallelExecutionContext::GetProcessMaxConcurrency()
+{
+  std::lock_guard<std::mutex> lock(s_SettingsMutex);
+  return s_ProcessMaxConcurrency;
+}
+
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::SetDefaultPipelineSettings(int32_t maxConcurrency, int32_t numaNode)
+{
+  std::lock_guard<std::mutex> lock(s_SettingsMutex);
+  s_DefaultPipelineConcurrency = std::max(0, maxConcurrency);
+  s_DefaultNumaNode = numaNode;
+}
+
+// -----------------------------------------------------------------------------
+int32_t ParallelExecutionContext::GetNumaNodeCount()
+{
+#ifdef SIMPL_TBB_HAS_NUMA_CONSTRAINTS
+  std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+  // Without hwloc support TBB reports a single automatic node
+  if(nodes.size() == 1 && nodes[0] == tbb::task_arena::automatic)
+  {
+    return 0;
+  }
+  return static_cast<int32_t>(nodes.size());
+#else
+  return 0;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::Scope::Scope(const Pointer& context)
+: m_Previous(s_CurrentContext)
+{
+  s_CurrentContext = context;
+}
+
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::Scope::~Scope()
+{
+  s_CurrentContext = m_Previous;
+}
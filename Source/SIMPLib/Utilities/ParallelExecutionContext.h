@@ -0,0 +1,201 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "SIMPLib/SIMPLib.h"
+
+// SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
+/**
+ * @brief The ParallelExecutionContext class bounds the TBB parallelism used by the ParallelDataAlgorithm,
+ * ParallelData2DAlgorithm, ParallelData3DAlgorithm and ParallelTaskAlgorithm classes. A context owns a
+ * tbb::task_arena with a maximum concurrency and, when TBB supports it, a NUMA node to pin the arena to.
+ *
+ * A context becomes active for the calling thread through a Scope. FilterPipeline activates its context
+ * while it executes, so several pipelines running in one process each get their own arena instead of all
+ * sharing the default one. In addition the process wide maximum concurrency caps the total number of
+ * TBB worker threads.
+ */
+class SIMPLib_EXPORT ParallelExecutionContext
+{
+public:
+  using Self = ParallelExecutionContext;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+
+  /**
+   * @brief Creates a context
+   * @param maxConcurrency Maximum number of threads working in the arena. 0 uses the default.
+   * @param numaNode NUMA node to pin the arena to. -1 does not pin.
+   * @return
+   */
+  static Pointer New(int32_t maxConcurrency = 0, int32_t numaNode = -1);
+
+  /**
+   * @brief Creates a context from the process wide default pipeline settings
+   * @return
+   */
+  static Pointer CreateDefault();
+
+  ~ParallelExecutionContext();
+
+  /**
+   * @brief Returns the maximum concurrency this context was created with. 0 means automatic.
+   * @return
+   */
+  int32_t getMaxConcurrency() const;
+
+  /**
+   * @brief Returns the NUMA node the arena is pinned to or -1
+   * @return
+   */
+  int32_t getNumaNode() const;
+
+  /**
+   * @brief Returns the number of threads that can actually work in this context
+   * @return
+   */
+  int32_t getEffectiveConcurrency() const;
+
+  /**
+   * @brief Runs func inside the arena of this context and waits for it to return
+   * @param func
+   */
+  template <typename Func>
+  void execute(const Func& func)
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(m_Arena)
+    {
+      m_Arena->execute(func);
+      return;
+    }
+#endif
+    func();
+  }
+
+  /**
+   * @brief Runs func inside the context that is active on the calling thread, or directly if there is none
+   * @param func
+   */
+  template <typename Func>
+  static void Run(const Func& func)
+  {
+    Pointer context = Current();
+    if(nullptr != context)
+    {
+      context->execute(func);
+      return;
+    }
+    func();
+  }
+
+  /**
+   * @brief Returns the context that is active on the calling thread or nullptr
+   * @return
+   */
+  static Pointer Current();
+
+  /**
+   * @brief Returns the number of threads a parallel algorithm started on the calling thread can use
+   * @return
+   */
+  static int32_t CurrentConcurrency();
+
+  /**
+   * @brief Caps the total number of threads TBB uses in this process. 0 removes the cap.
+   * @param maxConcurrency
+   */
+  static void SetProcessMaxConcurrency(int32_t maxConcurrency);
+
+  /**
+   * @brief Returns the process wide cap or 0 if there is none
+   * @return
+   */
+  static int32_t GetProcessMaxConcurrency();
+
+  /**
+   * @brief Sets the settings used by CreateDefault(), i.e. by every pipeline that does not have its own context
+   * @param maxConcurrency
+   * @param numaNode
+   */
+  static void SetDefaultPipelineSettings(int32_t maxConcurrency, int32_t numaNode);
+
+  /**
+   * @brief Returns the number of NUMA nodes TBB can pin arenas to. 0 if NUMA pinning is not supported.
+   * @return
+   */
+  static int32_t GetNumaNodeCount();
+
+  /**
+   * @brief The Scope class makes a context the active one for the calling thread for its lifetime
+   */
+  class SIMPLib_EXPORT Scope
+  {
+  public:
+    explicit Scope(const Pointer& context);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+  private:
+    Pointer m_Previous;
+  };
+
+protected:
+  ParallelExecutionContext(int32_t maxConcurrency, int32_t numaNode);
+
+private:
+  int32_t m_MaxConcurrency = 0;
+  int32_t m_NumaNode = -1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  std::unique_ptr<tbb::task_arena> m_Arena;
+#endif
+
+public:
+  ParallelExecutionContext(const ParallelExecutionContext&) = delete;            // Copy Constructor Not Implemented
+  ParallelExecutionContext(ParallelExecutionContext&&) = delete;                 // Move Constructor Not Implemented
+  ParallelExecutionContext& operator=(const ParallelExecutionContext&) = delete; // Copy Assignment Not Implemented
+  ParallelExecutionContext& operator=(ParallelExecutionContext&&) = delete;      // Move Assignment Not Implemented
+};
@@ -42,7 +42,8 @@
 // -----------------------------------------------------------------------------
 ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 : m_Parallelization(true)
-, m_MaxThreads(std::thread::hardware_concurrency())
+, m_MaxThreads(static_cast<uint32_t>(ParallelExecutionContext::CurrentConcurrency()))
+, m_Context(ParallelExecutionContext::Current())
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_TaskGroup(new tbb::task_group)
 #endif
@@ -55,7 +56,7 @@ ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 ParallelTaskAlgorithm::~ParallelTaskAlgorithm()
 {
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  m_TaskGroup->wait();
+  runInContext([this]() { m_TaskGroup->wait(); });
 #endif
 }
 
@@ -92,7 +93,12 @@ uint32_t ParallelTaskAlgorithm::getMaxThreads() const
 // -----------------------------------------------------------------------------
 void ParallelTaskAlgorithm::setMaxThreads(uint32_t threads)
 {
-  m_MaxThreads = std::min(threads, std::thread::hardware_concurrency());
+  uint32_t limit = std::thread::hardware_concurrency();
+  if(nullptr != m_Context)
+  {
+    limit = std::min(limit, static_cast<uint32_t>(m_Context->getEffectiveConcurrency()));
+  }
+  m_MaxThreads = std::max(1U, std::min(threads, limit));
 }
 
 // -----------------------------------------------------------------------------
@@ -102,7 +108,7 @@ void ParallelTaskAlgorithm::wait()
 {
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   // This will spill over if the number of files to process does not divide evenly by the number of threads.
-  m_TaskGroup->wait();
+  runInContext([this]() { m_TaskGroup->wait(); });
   m_CurThreads = 0;
 #endif
 }
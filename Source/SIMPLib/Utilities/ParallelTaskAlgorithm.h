@@ -37,6 +37,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -78,7 +79,7 @@ public:
 
   /**
    * @brief Sets the maximum number of threads to use.  This amount is automatically
-   * reduced to the max hardware concurrency.
+   * reduced to the max hardware concurrency and to the concurrency of the execution context.
    * @param threads
    */
   void setMaxThreads(uint32_t threads);
@@ -95,7 +96,7 @@ public:
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     if(m_Parallelization)
     {
-      m_TaskGroup->run(body);
+      runInContext([&]() { m_TaskGroup->run(body); });
       m_CurThreads++;
       if(m_CurThreads >= m_MaxThreads)
       {
@@ -115,8 +116,26 @@ public:
   void wait();
 
 private:
+  /**
+   * @brief Runs func inside the execution context that was active when this object was created
+   * @param func
+   */
+  template <typename Func>
+  void runInContext(const Func& func)
+  {
+    if(nullptr != m_Context)
+    {
+      m_Context->execute(func);
+    }
+    else
+    {
+      func();
+    }
+  }
+
   bool m_Parallelization = false;
   uint32_t m_MaxThreads = 1;
+  ParallelExecutionContext::Pointer m_Context;
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   uint32_t m_CurThreads = 0;
   std::shared_ptr<tbb::task_group> m_TaskGroup;
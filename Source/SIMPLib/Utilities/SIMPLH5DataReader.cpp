@@ -35,6 +35,7 @@
 #include <sstream>
 
 #include <QtCore/QDebug>
+#include <QtCore/QTextStream>
 
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
@@ -47,6 +48,7 @@ using namespace H5Support;
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/DataContainerBundle.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
+#include "SIMPLib/Utilities/SIMPLH5StructureCache.h"
 
 const QString Title = "HDF5 Read Error";
 
@@ -71,13 +73,21 @@ SIMPLH5DataReader::~SIMPLH5DataReader()
 // -----------------------------------------------------------------------------
 bool SIMPLH5DataReader::openFile(const QString& filePath)
 {
-  if(m_FileId >= 0)
+  if(m_FileId >= 0 || !m_CurrentFilePath.isEmpty())
   {
     QString ss = QObject::tr("Error opening input file '%1' - A file is already open with this reader.").arg(filePath);
     Q_EMIT errorGenerated(Title, ss, -148);
     return false;
   }
 
+  // The file was read before and has not changed since, so it is known to be readable. Opening it is
+  // left until something is needed that the cache does not have.
+  if(SIMPLH5StructureCache::Contains(filePath))
+  {
+    m_CurrentFilePath = filePath;
+    return true;
+  }
+
   m_FileId = QH5Utilities::openFile(filePath, true); // Open the file Read Only
   if(m_FileId < 0)
   {
@@ -91,11 +101,43 @@ bool SIMPLH5DataReader::openFile(const QString& filePath)
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLH5DataReader::ensureFileOpen()
+{
+  if(m_FileId >= 0)
+  {
+    return true;
+  }
+  if(m_CurrentFilePath.isEmpty())
+  {
+    return false;
+  }
+
+  m_FileId = QH5Utilities::openFile(m_CurrentFilePath, true); // Open the file Read Only
+  if(m_FileId < 0)
+  {
+    QString ss = QObject::tr("Error opening input file '%1'.").arg(m_CurrentFilePath);
+    Q_EMIT errorGenerated(Title, ss, -149);
+    m_FileId = -1;
+    return false;
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 bool SIMPLH5DataReader::closeFile()
 {
+  if(m_FileId < 0)
+  {
+    // Nothing had to be read from the file since openFile()
+    m_CurrentFilePath.clear();
+    return true;
+  }
+
   herr_t err = QH5Utilities::closeFile(m_FileId); // Open the file Read Only
   if(err < 0)
   {
@@ -114,7 +156,16 @@ bool SIMPLH5DataReader::closeFile()
 // -----------------------------------------------------------------------------
 DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(DataContainerArrayProxy& proxy, bool preflight)
 {
-  if(m_FileId < 0)
+  if(preflight)
+  {
+    DataContainerArray::Pointer cachedDca = SIMPLH5StructureCache::FindPreflightData(m_CurrentFilePath, proxy);
+    if(nullptr != cachedDca)
+    {
+      return cachedDca;
+    }
+  }
+
+  if(!ensureFileOpen())
   {
     QString ss = QObject::tr("File data unable to be read - file was not properly opened");
     Q_EMIT errorGenerated(Title, ss, -249);
@@ -180,6 +231,10 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(DataConta
     return DataContainerArray::NullPointer();
   }
 
+  if(preflight)
+  {
+    SIMPLH5StructureCache::InsertPreflightData(m_CurrentFilePath, proxy, dca);
+  }
   return dca;
 }
 
@@ -190,7 +245,14 @@ DataContainerArrayProxy SIMPLH5DataReader::readDataContainerArrayStructure(SIMPL
 {
   DataContainerArrayProxy proxy;
 
-  if(m_FileId < 0)
+  QString cacheKey = requirementsKey(req);
+  if(SIMPLH5StructureCache::FindStructure(m_CurrentFilePath, cacheKey, proxy))
+  {
+    err = 0;
+    return proxy;
+  }
+
+  if(!ensureFileOpen())
   {
     return DataContainerArrayProxy();
   }
@@ -235,15 +297,59 @@ DataContainerArrayProxy SIMPLH5DataReader::readDataContainerArrayStructure(SIMPL
   DataContainer::ReadDataContainerStructure(dcArrayGroupId, proxy, req, h5InternalPath);
 
   QH5Utilities::closeHDF5Object(dcArrayGroupId);
+  SIMPLH5StructureCache::InsertStructure(m_CurrentFilePath, cacheKey, proxy);
   return proxy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SIMPLH5DataReader::requirementsKey(const SIMPLH5DataReaderRequirements* req)
+{
+  if(nullptr == req)
+  {
+    return QString("None");
+  }
+
+  QString key;
+  QTextStream out(&key);
+  out << "Geom:";
+  for(const auto& type : req->getDCGeometryTypes())
+  {
+    out << static_cast<int>(type) << ",";
+  }
+  out << "|AM:";
+  for(const auto& type : req->getAMTypes())
+  {
+    out << static_cast<int>(type) << ",";
+  }
+  out << "|DA:";
+  for(const auto& type : req->getDATypes())
+  {
+    out << type << ",";
+  }
+  out << "|Comp:";
+  for(const auto& dims : req->getComponentDimensions())
+  {
+    for(const auto& dim : dims)
+    {
+      out << dim << "x";
+    }
+    out << ",";
+  }
+  return key;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 bool SIMPLH5DataReader::readPipelineJson(QString& json)
 {
   herr_t err = 0;
+  if(!ensureFileOpen())
+  {
+    return false;
+  }
 
   // Check to see if version of .dream3d file is prior to new data container names
   QString fileVersionString = "";
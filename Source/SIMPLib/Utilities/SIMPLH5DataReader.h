@@ -75,7 +75,8 @@ public:
   ~SIMPLH5DataReader() override;
 
   /**
-   * @brief ReadJsonFile
+   * @brief Opens the file for reading. When the SIMPLH5StructureCache holds an up to date entry for the file
+   * the HDF5 file is only opened once something has to be read that is not in the cache.
    * @param filePath
    * @return
    */
@@ -123,6 +124,19 @@ private:
   QString m_CurrentFilePath = "";
   hid_t m_FileId = -1;
 
+  /**
+   * @brief Opens the HDF5 file if openFile() deferred it
+   * @return False if the file could not be opened
+   */
+  bool ensureFileOpen();
+
+  /**
+   * @brief Returns a key that identifies the requirements of a structure read in the SIMPLH5StructureCache
+   * @param req
+   * @return
+   */
+  static QString requirementsKey(const SIMPLH5DataReaderRequirements* req);
+
   /**
    * @brief readDataContainerBundles
    * @param fileId
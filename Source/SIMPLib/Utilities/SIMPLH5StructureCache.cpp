@@ -0,0 +1,398 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLH5StructureCache.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerBundle.h"
+
+namespace
+{
+struct FileStamp
+{
+  QString Path;
+  qint64 Size = -1;
+  qint64 Modified = -1;
+};
+
+struct FileEntry
+{
+  qint64 Size = -1;
+  qint64 Modified = -1;
+  uint64_t LastUse = 0;
+  std::map<QString, DataContainerArrayProxy> Structures;
+  std::map<QString, DataContainerArrayShPtrType> PreflightData;
+  std::map<QString, uint64_t> PreflightLastUse;
+  int HasMontages = -1;
+};
+
+std::mutex s_CacheMutex;
+std::map<QString, FileEntry> s_Entries;
+uint64_t s_UseCounter = 0;
+
+std::atomic<bool> s_Enabled(true);
+std::atomic<size_t> s_Hits(0);
+std::atomic<size_t> s_Misses(0);
+
+// -----------------------------------------------------------------------------
+FileStamp GetFileStamp(const QString& filePath)
+{
+  FileStamp stamp;
+  QFileInfo fi(filePath);
+  if(!fi.exists())
+  {
+    return stamp;
+  }
+  stamp.Path = fi.canonicalFilePath();
+  stamp.Size = fi.size();
+  stamp.Modified = fi.lastModified().toMSecsSinceEpoch();
+  return stamp;
+}
+
+// -----------------------------------------------------------------------------
+QString ProxyKey(const DataContainerArrayProxy& proxy)
+{
+  QJsonObject json;
+  proxy.writeJson(json);
+  return QString::fromUtf8(QJsonDocument(json).toJson(QJsonDocument::Compact));
+}
+
+// -----------------------------------------------------------------------------
+// Returns the entry of an existing file if it is still up to date. Stale entries are dropped. The caller must hold s_CacheMutex.
+// -----------------------------------------------------------------------------
+FileEntry* FindEntry(const FileStamp& stamp)
+{
+  if(stamp.Path.isEmpty())
+  {
+    return nullptr;
+  }
+  auto iter = s_Entries.find(stamp.Path);
+  if(iter == s_Entries.end())
+  {
+    return nullptr;
+  }
+  if(iter->second.Size != stamp.Size || iter->second.Modified != stamp.Modified)
+  {
+    s_Entries.erase(iter);
+    return nullptr;
+  }
+  iter->second.LastUse = ++s_UseCounter;
+  return &(iter->second);
+}
+
+// -----------------------------------------------------------------------------
+// Returns the entry of an existing file, creating it if needed. The caller must hold s_CacheMutex.
+// -----------------------------------------------------------------------------
+FileEntry* FindOrCreateEntry(const FileStamp& stamp)
+{
+  if(stamp.Path.isEmpty())
+  {
+    return nullptr;
+  }
+  FileEntry* entry = FindEntry(stamp);
+  if(nullptr != entry)
+  {
+    return entry;
+  }
+
+  if(s_Entries.size() >= SIMPLH5StructureCache::k_MaxFiles)
+  {
+    auto oldest = s_Entries.begin();
+    for(auto iter = s_Entries.begin(); iter != s_Entries.end(); ++iter)
+    {
+      if(iter->second.LastUse < oldest->second.LastUse)
+      {
+        oldest = iter;
+      }
+    }
+    s_Entries.erase(oldest);
+  }
+
+  FileEntry& newEntry = s_Entries[stamp.Path];
+  newEntry.Size = stamp.Size;
+  newEntry.Modified = stamp.Modified;
+  newEntry.LastUse = ++s_UseCounter;
+  return &newEntry;
+}
+
+// -----------------------------------------------------------------------------
+void CountLookup(bool hit)
+{
+  if(hit)
+  {
+    s_Hits++;
+  }
+  else
+  {
+    s_Misses++;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool SIMPLH5StructureCache::Contains(const QString& filePath)
+{
+  if(!s_Enabled.load())
+  {
+    return false;
+  }
+  FileStamp stamp = GetFileStamp(filePath);
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  return nullptr != FindEntry(stamp);
+}
+
+// -----------------------------------------------------------------------------
+bool SIMPLH5StructureCache::FindStructure(const QString& filePath, const QString& key, DataContainerArrayProxy& proxy)
+{
+  if(!s_Enabled.load())
+  {
+    return false;
+  }
+  FileStamp stamp = GetFileStamp(filePath);
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  FileEntry* entry = FindEntry(stamp);
+  bool hit = false;
+  if(nullptr != entry)
+  {
+    auto iter = entry->Structures.find(key);
+    if(iter != entry->Structures.end())
+    {
+      proxy = iter->second;
+      hit = true;
+    }
+  }
+  CountLookup(hit);
+  return hit;
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::InsertStructure(const QString& filePath, const QString& key, const DataContainerArrayProxy& proxy)
+{
+  if(!s_Enabled.load())
+  {
+    return;
+  }
+  FileStamp stamp = GetFileStamp(filePath);
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  FileEntry* entry = FindOrCreateEntry(stamp);
+  if(nullptr != entry)
+  {
+    entry->Structures[key] = proxy;
+  }
+}
+
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer SIMPLH5StructureCache::FindPreflightData(const QString& filePath, const DataContainerArrayProxy& proxy)
+{
+  if(!s_Enabled.load())
+  {
+    return DataContainerArray::NullPointer();
+  }
+  QString key = ProxyKey(proxy);
+  FileStamp stamp = GetFileStamp(filePath);
+  DataContainerArray::Pointer cached;
+  {
+    std::lock_guard<std::mutex> lock(s_CacheMutex);
+    FileEntry* entry = FindEntry(stamp);
+    if(nullptr != entry)
+    {
+      auto iter = entry->PreflightData.find(key);
+      if(iter != entry->PreflightData.end())
+      {
+        cached = iter->second;
+        entry->PreflightLastUse[key] = ++s_UseCounter;
+      }
+    }
+  }
+  CountLookup(nullptr != cached);
+
+  // The cached object is never handed out or modified so it can be copied without holding the lock
+  return (nullptr == cached) ? DataContainerArray::NullPointer() : CopyPreflightData(cached);
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::InsertPreflightData(const QString& filePath, const DataContainerArrayProxy& proxy, const DataContainerArray::Pointer& dca)
+{
+  if(!s_Enabled.load() || nullptr == dca)
+  {
+    return;
+  }
+  QString key = ProxyKey(proxy);
+  DataContainerArray::Pointer copy = CopyPreflightData(dca);
+  FileStamp stamp = GetFileStamp(filePath);
+
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  FileEntry* entry = FindOrCreateEntry(stamp);
+  if(nullptr == entry)
+  {
+    return;
+  }
+  if(entry->PreflightData.find(key) == entry->PreflightData.end() && entry->PreflightData.size() >= k_MaxPreflightResults)
+  {
+    auto oldest = entry->PreflightLastUse.begin();
+    for(auto iter = entry->PreflightLastUse.begin(); iter != entry->PreflightLastUse.end(); ++iter)
+    {
+      if(iter->second < oldest->second)
+      {
+        oldest = iter;
+      }
+    }
+    entry->PreflightData.erase(oldest->first);
+    entry->PreflightLastUse.erase(oldest);
+  }
+  entry->PreflightData[key] = copy;
+  entry->PreflightLastUse[key] = ++s_UseCounter;
+}
+
+// -----------------------------------------------------------------------------
+bool SIMPLH5StructureCache::FindHasMontages(const QString& filePath, bool& hasMontages)
+{
+  if(!s_Enabled.load())
+  {
+    return false;
+  }
+  FileStamp stamp = GetFileStamp(filePath);
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  FileEntry* entry = FindEntry(stamp);
+  bool hit = (nullptr != entry && entry->HasMontages >= 0);
+  if(hit)
+  {
+    hasMontages = (entry->HasMontages > 0);
+  }
+  CountLookup(hit);
+  return hit;
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::InsertHasMontages(const QString& filePath, bool hasMontages)
+{
+  if(!s_Enabled.load())
+  {
+    return;
+  }
+  FileStamp stamp = GetFileStamp(filePath);
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  FileEntry* entry = FindOrCreateEntry(stamp);
+  if(nullptr != entry)
+  {
+    entry->HasMontages = hasMontages ? 1 : 0;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::Invalidate(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  QString canonicalPath = fi.canonicalFilePath();
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  s_Entries.erase(canonicalPath.isEmpty() ? fi.absoluteFilePath() : canonicalPath);
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(s_CacheMutex);
+  s_Entries.clear();
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::SetEnabled(bool value)
+{
+  s_Enabled = value;
+  if(!value)
+  {
+    Clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+bool SIMPLH5StructureCache::IsEnabled()
+{
+  return s_Enabled.load();
+}
+
+// -----------------------------------------------------------------------------
+size_t SIMPLH5StructureCache::GetHitCount()
+{
+  return s_Hits.load();
+}
+
+// -----------------------------------------------------------------------------
+size_t SIMPLH5StructureCache::GetMissCount()
+{
+  return s_Misses.load();
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLH5StructureCache::ResetCounters()
+{
+  s_Hits = 0;
+  s_Misses = 0;
+}
+
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer SIMPLH5StructureCache::CopyPreflightData(const DataContainerArray::Pointer& dca)
+{
+  DataContainerArray::Pointer copy = dca->deepCopy(true);
+
+  // Bundles hold the DataContainers themselves so they are rebuilt from the copied DataContainers
+  QMap<QString, IDataContainerBundle::Pointer> bundles = dca->getDataContainerBundles();
+  for(const auto& bundle : bundles)
+  {
+    DataContainerBundle::Pointer bundleCopy = DataContainerBundle::New(bundle->getName());
+    for(const auto& dcName : bundle->getDataContainerNames())
+    {
+      DataContainer::Pointer dc = copy->getDataContainer(dcName);
+      if(nullptr != dc)
+      {
+        bundleCopy->addOrReplaceDataContainer(dc);
+      }
+    }
+    DataContainerBundle::Pointer sourceBundle = std::dynamic_pointer_cast<DataContainerBundle>(bundle);
+    if(nullptr != sourceBundle)
+    {
+      bundleCopy->setMetaDataArrays(sourceBundle->getMetaDataArrays());
+    }
+    copy->addDataContainerBundle(bundleCopy);
+  }
+  return copy;
+}
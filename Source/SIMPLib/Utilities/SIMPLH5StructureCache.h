@@ -0,0 +1,181 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+
+class DataContainerArray;
+using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
+
+/**
+ * @brief The SIMPLH5StructureCache class remembers the results of walking the group hierarchy of .dream3d
+ * files so that repeated preflights of the same file do not open and scan it again. Entries are keyed on the
+ * canonical path of the file and are discarded as soon as the size or the modification time of the file
+ * changes. The cache is shared by every thread of the process.
+ *
+ * Three kinds of results are cached for each file:
+ * @li The DataContainerArrayProxy built by SIMPLH5DataReader::readDataContainerArrayStructure for a set of requirements
+ * @li The DataContainerArray built by a preflight read for a given proxy. Callers always get their own copy.
+ * @li Whether the file contains a montage group
+ */
+class SIMPLib_EXPORT SIMPLH5StructureCache
+{
+public:
+  /**
+   * @brief Maximum number of files that are kept in the cache. The least recently used file is dropped first.
+   */
+  static const size_t k_MaxFiles = 16;
+
+  /**
+   * @brief Maximum number of preflight results that are kept for a single file.
+   */
+  static const size_t k_MaxPreflightResults = 8;
+
+  /**
+   * @brief Returns true if there is an up to date entry for filePath
+   * @param filePath
+   * @return
+   */
+  static bool Contains(const QString& filePath);
+
+  /**
+   * @brief Looks up the structure of filePath that was read with the requirements described by key
+   * @param filePath
+   * @param key
+   * @param proxy Receives the cached structure
+   * @return True on a cache hit
+   */
+  static bool FindStructure(const QString& filePath, const QString& key, DataContainerArrayProxy& proxy);
+
+  /**
+   * @brief Stores the structure of filePath that was read with the requirements described by key
+   * @param filePath
+   * @param key
+   * @param proxy
+   */
+  static void InsertStructure(const QString& filePath, const QString& key, const DataContainerArrayProxy& proxy);
+
+  /**
+   * @brief Looks up the result of a preflight read of filePath with the given proxy
+   * @param filePath
+   * @param proxy
+   * @return A copy of the cached DataContainerArray or nullptr on a cache miss
+   */
+  static DataContainerArrayShPtrType FindPreflightData(const QString& filePath, const DataContainerArrayProxy& proxy);
+
+  /**
+   * @brief Stores a copy of the result of a preflight read of filePath with the given proxy
+   * @param filePath
+   * @param proxy
+   * @param dca
+   */
+  static void InsertPreflightData(const QString& filePath, const DataContainerArrayProxy& proxy, const DataContainerArrayShPtrType& dca);
+
+  /**
+   * @brief Looks up whether filePath contains a montage group
+   * @param filePath
+   * @param hasMontages Receives the cached value
+   * @return True on a cache hit
+   */
+  static bool FindHasMontages(const QString& filePath, bool& hasMontages);
+
+  /**
+   * @brief Stores whether filePath contains a montage group
+   * @param filePath
+   * @param hasMontages
+   */
+  static void InsertHasMontages(const QString& filePath, bool hasMontages);
+
+  /**
+   * @brief Drops every entry of filePath. Writers call this before they modify a file.
+   * @param filePath
+   */
+  static void Invalidate(const QString& filePath);
+
+  /**
+   * @brief Drops every entry of every file
+   */
+  static void Clear();
+
+  /**
+   * @brief Turns the cache on or off. While the cache is off nothing is found or stored.
+   * @param value
+   */
+  static void SetEnabled(bool value);
+
+  /**
+   * @brief Returns true if the cache is turned on. This is the default.
+   * @return
+   */
+  static bool IsEnabled();
+
+  /**
+   * @brief Returns the number of lookups that were answered from the cache
+   * @return
+   */
+  static size_t GetHitCount();
+
+  /**
+   * @brief Returns the number of lookups that were not answered from the cache
+   * @return
+   */
+  static size_t GetMissCount();
+
+  /**
+   * @brief Sets the hit and miss counters back to zero
+   */
+  static void ResetCounters();
+
+  /**
+   * @brief Returns a copy of a DataContainerArray that was read during a preflight. The arrays of the copy are
+   * not allocated and the DataContainerBundles refer to the copied DataContainers.
+   * @param dca
+   * @return
+   */
+  static DataContainerArrayShPtrType CopyPreflightData(const DataContainerArrayShPtrType& dca);
+
+public:
+  SIMPLH5StructureCache() = delete;
+  SIMPLH5StructureCache(const SIMPLH5StructureCache&) = delete;            // Copy Constructor Not Implemented
+  SIMPLH5StructureCache(SIMPLH5StructureCache&&) = delete;                 // Move Constructor Not Implemented
+  SIMPLH5StructureCache& operator=(const SIMPLH5StructureCache&) = delete; // Copy Assignment Not Implemented
+  SIMPLH5StructureCache& operator=(SIMPLH5StructureCache&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,227 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/FeatureDataTransfer.h"
+
+class FeatureDataTransferTest
+{
+public:
+  FeatureDataTransferTest() = default;
+  ~FeatureDataTransferTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer createFeatureIds(size_t numCells, int32_t numFeatures)
+  {
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numCells, std::string("FeatureIds"), true);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      // Every tenth cell is unassigned
+      featureIds->setValue(i, (i % 10 == 9) ? -1 : static_cast<int32_t>((i * 7) % static_cast<size_t>(numFeatures)));
+    }
+    return featureIds;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindMaxFeatureId()
+  {
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(0, std::string("FeatureIds"), true);
+    DREAM3D_REQUIRE_EQUAL(FeatureDataTransfer::FindMaxFeatureId(*featureIds), -1)
+
+    featureIds = createFeatureIds(100000, 313);
+    featureIds->setValue(76543, 4000);
+    DREAM3D_REQUIRE_EQUAL(FeatureDataTransfer::FindMaxFeatureId(*featureIds), 4000)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyFeatureToElement()
+  {
+    const size_t numCells = 100000;
+    const int32_t numFeatures = 313;
+    Int32ArrayType::Pointer featureIds = createFeatureIds(numCells, numFeatures);
+
+    FloatArrayType::Pointer featureFloats = FloatArrayType::CreateArray(numFeatures, std::vector<size_t>(1, 3), "Floats", true);
+    BoolArrayType::Pointer featureBools = BoolArrayType::CreateArray(numFeatures, std::string("Bools"), true);
+    for(int32_t f = 0; f < numFeatures; f++)
+    {
+      for(int32_t c = 0; c < 3; c++)
+      {
+        featureFloats->setComponent(f, c, static_cast<float>(f * 3 + c));
+      }
+      featureBools->setValue(f, f % 2 == 0);
+    }
+
+    FloatArrayType::Pointer elementFloats = FloatArrayType::CreateArray(numCells, std::vector<size_t>(1, 3), "Floats", true);
+    elementFloats->initializeWithValue(-1.0f);
+    BoolArrayType::Pointer elementBools = BoolArrayType::CreateArray(numCells, std::string("Bools"), true);
+    elementBools->initializeWithZeros();
+
+    bool ok = FeatureDataTransfer::CopyFeatureToElement(*featureIds, {featureFloats, featureBools}, {elementFloats, elementBools});
+    DREAM3D_REQUIRE(ok)
+
+    for(size_t i = 0; i < numCells; i++)
+    {
+      int32_t featureId = featureIds->getValue(i);
+      if(featureId < 0)
+      {
+        DREAM3D_REQUIRE_EQUAL(elementFloats->getComponent(i, 0), -1.0f)
+        continue;
+      }
+      for(int32_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(elementFloats->getComponent(i, c), featureFloats->getComponent(featureId, c))
+      }
+      DREAM3D_REQUIRE_EQUAL(elementBools->getValue(i), featureBools->getValue(featureId))
+    }
+
+    // Mismatched types leave every array untouched
+    Int32ArrayType::Pointer elementInts = Int32ArrayType::CreateArray(numCells, std::string("Ints"), true);
+    ok = FeatureDataTransfer::CopyFeatureToElement(*featureIds, {featureFloats}, {elementInts});
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyElementToFeature()
+  {
+    const size_t numCells = 100000;
+    const int32_t numFeatures = 313;
+    Int32ArrayType::Pointer featureIds = createFeatureIds(numCells, numFeatures);
+
+    // One array is constant over every Feature, the other one differs inside Feature 5
+    Int32ArrayType::Pointer elementConsistent = Int32ArrayType::CreateArray(numCells, std::string("Consistent"), true);
+    DoubleArrayType::Pointer elementInconsistent = DoubleArrayType::CreateArray(numCells, std::string("Inconsistent"), true);
+    std::vector<size_t> lastCells(numFeatures, 0);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      int32_t featureId = featureIds->getValue(i);
+      elementConsistent->setValue(i, featureId * 10);
+      elementInconsistent->setValue(i, featureId == 5 ? static_cast<double>(i) : featureId * 0.5);
+      if(featureId >= 0)
+      {
+        lastCells[featureId] = i;
+      }
+    }
+
+    Int32ArrayType::Pointer featureConsistent = Int32ArrayType::CreateArray(numFeatures, std::string("Consistent"), true);
+    DoubleArrayType::Pointer featureInconsistent = DoubleArrayType::CreateArray(numFeatures, std::string("Inconsistent"), true);
+
+    std::vector<int32_t> inconsistentFeatureIds;
+    bool ok = FeatureDataTransfer::CopyElementToFeature(*featureIds, {elementConsistent, elementInconsistent}, {featureConsistent, featureInconsistent}, inconsistentFeatureIds);
+    DREAM3D_REQUIRE(ok)
+    DREAM3D_REQUIRE_EQUAL(inconsistentFeatureIds.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(inconsistentFeatureIds[0], -1)
+    DREAM3D_REQUIRE_EQUAL(inconsistentFeatureIds[1], 5)
+
+    for(int32_t f = 0; f < numFeatures; f++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureConsistent->getValue(f), f * 10)
+    }
+    // The last cell of a Feature wins, as it does for a serial loop over the cells
+    DREAM3D_REQUIRE_EQUAL(featureInconsistent->getValue(5), static_cast<double>(lastCells[5]))
+    DREAM3D_REQUIRE_EQUAL(featureInconsistent->getValue(6), 3.0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void BenchmarkCopyFeatureToElement()
+  {
+    const size_t numCells = 256 * 256 * 128;
+    const int32_t numFeatures = 20000;
+    const size_t numArrays = 30;
+    Int32ArrayType::Pointer featureIds = createFeatureIds(numCells, numFeatures);
+
+    std::vector<IDataArray::Pointer> featureArrays;
+    std::vector<IDataArray::Pointer> elementArrays;
+    for(size_t a = 0; a < numArrays; a++)
+    {
+      FloatArrayType::Pointer featureArray = FloatArrayType::CreateArray(numFeatures, std::string("Feature"), true);
+      featureArray->initializeWithValue(static_cast<float>(a));
+      featureArrays.push_back(featureArray);
+      elementArrays.push_back(FloatArrayType::CreateArray(numCells, std::string("Element"), true));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for(size_t a = 0; a < numArrays; a++)
+    {
+      FeatureDataTransfer::CopyFeatureToElement(*featureIds, {featureArrays[a]}, {elementArrays[a]});
+    }
+    auto separate = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    bool ok = FeatureDataTransfer::CopyFeatureToElement(*featureIds, featureArrays, elementArrays);
+    auto combined = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    DREAM3D_REQUIRE(ok)
+
+    std::cout << "  " << numArrays << " arrays of " << numCells << " cells: one pass per array " << separate << " ms, single pass " << combined << " ms" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### FeatureDataTransferTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFindMaxFeatureId())
+    DREAM3D_REGISTER_TEST(TestCopyFeatureToElement())
+    DREAM3D_REGISTER_TEST(TestCopyElementToFeature())
+#if SIMPL_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkCopyFeatureToElement())
+#endif
+  }
+
+public:
+  FeatureDataTransferTest(const FeatureDataTransferTest&) = delete;            // Copy Constructor Not Implemented
+  FeatureDataTransferTest(FeatureDataTransferTest&&) = delete;                 // Move Constructor Not Implemented
+  FeatureDataTransferTest& operator=(const FeatureDataTransferTest&) = delete; // Copy Assignment Not Implemented
+  FeatureDataTransferTest& operator=(FeatureDataTransferTest&&) = delete;      // Move Assignment Not Implemented
+};
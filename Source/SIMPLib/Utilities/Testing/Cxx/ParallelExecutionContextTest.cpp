@@ -0,0 +1,153 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+
+class ParallelExecutionContextTest
+{
+public:
+  ParallelExecutionContextTest() = default;
+  ~ParallelExecutionContextTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestScopes()
+  {
+    DREAM3D_REQUIRE(nullptr == ParallelExecutionContext::Current())
+
+    ParallelExecutionContext::Pointer outer = ParallelExecutionContext::New(2);
+    DREAM3D_REQUIRE_EQUAL(outer->getMaxConcurrency(), 2)
+    DREAM3D_REQUIRE(outer->getEffectiveConcurrency() <= 2)
+    {
+      ParallelExecutionContext::Scope outerScope(outer);
+      DREAM3D_REQUIRE(outer == ParallelExecutionContext::Current())
+      {
+        ParallelExecutionContext::Pointer inner = ParallelExecutionContext::New(1);
+        ParallelExecutionContext::Scope innerScope(inner);
+        DREAM3D_REQUIRE(inner == ParallelExecutionContext::Current())
+        DREAM3D_REQUIRE_EQUAL(ParallelExecutionContext::CurrentConcurrency(), 1)
+      }
+      DREAM3D_REQUIRE(outer == ParallelExecutionContext::Current())
+
+      // Scopes are per thread
+      ParallelExecutionContext::Pointer otherThread = outer;
+      std::thread thread([&otherThread]() { otherThread = ParallelExecutionContext::Current(); });
+      thread.join();
+      DREAM3D_REQUIRE(nullptr == otherThread)
+    }
+    DREAM3D_REQUIRE(nullptr == ParallelExecutionContext::Current())
+
+    // An unavailable NUMA node must not prevent the context from working
+    ParallelExecutionContext::Pointer numa = ParallelExecutionContext::New(0, 4096);
+    int value = 0;
+    numa->execute([&value]() { value = 42; });
+    DREAM3D_REQUIRE_EQUAL(value, 42)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrencyLimit()
+  {
+    const size_t numElements = 4000000;
+    std::vector<int32_t> data(numElements, 1);
+
+    ParallelExecutionContext::Pointer context = ParallelExecutionContext::New(2);
+    ParallelExecutionContext::Scope scope(context);
+
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    std::atomic<int64_t> sum(0);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numElements);
+    dataAlg.execute([&](const SIMPLRange& range) {
+      int64_t localSum = 0;
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        localSum += data[i];
+      }
+      sum += localSum;
+      std::lock_guard<std::mutex> lock(mutex);
+      threadIds.insert(std::this_thread::get_id());
+    });
+
+    DREAM3D_REQUIRE_EQUAL(sum.load(), static_cast<int64_t>(numElements))
+    DREAM3D_REQUIRE(threadIds.size() <= 2)
+
+    ParallelTaskAlgorithm taskAlg;
+    DREAM3D_REQUIRE(taskAlg.getMaxThreads() <= 2)
+    taskAlg.setMaxThreads(64);
+    DREAM3D_REQUIRE(taskAlg.getMaxThreads() <= 2)
+
+    std::atomic<int32_t> tasksRun(0);
+    for(int32_t i = 0; i < 16; i++)
+    {
+      taskAlg.execute([&tasksRun]() { tasksRun++; });
+    }
+    taskAlg.wait();
+    DREAM3D_REQUIRE_EQUAL(tasksRun.load(), 16)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ParallelExecutionContextTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestScopes())
+    DREAM3D_REGISTER_TEST(TestConcurrencyLimit())
+  }
+
+public:
+  ParallelExecutionContextTest(const ParallelExecutionContextTest&) = delete;            // Copy Constructor Not Implemented
+  ParallelExecutionContextTest(ParallelExecutionContextTest&&) = delete;                 // Move Constructor Not Implemented
+  ParallelExecutionContextTest& operator=(const ParallelExecutionContextTest&) = delete; // Copy Assignment Not Implemented
+  ParallelExecutionContextTest& operator=(ParallelExecutionContextTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -3,6 +3,8 @@ set(TEST_${SUBDIR_NAME}_NAMES
   FloatSummationTest
   StringOperationsTest
   ColorUtilitiesTest
+  ParallelExecutionContextTest
+  FeatureDataTransferTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
@@ -0,0 +1,190 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelinePreflightWorker.h"
+
+#include <algorithm>
+
+#include <QtCore/QElapsedTimer>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelinePreflightWorker::PipelinePreflightWorker(int requestId, const FilterPipeline::FilterContainerType& filters)
+: m_RequestId(requestId)
+, m_Pipeline(FilterPipeline::New())
+{
+  for(const auto& filter : filters)
+  {
+    AbstractFilter::Pointer copy = filter->newFilterInstance(true);
+    if(nullptr == copy)
+    {
+      continue;
+    }
+    copy->setEnabled(filter->getEnabled());
+    copy->copyRenameState(*filter);
+
+    // Record the renames the preflight pushes into the copy's parameters so they can be replayed on the source
+    const size_t index = m_AppliedRenames.size();
+    m_AppliedRenames.emplace_back();
+    connect(copy.get(), &AbstractFilter::dataArrayPathUpdated, this, [this, index](const QString& propertyName, const DataArrayPath::RenameType& renamePath) {
+      Q_UNUSED(propertyName)
+      QMutexLocker locker(&m_Mutex);
+      DataArrayPath::RenameContainer& renames = m_AppliedRenames[index];
+      if(std::find(renames.begin(), renames.end(), renamePath) == renames.end())
+      {
+        renames.push_back(renamePath);
+      }
+    });
+
+    m_SourceFilters.push_back(filter);
+    m_Pipeline->pushBack(copy);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelinePreflightWorker::~PipelinePreflightWorker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelinePreflightWorker::getRequestId() const
+{
+  return m_RequestId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::FilterContainerType PipelinePreflightWorker::getSourceFilters() const
+{
+  return m_SourceFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer PipelinePreflightWorker::getPipeline() const
+{
+  return m_Pipeline;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath::RenameContainer PipelinePreflightWorker::getAppliedRenames(int index) const
+{
+  QMutexLocker locker(&m_Mutex);
+  if(index < 0 || index >= static_cast<int>(m_AppliedRenames.size()))
+  {
+    return {};
+  }
+  return m_AppliedRenames[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<AbstractMessage::Pointer> PipelinePreflightWorker::getMessages() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Messages;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelinePreflightWorker::getErrorCode() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_ErrorCode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelinePreflightWorker::getElapsedTime() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_ElapsedTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelinePreflightWorker::cancel()
+{
+  m_Canceled = true;
+  m_Pipeline->cancelPreflight();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelinePreflightWorker::isCanceled() const
+{
+  return m_Canceled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelinePreflightWorker::run()
+{
+  QElapsedTimer timer;
+  timer.start();
+
+  // Both the worker and the pipeline live on the background thread, so the messages arrive directly
+  m_Pipeline->addMessageReceiver(this);
+  int err = m_Pipeline->preflightPipeline();
+  m_Pipeline->removeMessageReceiver(this);
+
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_ErrorCode = err;
+    m_ElapsedTime = timer.elapsed();
+  }
+  Q_EMIT finished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelinePreflightWorker::processPipelineMessage(const AbstractMessage::Pointer& msg)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Messages.push_back(msg);
+}
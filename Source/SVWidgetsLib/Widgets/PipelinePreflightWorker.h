@@ -0,0 +1,152 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <QtCore/QMutex>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+#include "SVWidgetsLib/SVWidgetsLib.h"
+
+/**
+ * @brief The PipelinePreflightWorker class preflights a copy of a pipeline's filters on a background thread.
+ * The copies are made when the worker is created, so the filters that the GUI edits are never touched by the
+ * background thread. The messages the preflight generates are collected instead of being sent to any observer,
+ * which lets the owner decide whether the results are still current before it shows them.
+ */
+class SVWidgetsLib_EXPORT PipelinePreflightWorker : public Observer
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Copies the given filters. This must be called on the thread that owns the filters.
+   * @param requestId Id the owner uses to tell which request the results belong to
+   * @param filters
+   */
+  PipelinePreflightWorker(int requestId, const FilterPipeline::FilterContainerType& filters);
+
+  ~PipelinePreflightWorker() override;
+
+  /**
+   * @brief Getter property for RequestId
+   * @return Value of RequestId
+   */
+  int getRequestId() const;
+
+  /**
+   * @brief Returns the filters the copies were made from
+   * @return
+   */
+  FilterPipeline::FilterContainerType getSourceFilters() const;
+
+  /**
+   * @brief Returns the pipeline of copied filters. Each copy holds its preflight results once finished() was emitted.
+   * @return
+   */
+  FilterPipeline::Pointer getPipeline() const;
+
+  /**
+   * @brief Returns the renamed DataArrayPaths the preflight applied to the parameters of the copy at the given index.
+   * Applying them to the source filter brings its parameters in line with the copy.
+   * @param index
+   * @return
+   */
+  DataArrayPath::RenameContainer getAppliedRenames(int index) const;
+
+  /**
+   * @brief Returns the messages the preflight generated
+   * @return
+   */
+  std::vector<AbstractMessage::Pointer> getMessages() const;
+
+  /**
+   * @brief Returns the error code of the preflight
+   * @return
+   */
+  int getErrorCode() const;
+
+  /**
+   * @brief Returns the number of milliseconds the preflight took
+   * @return
+   */
+  qint64 getElapsedTime() const;
+
+  /**
+   * @brief Stops the preflight before it reaches the next filter. This may be called from any thread.
+   */
+  void cancel();
+
+  /**
+   * @brief Returns true if cancel() was called
+   * @return
+   */
+  bool isCanceled() const;
+
+public Q_SLOTS:
+  /**
+   * @brief Preflights the copied pipeline and emits finished()
+   */
+  void run();
+
+  void processPipelineMessage(const AbstractMessage::Pointer& msg) override;
+
+Q_SIGNALS:
+  void finished();
+
+private:
+  int m_RequestId = 0;
+  FilterPipeline::FilterContainerType m_SourceFilters;
+  FilterPipeline::Pointer m_Pipeline;
+  std::atomic<bool> m_Canceled = {false};
+
+  mutable QMutex m_Mutex;
+  std::vector<AbstractMessage::Pointer> m_Messages;
+  std::vector<DataArrayPath::RenameContainer> m_AppliedRenames;
+  int m_ErrorCode = 0;
+  qint64 m_ElapsedTime = 0;
+
+public:
+  PipelinePreflightWorker(const PipelinePreflightWorker&) = delete;            // Copy Constructor Not Implemented
+  PipelinePreflightWorker(PipelinePreflightWorker&&) = delete;                 // Move Constructor Not Implemented
+  PipelinePreflightWorker& operator=(const PipelinePreflightWorker&) = delete; // Copy Assignment Not Implemented
+  PipelinePreflightWorker& operator=(PipelinePreflightWorker&&) = delete;      // Move Assignment Not Implemented
+};
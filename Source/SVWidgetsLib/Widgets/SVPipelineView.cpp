@@ -43,6 +43,7 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QMimeData>
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
 
 #include <QtGui/QClipboard>
@@ -84,6 +85,7 @@
 #include "SVWidgetsLib/Widgets/PipelineFilterMimeData.h"
 #include "SVWidgetsLib/Widgets/PipelineItemDelegate.h"
 #include "SVWidgetsLib/Widgets/PipelineModel.h"
+#include "SVWidgetsLib/Widgets/PipelinePreflightWorker.h"
 #include "SVWidgetsLib/Widgets/ProgressDialog.h"
 #include "SVWidgetsLib/Widgets/SVStyle.h"
 #include "SVWidgetsLib/Widgets/StandardOutputWidget.h"
@@ -114,6 +116,13 @@ SVPipelineView::SVPipelineView(QWidget* parent)
 // -----------------------------------------------------------------------------
 SVPipelineView::~SVPipelineView()
 {
+  cancelPreflight();
+  if(nullptr != m_PreflightThread)
+  {
+    m_PreflightThread->wait();
+  }
+  delete m_PreflightWorker;
+  delete m_PreflightThread;
   delete m_WorkerThread;
   delete m_ActionEnableFilter;
 }
@@ -153,6 +162,13 @@ void SVPipelineView::setupGui()
   setFocusPolicy(Qt::StrongFocus);
   setDropIndicatorShown(false);
 
+  if(nullptr == m_PreflightTimer)
+  {
+    m_PreflightTimer = new QTimer(this);
+    m_PreflightTimer->setSingleShot(true);
+    connect(m_PreflightTimer, &QTimer::timeout, this, &SVPipelineView::startPreflight);
+  }
+
   connectSignalsSlots();
 }
 
@@ -180,6 +196,30 @@ void SVPipelineView::addPipelineMessageObserver(QObject* pipelineMessageObserver
   m_PipelineMessageObservers.push_back(pipelineMessageObserver);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::setPreflightDelay(int value)
+{
+  m_PreflightDelay = std::max(value, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SVPipelineView::getPreflightDelay() const
+{
+  return m_PreflightDelay;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SVPipelineView::isPreflightPending() const
+{
+  return m_PreflightTimer->isActive() || nullptr != m_PreflightWorker;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -322,7 +362,26 @@ void SVPipelineView::preflightPipeline()
   {
     return;
   }
-  Q_EMIT clearIssuesTriggered();
+
+  // Every edit supersedes the preflight that is running for the previous one
+  m_PreflightRequestId++;
+  if(nullptr != m_PreflightWorker)
+  {
+    m_PreflightWorker->cancel();
+  }
+  m_PreflightTimer->start(m_PreflightDelay);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::startPreflight()
+{
+  // A running preflight starts the next one itself once it stopped. The pipeline preflights itself before it executes.
+  if(nullptr != m_PreflightWorker || nullptr != m_PipelineInFlight)
+  {
+    return;
+  }
 
   PipelineModel* model = getPipelineModel();
   if(nullptr == model)
@@ -332,64 +391,170 @@ void SVPipelineView::preflightPipeline()
 
   // Create a Pipeline Object and fill it with the filters from this View
   FilterPipeline::Pointer pipeline = getFilterPipeline();
+  FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
 
-  // qDebug() << "Prepping Filters for preflight... ";
+  // The background thread works on copies, so the parameter widgets have to write their current values into the
+  // filters before the copies are made
+  for(const auto& filter : filters)
+  {
+    Q_EMIT filter->updateFilterParameters(filter.get());
+  }
 
-  FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
-  for(int i = 0; i < filters.size(); i++)
+  m_PreflightWorker = new PipelinePreflightWorker(m_PreflightRequestId, filters);
+  m_PreflightThread = new QThread();
+  // The cache lets the worker start at the first filter that changed since the last preflight
+  m_PreflightWorker->getPipeline()->setPreflightCache(m_PreflightCache);
+  m_PreflightWorker->getPipeline()->moveToThread(m_PreflightThread);
+  m_PreflightWorker->moveToThread(m_PreflightThread);
+
+  connect(m_PreflightThread, &QThread::started, m_PreflightWorker, &PipelinePreflightWorker::run);
+  connect(m_PreflightWorker, &PipelinePreflightWorker::finished, m_PreflightThread, &QThread::quit);
+  connect(m_PreflightThread, &QThread::finished, this, &SVPipelineView::finishPreflight);
+
+  m_PreflightThread->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::finishPreflight()
+{
+  // The thread has stopped, so the worker and the copied filters can be destroyed here
+  std::unique_ptr<PipelinePreflightWorker> worker(m_PreflightWorker);
+  m_PreflightWorker = nullptr;
+  delete m_PreflightThread;
+  m_PreflightThread = nullptr;
+
+  if(m_ExecuteAfterPreflight)
   {
-    filters.at(i)->clearErrorCode();
-    filters.at(i)->setCancel(false);
+    m_ExecuteAfterPreflight = false;
+    executePipeline();
+    return;
+  }
 
-    QModelIndex childIndex = model->index(i, PipelineItem::Contents);
-    if(childIndex.isValid())
+  if(nullptr == worker || nullptr != m_PipelineInFlight)
+  {
+    return;
+  }
+
+  if(worker->getRequestId() != m_PreflightRequestId)
+  {
+    // A newer request came in while this preflight was running. Start it unless it is still being debounced.
+    if(!m_PreflightTimer->isActive())
     {
-      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
-      AbstractFilter::Pointer filter = model->filter(childIndex);
-      if(filter && filter->getEnabled())
-      {
-        model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
-      }
+      startPreflight();
     }
+    return;
   }
 
-  int err = pipeline->preflightPipeline();
-  if(err < 0)
+  PipelineModel* model = getPipelineModel();
+  if(nullptr == model)
   {
-    // FIXME: Implement error handling.
+    return;
   }
-  int count = pipeline->getFilterContainer().size();
-  // Now that the preflight has been executed loop through the filters and check their error condition and set the
-  // outline on the filter widget if there were errors or warnings
-  for(qint32 i = 0; i < count; ++i)
+
+  Q_EMIT clearIssuesTriggered();
+
+  // Hand the messages to the observers only now that the results are known to be current
+  std::vector<AbstractMessage::Pointer> messages = worker->getMessages();
+  for(const auto& msg : messages)
   {
-    QModelIndex childIndex = model->index(i, PipelineItem::Contents);
-    if(childIndex.isValid())
+    for(const auto& observer : m_PipelineMessageObservers)
     {
-      AbstractFilter::Pointer filter = model->filter(childIndex);
-      if(filter.get() != nullptr)
-      {
-        if(filter->getWarningCode() < 0)
-        {
-          model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Warning), PipelineModel::ErrorStateRole);
-        }
-        if(filter->getErrorCode() < 0)
-        {
-          model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Error), PipelineModel::ErrorStateRole);
-        }
-      }
+      QMetaObject::invokeMethod(observer, "processPipelineMessage", Qt::DirectConnection, Q_ARG(AbstractMessage::Pointer, msg));
     }
   }
 
-  Q_EMIT preflightFinished(count, err);
+  // Move the results of the copies over to the filters in the model. Replaying the preflight notifications of each
+  // filter lets its parameter widgets update from the data structure the filter now sees. The copies hold the
+  // snapshots kept by the preflight cache, which the next background preflight reads, so the widgets get copies.
+  FilterPipeline::FilterContainerType filters = worker->getSourceFilters();
+  FilterPipeline::FilterContainerType copies = worker->getPipeline()->getFilterContainer();
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  for(int i = 0; i < filters.size(); i++)
+  {
+    const AbstractFilter::Pointer& filter = filters[i];
+    const AbstractFilter::Pointer& copy = copies[i];
+    filter->clearErrorCode();
+    filter->clearWarningCode();
+
+    // Paths renamed upstream were only written into the copy. Replaying them updates the filter and its widgets.
+    filter->renameDataArrayPaths(worker->getAppliedRenames(i));
+    filter->copyRenameState(*copy);
+
+    if(copy->getEnabled())
+    {
+      filter->setDataContainerArray(dca);
+      Q_EMIT filter->preflightAboutToExecute();
+      DataContainerArray::Pointer snapshot = copy->getDataContainerArray();
+      dca = (nullptr != snapshot) ? snapshot->deepCopy(false) : DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      // The messages themselves already went to the observers above, only the codes are carried over
+      filter->copyConditionCodes(*copy);
+      Q_EMIT filter->preflightExecuted();
+    }
+    else
+    {
+      filter->setDataContainerArray(dca);
+    }
+
+    QModelIndex childIndex = model->indexOfFilter(filter.get());
+    if(!childIndex.isValid())
+    {
+      continue;
+    }
+    PipelineItem::ErrorState errorState = PipelineItem::ErrorState::Ok;
+    if(copy->getErrorCode() < 0)
+    {
+      errorState = PipelineItem::ErrorState::Error;
+    }
+    else if(copy->getWarningCode() < 0)
+    {
+      errorState = PipelineItem::ErrorState::Warning;
+    }
+    model->setData(childIndex, static_cast<int>(errorState), PipelineModel::ErrorStateRole);
+    if(filter->getEnabled())
+    {
+      model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
+    }
+  }
+
+  Q_EMIT statusMessage(tr("Preflight of %1 filters finished in %2 ms (%3 filters unchanged)")
+                           .arg(filters.size())
+                           .arg(worker->getElapsedTime())
+                           .arg(m_PreflightCache->getReusedFilterCount()));
+  Q_EMIT preflightFinished(filters.size(), worker->getErrorCode());
   updateFilterInputWidgetIndices();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::cancelPreflight()
+{
+  m_PreflightTimer->stop();
+  m_PreflightRequestId++;
+  if(nullptr != m_PreflightWorker)
+  {
+    m_PreflightWorker->cancel();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void SVPipelineView::executePipeline()
 {
+  // The pipeline is preflighted again below, so a pending background preflight is obsolete. A running one is only asked
+  // to stop; the execution starts from finishPreflight() once it did, so two preflights never read the same input files
+  // at once and the GUI does not block while the running filter winds down.
+  cancelPreflight();
+  if(nullptr != m_PreflightWorker)
+  {
+    m_ExecuteAfterPreflight = true;
+    return;
+  }
+
   if(m_WorkerThread != nullptr)
   {
     m_WorkerThread->wait(); // Wait until the thread is complete
@@ -420,12 +585,13 @@ void SVPipelineView::executePipeline()
   }
   Q_EMIT stdOutMessage(SVStyle::Instance()->WrapTextWithHtmlStyle("    Preflight Results: 0 Errors", false));
 
-  // Save each of the DataContainerArrays from each of the filters for when the pipeline is complete
+  // Save each of the DataContainerArrays from each of the filters for when the pipeline is complete.
+  // The preflight snapshots are never modified, so holding on to them is enough.
   m_PreflightDataContainerArrays.clear();
   FilterPipeline::FilterContainerType filters = m_PipelineInFlight->getFilterContainer();
   for(const auto& filter : filters)
   {
-    m_PreflightDataContainerArrays.push_back(filter->getDataContainerArray()->deepCopy(true));
+    m_PreflightDataContainerArrays.push_back(filter->getDataContainerArray());
   }
 
   // Save the preferences file NOW in case something happens
@@ -48,6 +48,7 @@
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 #include "SIMPLib/Messages/AbstractMessage.h"
 class DataContainerArray;
 using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
@@ -66,7 +67,9 @@ class QAction;
 class PipelineFilterObject;
 class DataStructureWidget;
 class PipelineModel;
+class PipelinePreflightWorker;
 class QSignalMapper;
+class QTimer;
 
 /*
  *
@@ -134,6 +137,25 @@ public:
    */
   void addPipelineMessageObserver(QObject* pipelineMessageObserver);
 
+  /**
+   * @brief Sets the number of milliseconds preflightPipeline() waits for further requests before the preflight
+   * starts. All requests that arrive in the meantime are coalesced into one preflight.
+   * @param value
+   */
+  void setPreflightDelay(int value);
+
+  /**
+   * @brief Returns the number of milliseconds preflightPipeline() waits for further requests
+   * @return
+   */
+  int getPreflightDelay() const;
+
+  /**
+   * @brief Returns true while a requested preflight waits to start or runs in the background
+   * @return
+   */
+  bool isPreflightPending() const;
+
   /**
    * @brief filterCount
    * @return
@@ -303,8 +325,10 @@ public Q_SLOTS:
   void pasteFilters(int insertIndex = -1, bool useAnimationOnFirstRun = true);
 
   /**
-   * @brief preflightPipeline
-   * @param pipelineIndex
+   * @brief Requests a preflight of the pipeline. The preflight runs on copies of the filters on a background
+   * thread once no further request arrived for getPreflightDelay() milliseconds, so editing a parameter of a long
+   * pipeline does not block the GUI. A preflight that is still running when a newer one is requested is canceled
+   * and only the results of the latest request are shown.
    */
   void preflightPipeline();
 
@@ -447,7 +471,23 @@ private Q_SLOTS:
    */
   void finishPipeline();
 
+  /**
+   * @brief Starts a background preflight for the latest request unless one is still running
+   */
+  void startPreflight();
+
+  /**
+   * @brief Shows the results of the background preflight if they belong to the latest request and starts the next
+   * preflight otherwise
+   */
+  void finishPreflight();
+
 private:
+  /**
+   * @brief Cancels any requested or running preflight.  A running preflight stops in the background and reports
+   * through finishPreflight().
+   */
+  void cancelPreflight();
   SVPipelineView::PipelineViewState m_PipelineState = {};
 
   QThread* m_WorkerThread = nullptr;
@@ -461,6 +501,14 @@ private:
   bool m_BlockPreflight = false;
   std::stack<bool> m_BlockPreflightStack;
 
+  QTimer* m_PreflightTimer = nullptr;
+  int m_PreflightDelay = 250;
+  int m_PreflightRequestId = 0;
+  QThread* m_PreflightThread = nullptr;
+  PipelinePreflightWorker* m_PreflightWorker = nullptr;
+  bool m_ExecuteAfterPreflight = false;
+  PreflightCache::Pointer m_PreflightCache = PreflightCache::New();
+
   QAction* m_ActionEnableFilter = nullptr;
   QAction* m_ActionCut = nullptr;
   QAction* m_ActionCopy = nullptr;